@@ -0,0 +1,79 @@
+# FindBlst.cmake - Find or build the blst BLS12-381 library
+# This module provides blst as an imported target for ChainForge
+
+include(ExternalProject)
+
+# Look for system installation
+find_path(BLST_INCLUDE_DIR
+    NAMES blst.h
+    PATHS /usr/include /usr/local/include
+    PATH_SUFFIXES blst
+)
+
+find_library(BLST_LIBRARY
+    NAMES blst
+    PATHS /usr/lib /usr/local/lib /usr/lib/x86_64-linux-gnu
+)
+
+# If not found, build from source. blst ships build scripts rather than a
+# CMake project; they produce a static library in the source tree.
+if(NOT BLST_INCLUDE_DIR OR NOT BLST_LIBRARY)
+    message(STATUS "blst not found system-wide, building from source...")
+
+    set(BLST_SOURCE_DIR ${CMAKE_BINARY_DIR}/_deps/blst_external-src)
+    if(MSVC)
+        # build.bat drives cl and ml64 and writes blst.lib; build.sh needs a POSIX shell
+        set(BLST_BUILD_COMMAND cmd /c build.bat)
+        set(BLST_LIBRARY ${BLST_SOURCE_DIR}/blst.lib)
+    else()
+        set(BLST_BUILD_COMMAND sh build.sh -O2 -fPIC)
+        set(BLST_LIBRARY ${BLST_SOURCE_DIR}/libblst.a)
+    endif()
+
+    ExternalProject_Add(blst_external
+        GIT_REPOSITORY https://github.com/supranational/blst.git
+        GIT_TAG v0.3.11  # Use stable release
+        GIT_SHALLOW TRUE
+        SOURCE_DIR ${BLST_SOURCE_DIR}
+        BUILD_IN_SOURCE TRUE
+        CONFIGURE_COMMAND ""
+        BUILD_COMMAND ${BLST_BUILD_COMMAND}
+        INSTALL_COMMAND ""
+        BUILD_BYPRODUCTS ${BLST_LIBRARY}
+    )
+
+    set(BLST_INCLUDE_DIR ${BLST_SOURCE_DIR}/bindings)
+    # The include directory must exist when the imported target is created
+    file(MAKE_DIRECTORY ${BLST_INCLUDE_DIR})
+    set(BLST_BUILT_FROM_SOURCE TRUE)
+else()
+    message(STATUS "Found blst: ${BLST_LIBRARY}")
+    set(BLST_BUILT_FROM_SOURCE FALSE)
+endif()
+
+# Create imported target
+if(NOT TARGET blst::blst)
+    add_library(blst::blst STATIC IMPORTED)
+    set_target_properties(blst::blst PROPERTIES
+        IMPORTED_LOCATION "${BLST_LIBRARY}"
+        INTERFACE_INCLUDE_DIRECTORIES "${BLST_INCLUDE_DIR}"
+    )
+    if(BLST_BUILT_FROM_SOURCE)
+        add_dependencies(blst::blst blst_external)
+    endif()
+endif()
+
+# Set standard variables
+set(BLST_FOUND TRUE)
+set(BLST_INCLUDE_DIRS ${BLST_INCLUDE_DIR})
+set(BLST_LIBRARIES ${BLST_LIBRARY})
+
+mark_as_advanced(BLST_INCLUDE_DIR BLST_LIBRARY)
+
+# Print status
+if(BLST_FOUND)
+    message(STATUS "blst configuration:")
+    message(STATUS "  Include dir: ${BLST_INCLUDE_DIR}")
+    message(STATUS "  Library: ${BLST_LIBRARY}")
+    message(STATUS "  Built from source: ${BLST_BUILT_FROM_SOURCE}")
+endif()
@@ -0,0 +1,124 @@
+#include "chainforge/core/block.hpp"
+#include "chainforge/core/transaction.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+// Count every allocation that reaches the global heap
+namespace {
+std::atomic<size_t> global_allocations{0};
+}
+
+void* operator new(std::size_t size) {
+    global_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+// std::pmr::new_delete_resource() goes through the aligned form
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    global_allocations.fetch_add(1, std::memory_order_relaxed);
+    auto align = static_cast<std::size_t>(alignment);
+    if (void* memory = std::aligned_alloc(align, (std::max<std::size_t>(size, 1) + align - 1) / align * align)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    std::free(memory);
+}
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct RunResult {
+    size_t allocations;
+    double micros;
+    bool valid;
+};
+
+// Build a block template from pending transactions, then validate and hash it
+RunResult build_and_validate(const std::vector<core::Transaction>& pending, std::pmr::memory_resource* resource) {
+    size_t before = global_allocations.load(std::memory_order_relaxed);
+    auto start = Clock::now();
+
+    core::Block block(1, core::Hash::zero(), core::Timestamp::from_seconds(1700000000), resource);
+    block.set_gas_limit(pending.size() * 21000);
+    block.reserve_transactions(pending.size());
+    for (const auto& tx : pending) {
+        block.add_transaction(tx);
+    }
+    bool valid = block.is_valid() && block.calculate_merkle_root() == block.merkle_root();
+    block.calculate_hash();
+
+    double micros = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    return {global_allocations.load(std::memory_order_relaxed) - before, micros, valid};
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t tx_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    const int rounds = 20;
+
+    // One in four transactions carries a payload too large to store inline
+    std::vector<core::Transaction> pending;
+    pending.reserve(tx_count);
+    for (size_t i = 0; i < tx_count; ++i) {
+        core::Transaction tx(core::Address::random(), core::Address::random(), core::Amount::from_wei(1000 + i));
+        tx.set_nonce(i);
+        if (i % 4 == 0) {
+            tx.set_data(std::vector<uint8_t>(256, static_cast<uint8_t>(i)));
+        }
+        pending.push_back(std::move(tx));
+    }
+
+    std::cout << "=== Block allocation benchmark ===" << std::endl;
+    std::cout << "Transactions: " << tx_count << ", rounds: " << rounds << std::endl;
+
+    RunResult heap{};
+    RunResult arena{};
+    double heap_best = 1e18;
+    double arena_best = 1e18;
+
+    // The arena's initial buffer is allocated once and rewound between blocks
+    std::vector<std::byte> buffer(tx_count * 512 + 65536);
+    for (int round = 0; round < rounds; ++round) {
+        heap = build_and_validate(pending, std::pmr::new_delete_resource());
+        heap_best = std::min(heap_best, heap.micros);
+
+        std::pmr::monotonic_buffer_resource block_arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+        arena = build_and_validate(pending, &block_arena);
+        arena_best = std::min(arena_best, arena.micros);
+    }
+
+    std::cout << "global heap: " << heap.allocations << " allocations, " << heap_best << " us"
+              << (heap.valid ? "" : " (INVALID)") << std::endl;
+    std::cout << "block arena: " << arena.allocations << " allocations, " << arena_best << " us"
+              << (arena.valid ? "" : " (INVALID)") << std::endl;
+
+    return heap.valid && arena.valid ? 0 : 1;
+}
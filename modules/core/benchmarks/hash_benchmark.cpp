@@ -0,0 +1,89 @@
+#include "chainforge/core/transaction.hpp"
+#include "chainforge/core/hash.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+core::TransactionData make_transaction_data(uint64_t index, size_t payload_size, std::mt19937_64& rng) {
+    core::TransactionData data{};
+    for (size_t i = 0; i < sizeof(index); ++i) {
+        data.from[i] = static_cast<uint8_t>((index >> ((sizeof(index) - 1 - i) * 8)) & 0xFF);
+    }
+    data.to[0] = 0xAA;
+    data.value = rng();
+    data.gas_limit = 21000;
+    data.gas_price = 1 + rng() % 1000;
+    data.nonce = index;
+    data.data = std::vector<uint8_t>(payload_size, static_cast<uint8_t>(index));
+    return data;
+}
+
+// The previous encoder: a heap vector grown one byte at a time, hashed in one shot
+core::Hash legacy_transaction_hash(const core::TransactionData& data) {
+    std::vector<uint8_t> hash_data;
+    hash_data.insert(hash_data.end(), data.from.begin(), data.from.end());
+    hash_data.insert(hash_data.end(), data.to.begin(), data.to.end());
+    for (uint64_t field : {data.value, data.gas_limit, data.gas_price, data.nonce}) {
+        for (int i = sizeof(field) - 1; i >= 0; --i) {
+            hash_data.push_back(static_cast<uint8_t>((field >> (i * 8)) & 0xFF));
+        }
+    }
+    hash_data.insert(hash_data.end(), data.data.begin(), data.data.end());
+    return core::hash_sha256(hash_data);
+}
+
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t tx_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const size_t payload_size = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 0;
+
+    std::cout << "=== Transaction hashing benchmark ===" << std::endl;
+    std::cout << "Transactions: " << tx_count << ", payload bytes: " << payload_size << std::endl;
+
+    std::mt19937_64 rng(42);
+    std::vector<core::Transaction> txs;
+    txs.reserve(tx_count);
+    for (size_t i = 0; i < tx_count; ++i) {
+        txs.emplace_back(make_transaction_data(i, payload_size, rng));
+    }
+
+    // Both passes see every transaction exactly once
+    size_t mismatches = 0;
+    std::vector<core::Hash> legacy;
+    legacy.reserve(tx_count);
+
+    auto start = Clock::now();
+    for (const auto& tx : txs) {
+        legacy.push_back(legacy_transaction_hash(tx.data()));
+    }
+    double legacy_seconds = seconds_since(start);
+
+    start = Clock::now();
+    for (size_t i = 0; i < tx_count; ++i) {
+        if (txs[i].calculate_hash() != legacy[i]) {
+            ++mismatches;
+        }
+    }
+    double canonical_seconds = seconds_since(start);
+
+    std::cout << "Before (vector encoder):    " << static_cast<double>(tx_count) / legacy_seconds << " hashes/s"
+              << std::endl;
+    std::cout << "After (canonical encoder):  " << static_cast<double>(tx_count) / canonical_seconds << " hashes/s ("
+              << legacy_seconds / canonical_seconds << "x)" << std::endl;
+    std::cout << "Digest mismatches: " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,89 @@
+#include "chainforge/core/flat_hash_map.hpp"
+#include "chainforge/core/hash.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The previous std::hash<Hash>: the first 8 bytes assembled one at a time
+struct ByteLoopHash {
+    size_t operator()(const core::Hash& h) const noexcept {
+        size_t result = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            result = (result << 8) | h.data()[i];
+        }
+        return result;
+    }
+};
+
+template <typename F>
+double ns_per_op(size_t ops, F&& body) {
+    auto start = Clock::now();
+    body();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(ops);
+}
+
+// Insert every key, look each up, miss as many times, then erase half
+template <typename Map>
+void run(const char* name, const std::vector<core::Hash>& keys, const std::vector<core::Hash>& misses) {
+    Map map;
+    size_t sink = 0;
+    double insert = ns_per_op(keys.size(), [&] {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            map.try_emplace(keys[i], i);
+        }
+    });
+    double hit = ns_per_op(keys.size(), [&] {
+        for (const auto& key : keys) {
+            sink += map.find(key)->second;
+        }
+    });
+    double miss = ns_per_op(misses.size(), [&] {
+        for (const auto& key : misses) {
+            sink += map.count(key);
+        }
+    });
+    double erase = ns_per_op(keys.size() / 2, [&] {
+        for (size_t i = 0; i < keys.size(); i += 2) {
+            sink += map.erase(keys[i]);
+        }
+    });
+
+    std::cout << std::left << std::setw(30) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(9) << insert << std::setw(9) << hit << std::setw(9) << miss << std::setw(9) << erase
+              << (sink == 0 ? " !" : "") << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::vector<core::Hash> keys;
+    std::vector<core::Hash> misses;
+    keys.reserve(count);
+    misses.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys.push_back(core::Hash::random());
+        misses.push_back(core::Hash::random());
+    }
+
+    std::cout << "=== Hash-keyed map benchmark (" << count << " entries, ns per operation) ===" << std::endl;
+    std::cout << std::left << std::setw(30) << "map" << std::right << std::setw(9) << "insert" << std::setw(9) << "hit"
+              << std::setw(9) << "miss" << std::setw(9) << "erase" << std::endl;
+
+    run<std::unordered_map<core::Hash, size_t, ByteLoopHash>>("unordered_map, byte loop", keys, misses);
+    run<std::unordered_map<core::Hash, size_t, core::HashKeyHash, core::HashKeyEqual>>("unordered_map, fingerprint",
+                                                                                          keys, misses);
+    run<core::FlatHashMap<core::Hash, size_t, core::HashKeyHash, core::HashKeyEqual>>("FlatHashMap, fingerprint", keys,
+                                                                                        misses);
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include "chainforge/core/hash.hpp"
+#include "chainforge/core/address.hpp"
+#include "chainforge/core/amount.hpp"
+#include "chainforge/core/hex.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The previous stream-based conversions
+std::string legacy_to_hex(const core::Hash256& data) {
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (uint8_t byte : data) {
+        ss << std::setw(2) << static_cast<int>(byte);
+    }
+    return ss.str();
+}
+
+core::Hash256 legacy_from_hex(const std::string& hex) {
+    core::Hash256 data{};
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<uint8_t>(std::stoi(hex.substr(i * 2, 2), nullptr, 16));
+    }
+    return data;
+}
+
+std::string legacy_amount_to_hex(uint64_t wei) {
+    std::stringstream ss;
+    ss << "0x" << std::hex << wei;
+    return ss.str();
+}
+
+template <typename F>
+double ns_per_op(size_t ops, F&& body) {
+    auto start = Clock::now();
+    body();
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(ops);
+}
+
+void report(const char* name, double before, double after) {
+    std::cout << std::left << std::setw(22) << name << std::right << std::fixed << std::setprecision(1)
+              << std::setw(8) << before << " -> " << std::setw(6) << after << " ns  (" << before / after << "x)"
+              << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+
+    std::vector<core::Hash> hashes;
+    std::vector<std::string> hex_strings;
+    hashes.reserve(count);
+    hex_strings.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        hashes.push_back(core::Hash::random());
+        hex_strings.push_back(hashes.back().to_hex());
+    }
+
+    std::cout << "=== Hex codec benchmark (" << count << " values, ns per value) ===" << std::endl;
+    size_t sink = 0;
+
+    double legacy = ns_per_op(count, [&] {
+        for (const auto& hash : hashes) {
+            sink += legacy_to_hex(hash.data()).size();
+        }
+    });
+    double current = ns_per_op(count, [&] {
+        for (const auto& hash : hashes) {
+            sink += hash.to_hex().size();
+        }
+    });
+    report("Hash::to_hex", legacy, current);
+
+    char buffer[core::Hash::HEX_LENGTH];
+    double into = ns_per_op(count, [&] {
+        for (const auto& hash : hashes) {
+            sink += static_cast<size_t>(hash.to_hex_into(buffer)[-1]);
+        }
+    });
+    report("Hash::to_hex_into", legacy, into);
+
+    legacy = ns_per_op(count, [&] {
+        for (const auto& hex : hex_strings) {
+            sink += legacy_from_hex(hex)[0];
+        }
+    });
+    current = ns_per_op(count, [&] {
+        for (const auto& hex : hex_strings) {
+            sink += core::Hash(hex).data()[0];
+        }
+    });
+    report("Hash(hex)", legacy, current);
+
+    legacy = ns_per_op(count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            sink += legacy_amount_to_hex(hashes[i].data()[0] * 0x0123456789ULL).size();
+        }
+    });
+    current = ns_per_op(count, [&] {
+        for (size_t i = 0; i < count; ++i) {
+            sink += core::Amount::from_wei(hashes[i].data()[0] * 0x0123456789ULL).to_hex().size();
+        }
+    });
+    report("Amount::to_hex", legacy, current);
+
+    return sink == 0 ? 1 : 0;
+}
@@ -0,0 +1,101 @@
+#include "chainforge/core/block.hpp"
+#include "chainforge/core/transaction.hpp"
+#include "chainforge/core/json_writer.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <nlohmann/json.hpp>
+#include <string>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The previous DOM-based serialization, including the re-parse of every transaction
+std::string legacy_transaction_json(const core::Transaction& tx) {
+    nlohmann::json j;
+    j["from"] = tx.from().to_hex();
+    j["to"] = tx.to().to_hex();
+    j["value"] = tx.value().to_string();
+    j["gasLimit"] = tx.gas_limit();
+    j["gasPrice"] = tx.gas_price();
+    j["nonce"] = tx.nonce();
+    j["data"] = "0x" + std::string(64, '0');
+    j["hash"] = tx.calculate_hash().to_hex();
+    return j.dump(2);
+}
+
+std::string legacy_block_json(const core::Block& block) {
+    nlohmann::json j;
+    j["height"] = block.height();
+    j["hash"] = block.calculate_hash().to_hex();
+    j["parentHash"] = block.parent_hash().to_hex();
+    j["merkleRoot"] = block.merkle_root().to_hex();
+    j["timestamp"] = block.timestamp().seconds();
+    j["nonce"] = block.nonce();
+    j["gasLimit"] = block.gas_limit();
+    j["gasPrice"] = block.gas_price();
+    j["chainId"] = block.chain_id();
+    nlohmann::json txs = nlohmann::json::array();
+    for (const auto& tx : block.transactions()) {
+        txs.push_back(nlohmann::json::parse(legacy_transaction_json(tx)));
+    }
+    j["transactions"] = txs;
+    return j.dump(2);
+}
+
+template <typename F>
+double best_ms(int rounds, F&& body) {
+    double best = 1e18;
+    for (int round = 0; round < rounds; ++round) {
+        auto start = Clock::now();
+        body();
+        best = std::min(best, std::chrono::duration<double, std::milli>(Clock::now() - start).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t tx_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000;
+    const int rounds = 5;
+
+    core::Block block(1, core::Hash::random(), core::Timestamp::from_seconds(1700000000));
+    block.reserve_transactions(tx_count);
+    for (size_t i = 0; i < tx_count; ++i) {
+        core::Transaction tx(core::Address::random(), core::Address::random(), core::Amount::from_wei(1000 + i));
+        tx.set_nonce(i);
+        block.add_transaction(tx);
+    }
+    // Hashes are cached after the first call, so every path serializes the same work
+    block.calculate_hash();
+    for (const auto& tx : block.transactions()) {
+        tx.calculate_hash();
+    }
+
+    std::string legacy;
+    double legacy_ms = best_ms(rounds, [&] { legacy = legacy_block_json(block); });
+    std::string pretty;
+    double pretty_ms = best_ms(rounds, [&] { pretty = block.to_json(); });
+
+    // RPC-style: compact output appended into a buffer reused across responses
+    std::string buffer;
+    double compact_ms = best_ms(rounds, [&] {
+        buffer.clear();
+        core::JsonWriter writer(buffer, core::JsonStyle::Compact);
+        block.write_json(writer);
+    });
+
+    std::cout << "=== Block JSON benchmark (" << tx_count << " transactions, best of " << rounds << ") ===" << std::endl;
+    std::cout << "nlohmann DOM dump(2):      " << legacy_ms << " ms, " << legacy.size() << " bytes" << std::endl;
+    std::cout << "JsonWriter pretty:         " << pretty_ms << " ms (" << legacy_ms / pretty_ms << "x)"
+              << (pretty == legacy ? ", identical output" : ", OUTPUT DIFFERS") << std::endl;
+    std::cout << "JsonWriter compact, reused buffer: " << compact_ms << " ms (" << legacy_ms / compact_ms << "x), "
+              << buffer.size() << " bytes" << std::endl;
+
+    return pretty == legacy ? 0 : 1;
+}
@@ -0,0 +1,85 @@
+#include "chainforge/core/transaction.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <vector>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The previous layout: payload always in its own heap vector, plus a hash cache
+struct LegacyTransaction {
+    core::Address160 from;
+    core::Address160 to;
+    uint64_t value;
+    core::GasLimit gas_limit;
+    core::GasPrice gas_price;
+    std::vector<uint8_t> data;
+    uint64_t nonce;
+    std::optional<core::Hash> cached_hash;
+};
+
+size_t heap_in_use() {
+#if defined(__GLIBC__)
+    auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+// Heap bytes per element held by a copy of `source`, and the best of several copy timings
+template <typename T>
+std::pair<double, double> measure_copies(const std::vector<T>& source) {
+    size_t before = heap_in_use();
+    std::vector<T> copy(source);
+    size_t after = heap_in_use();
+
+    // Copy-construct into storage that is already mapped, so only the element copies are timed
+    double best_seconds = 1e9;
+    for (int round = 0; round < 3; ++round) {
+        copy.clear();
+        auto start = Clock::now();
+        copy.insert(copy.end(), source.begin(), source.end());
+        best_seconds = std::min(best_seconds, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+
+    double count = static_cast<double>(copy.size());
+    return {static_cast<double>(after - before) / count, best_seconds * 1e9 / count};
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t tx_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+
+    std::cout << "=== Transaction layout benchmark ===" << std::endl;
+    std::cout << "Transactions: " << tx_count << ", sizeof legacy " << sizeof(LegacyTransaction) << " B, compact "
+              << sizeof(core::Transaction) << " B" << std::endl;
+
+    for (size_t payload_size : {size_t{0}, size_t{36}, size_t{60}, size_t{68}, size_t{512}}) {
+        std::vector<uint8_t> payload(payload_size, 0x5A);
+
+        std::vector<LegacyTransaction> legacy(tx_count);
+        std::vector<core::Transaction> compact(tx_count);
+        for (size_t i = 0; i < tx_count; ++i) {
+            legacy[i].data = payload;
+            compact[i].set_data(payload);
+        }
+
+        auto [legacy_bytes, legacy_ns] = measure_copies(legacy);
+        auto [compact_bytes, compact_ns] = measure_copies(compact);
+        std::cout << "payload " << payload_size << " B: memory/tx " << legacy_bytes << " -> " << compact_bytes
+                  << " B, copy/tx " << legacy_ns << " -> " << compact_ns << " ns" << std::endl;
+    }
+
+    return 0;
+}
@@ -3,7 +3,9 @@
 #include "types.hpp"
 #include <string>
 #include <array>
+#include <cstring>
 #include <vector>
+#include <functional>
 
 namespace chainforge::core {
 
@@ -34,6 +36,8 @@ public:
     
     // Conversion methods
     std::string to_hex() const;
+    // Writes HEX_LENGTH characters without a terminator and returns the end
+    char* to_hex_into(char* out) const noexcept;
     std::vector<uint8_t> to_bytes() const;
     
     // Validation methods
@@ -53,6 +57,7 @@ public:
     
     // Size information
     static constexpr size_t size() noexcept { return ADDRESS_SIZE; }
+    static constexpr size_t HEX_LENGTH = ADDRESS_SIZE * 2;
 
 private:
     Address160 data_;
@@ -67,4 +72,35 @@ bool is_valid_address(const std::string& hex_string);
 Address derive_address_from_public_key(const std::vector<uint8_t>& public_key);
 Address derive_contract_address(const Address& sender, uint64_t nonce);
 
+// Addresses are derived from hashes, so their first 8 bytes make a full-quality fingerprint
+inline uint64_t address_fingerprint(const Address160& data) noexcept {
+    uint64_t fingerprint;
+    std::memcpy(&fingerprint, data.data(), sizeof(fingerprint));
+    return fingerprint;
+}
+
+// Transparent hasher and equality for containers keyed by Address; lookups also take a raw Address160
+struct AddressKeyHash {
+    using is_transparent = void;
+    size_t operator()(const Address& address) const noexcept { return address_fingerprint(address.data()); }
+    size_t operator()(const Address160& data) const noexcept { return address_fingerprint(data); }
+};
+
+struct AddressKeyEqual {
+    using is_transparent = void;
+    bool operator()(const Address& lhs, const Address& rhs) const noexcept { return lhs.data() == rhs.data(); }
+    bool operator()(const Address& lhs, const Address160& rhs) const noexcept { return lhs.data() == rhs; }
+    bool operator()(const Address160& lhs, const Address& rhs) const noexcept { return lhs == rhs.data(); }
+};
+
 } // namespace chainforge::core
+
+// Address specialization for std::unordered_map
+namespace std {
+    template<>
+    struct hash<chainforge::core::Address> {
+        size_t operator()(const chainforge::core::Address& addr) const noexcept {
+            return chainforge::core::address_fingerprint(addr.data());
+        }
+    };
+}
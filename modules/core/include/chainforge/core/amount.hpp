@@ -22,6 +22,7 @@ public:
     static constexpr value_type MAX_VALUE = std::numeric_limits<value_type>::max();
     static constexpr decimal_type DECIMALS = 18; // Standard for most cryptocurrencies
     static constexpr value_type WEI_PER_ETHER = 1'000'000'000'000'000'000ULL; // 10^18
+    static constexpr size_t MAX_HEX_LENGTH = 18; // "0x" and 16 digits
     
     // Constructors
     Amount() = default;
@@ -45,6 +46,8 @@ public:
     // Conversion methods
     std::string to_string() const;
     std::string to_hex() const;
+    // Writes "0x" and the shortest digits, at most MAX_HEX_LENGTH characters, and returns the end
+    char* to_hex_into(char* out) const noexcept;
     double to_double() const;
     
     // Arithmetic operators
@@ -3,8 +3,11 @@
 #include "types.hpp"
 #include "hash.hpp"
 #include "timestamp.hpp"
+#include "merkle.hpp"
+#include "json_writer.hpp"
 #include <vector>
 #include <memory>
+#include <memory_resource>
 #include <optional>
 
 namespace chainforge::core {
@@ -14,19 +17,28 @@ class Transaction;
 /**
  * Block class representing a blockchain block
  * Contains header information and a list of transactions
+ *
+ * The transaction list, large payloads and the Merkle tree are allocated
+ * from the memory resource passed at construction, so a block can be built
+ * and validated inside a per-block arena such as
+ * std::pmr::monotonic_buffer_resource. The resource must outlive the block;
+ * copies of the block are allocated from the default resource again.
  */
 class Block {
 public:
     // Constructors
     Block() = default;
-    Block(BlockHeight height, const Hash& parent_hash, const Timestamp& timestamp);
-    Block(const BlockHeader& header, std::vector<Transaction> transactions);
+    explicit Block(std::pmr::memory_resource* resource);
+    Block(BlockHeight height, const Hash& parent_hash, const Timestamp& timestamp,
+          std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    Block(const BlockHeader& header, std::vector<Transaction> transactions,
+          std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     
     // Copy and move
     Block(const Block&) = default;
     Block(Block&&) = default;
     Block& operator=(const Block&) = default;
-    Block& operator=(Block&&) = default;
+    Block& operator=(Block&& other);
     
     // Destructor
     ~Block() = default;
@@ -35,8 +47,9 @@ public:
     const BlockHeader& header() const noexcept { return header_; }
     BlockHeader& header() noexcept { return header_; }
     
-    const std::vector<Transaction>& transactions() const noexcept { return transactions_; }
-    std::vector<Transaction>& transactions() noexcept { return transactions_; }
+    const std::pmr::vector<Transaction>& transactions() const noexcept { return transactions_; }
+    std::pmr::vector<Transaction>& transactions() noexcept { return transactions_; }
+    std::pmr::memory_resource* resource() const noexcept { return transactions_.get_allocator().resource(); }
     
     // Header field accessors
     BlockHeight height() const noexcept { return header_.height; }
@@ -61,10 +74,13 @@ public:
     void add_transaction(const Transaction& transaction);
     void remove_transaction(size_t index);
     void clear_transactions();
+    void reserve_transactions(size_t count);
     
     // Block operations
     Hash calculate_hash() const;
     Hash calculate_merkle_root() const;
+    std::optional<MerkleProof> merkle_proof(size_t index) const;
+    std::optional<MerkleMultiProof> merkle_multi_proof(std::vector<size_t> indices) const;
     bool is_genesis() const noexcept;
     bool is_valid() const;
     
@@ -80,16 +96,20 @@ public:
     
     // Utility methods
     std::string to_string() const;
-    std::string to_json() const;
+    std::string to_json(JsonStyle style = JsonStyle::Pretty) const;
+    // Appends the header fields and every transaction as one JSON object
+    void write_json(JsonWriter& writer) const;
 
 private:
+    // Every mutating call leaves merkle_ clean and header_.merkle_root current,
+    // so const members only read and a shared const Block is safe to use from
+    // several threads
     BlockHeader header_;
-    std::vector<Transaction> transactions_;
-    mutable std::optional<Hash> cached_hash_;
+    std::pmr::vector<Transaction> transactions_;
+    MerkleAccumulator merkle_;
     
     // Helper methods
     void update_merkle_root();
-    void invalidate_cache();
     bool validate_gas_limits() const;
 };
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "chainforge/core/error.hpp"
+#include "chainforge/core/random.hpp"
 #include <functional>
 #include <chrono>
 #include <thread>
@@ -100,8 +101,7 @@ auto retry_with_jitter(int max_attempts, std::chrono::milliseconds base_delay,
                       double jitter_factor, F&& func, Args&&... args)
     -> typename std::invoke_result_t<F, Args...> {
     
-    std::random_device rd;
-    std::mt19937 gen(rd());
+    auto& gen = FastRandom::thread_instance();
     std::uniform_real_distribution<> dis(1.0 - jitter_factor, 1.0 + jitter_factor);
     
     for (int attempt = 0; attempt < max_attempts; ++attempt) {
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace chainforge::core {
+
+/**
+ * Open-addressing hash map for fixed-size keys such as Hash and Address
+ *
+ * Entries sit in one flat array with linear probing. A parallel array of
+ * one-byte tags (0 for an empty slot, else 7 bits of the hash) lets most
+ * probes skip the key comparison. Erasing shifts the following entries back
+ * instead of leaving tombstones, so lookups never slow down with churn.
+ *
+ * The hasher's output is multiplied by a 64-bit constant before use. That
+ * way a raw fingerprint like std::hash<Hash> still spreads across slots when
+ * keys share their low bytes.
+ *
+ * Key and Value must be default-constructible and movable. Unlike
+ * std::unordered_map, inserting or erasing invalidates all iterators and
+ * references. A transparent Hasher and KeyEqual (HashKeyHash/HashKeyEqual)
+ * enable lookups by other key types.
+ */
+template <typename Key, typename Value, typename Hasher = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class FlatHashMap {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using size_type = size_t;
+
+    template <bool Const>
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = FlatHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const value_type*, value_type*>;
+        using reference = std::conditional_t<Const, const value_type&, value_type&>;
+        using Map = std::conditional_t<Const, const FlatHashMap, FlatHashMap>;
+
+        Iterator() = default;
+        Iterator(Map* map, size_t slot) : map_(map), slot_(slot) { skip_empty(); }
+        operator Iterator<true>() const { return {map_, slot_}; }
+
+        reference operator*() const { return map_->slots_[slot_]; }
+        pointer operator->() const { return &map_->slots_[slot_]; }
+        Iterator& operator++() {
+            ++slot_;
+            skip_empty();
+            return *this;
+        }
+        Iterator operator++(int) {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+        bool operator==(const Iterator& other) const noexcept { return slot_ == other.slot_; }
+
+    private:
+        friend class FlatHashMap;
+        Map* map_ = nullptr;
+        size_t slot_ = 0;
+
+        void skip_empty() {
+            while (slot_ < map_->tags_.size() && map_->tags_[slot_] == EMPTY) {
+                ++slot_;
+            }
+        }
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    FlatHashMap() = default;
+    explicit FlatHashMap(size_t expected) { reserve(expected); }
+
+    // Capacity
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    size_t capacity() const noexcept { return slots_.size(); }
+
+    // Grow so that `count` entries fit without rehashing
+    void reserve(size_t count) {
+        size_t needed = std::bit_ceil(std::max<size_t>(MIN_CAPACITY, count + count / 3 + 1));
+        if (needed > capacity()) {
+            rehash(needed);
+        }
+    }
+
+    void clear() {
+        for (size_t slot = 0; slot < tags_.size(); ++slot) {
+            if (tags_[slot] != EMPTY) {
+                tags_[slot] = EMPTY;
+                slots_[slot] = value_type{};
+            }
+        }
+        size_ = 0;
+    }
+
+    // Iteration in slot order
+    iterator begin() { return {this, 0}; }
+    iterator end() { return {this, tags_.size()}; }
+    const_iterator begin() const { return {this, 0}; }
+    const_iterator end() const { return {this, tags_.size()}; }
+
+    // Lookup; K is Key or anything the transparent Hasher and KeyEqual accept
+    template <typename K = Key>
+    iterator find(const K& key) {
+        return {this, find_slot(key)};
+    }
+    template <typename K = Key>
+    const_iterator find(const K& key) const {
+        return {this, find_slot(key)};
+    }
+    template <typename K = Key>
+    bool contains(const K& key) const {
+        return find_slot(key) != tags_.size();
+    }
+    template <typename K = Key>
+    size_t count(const K& key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    // Insertion; leaves an existing entry untouched
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        if (size_ + 1 > max_load()) {
+            rehash(std::max(MIN_CAPACITY, capacity() * 2));
+        }
+
+        uint64_t mixed = mix(key);
+        uint8_t tag = tag_of(mixed);
+        for (size_t slot = home_of(mixed);; slot = (slot + 1) & mask()) {
+            if (tags_[slot] == EMPTY) {
+                tags_[slot] = tag;
+                slots_[slot] = value_type(std::piecewise_construct, std::forward_as_tuple(key),
+                                          std::forward_as_tuple(std::forward<Args>(args)...));
+                ++size_;
+                return {iterator(this, slot), true};
+            }
+            if (tags_[slot] == tag && equal_(slots_[slot].first, key)) {
+                return {iterator(this, slot), false};
+            }
+        }
+    }
+
+    std::pair<iterator, bool> insert(const value_type& entry) { return try_emplace(entry.first, entry.second); }
+    std::pair<iterator, bool> insert(value_type&& entry) { return try_emplace(entry.first, std::move(entry.second)); }
+
+    // Insert or overwrite
+    template <typename V>
+    std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value) {
+        auto result = try_emplace(key, std::forward<V>(value));
+        if (!result.second) {
+            result.first->second = std::forward<V>(value);
+        }
+        return result;
+    }
+
+    Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+
+    // Removal by backward shift: later members of the probe run move up to close the gap
+    template <typename K = Key>
+    size_t erase(const K& key) {
+        size_t slot = find_slot(key);
+        if (slot == tags_.size()) {
+            return 0;
+        }
+
+        for (size_t next = (slot + 1) & mask(); tags_[next] != EMPTY; next = (next + 1) & mask()) {
+            // An entry can fill the gap if the gap lies between its home slot and its position
+            size_t home = home_of(mix(slots_[next].first));
+            if (((next - home) & mask()) >= ((next - slot) & mask())) {
+                tags_[slot] = tags_[next];
+                slots_[slot] = std::move(slots_[next]);
+                slot = next;
+            }
+        }
+        tags_[slot] = EMPTY;
+        slots_[slot] = value_type{};
+        --size_;
+        return 1;
+    }
+
+private:
+    static constexpr uint8_t EMPTY = 0;
+    static constexpr size_t MIN_CAPACITY = 16;
+    // Fibonacci hashing constant (2^64 / golden ratio)
+    static constexpr uint64_t MIX_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+    std::vector<uint8_t> tags_;
+    std::vector<value_type> slots_;
+    size_t size_ = 0;
+    int shift_ = 64;
+    [[no_unique_address]] Hasher hasher_;
+    [[no_unique_address]] KeyEqual equal_;
+
+    size_t mask() const noexcept { return slots_.size() - 1; }
+    // Up to 3/4 full, which keeps linear probe runs short
+    size_t max_load() const noexcept { return capacity() - capacity() / 4; }
+
+    template <typename K>
+    uint64_t mix(const K& key) const noexcept {
+        return static_cast<uint64_t>(hasher_(key)) * MIX_MULTIPLIER;
+    }
+    // The top bits of the product pick the slot; tags come from further down so they differ between neighbours
+    size_t home_of(uint64_t mixed) const noexcept { return static_cast<size_t>(mixed >> shift_); }
+    static uint8_t tag_of(uint64_t mixed) noexcept { return static_cast<uint8_t>(0x80 | ((mixed >> 32) & 0x7F)); }
+
+    template <typename K>
+    size_t find_slot(const K& key) const {
+        if (size_ == 0) {
+            return tags_.size();
+        }
+        uint64_t mixed = mix(key);
+        uint8_t tag = tag_of(mixed);
+        for (size_t slot = home_of(mixed);; slot = (slot + 1) & mask()) {
+            if (tags_[slot] == EMPTY) {
+                return tags_.size();
+            }
+            if (tags_[slot] == tag && equal_(slots_[slot].first, key)) {
+                return slot;
+            }
+        }
+    }
+
+    void rehash(size_t new_capacity) {
+        std::vector<uint8_t> old_tags(new_capacity, EMPTY);
+        std::vector<value_type> old_slots(new_capacity);
+        old_tags.swap(tags_);
+        old_slots.swap(slots_);
+        shift_ = 64 - std::countr_zero(new_capacity);
+
+        for (size_t slot = 0; slot < old_tags.size(); ++slot) {
+            if (old_tags[slot] == EMPTY) {
+                continue;
+            }
+            size_t target = home_of(mix(old_slots[slot].first));
+            while (tags_[target] != EMPTY) {
+                target = (target + 1) & mask();
+            }
+            tags_[target] = old_tags[slot];
+            slots_[target] = std::move(old_slots[slot]);
+        }
+    }
+};
+
+} // namespace chainforge::core
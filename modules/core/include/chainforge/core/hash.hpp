@@ -3,7 +3,9 @@
 #include "types.hpp"
 #include <string>
 #include <array>
+#include <cstring>
 #include <vector>
+#include <functional>
 
 namespace chainforge::core {
 
@@ -34,6 +36,8 @@ public:
     
     // Conversion methods
     std::string to_hex() const;
+    // Writes HEX_LENGTH characters without a terminator and returns the end
+    char* to_hex_into(char* out) const noexcept;
     std::vector<uint8_t> to_bytes() const;
     
     // Comparison operators
@@ -48,6 +52,7 @@ public:
     
     // Size information
     static constexpr size_t size() noexcept { return HASH_SIZE; }
+    static constexpr size_t HEX_LENGTH = HASH_SIZE * 2;
 
 private:
     Hash256 data_;
@@ -65,4 +70,39 @@ Hash combine_hashes(const Hash& left, const Hash& right);
 std::string hash_to_hex(const Hash& hash);
 Hash hash_from_hex(const std::string& hex_string);
 
+// Hash values are uniformly random, so their first 8 bytes already make a full-quality fingerprint
+inline uint64_t hash_fingerprint(const Hash256& data) noexcept {
+    uint64_t fingerprint;
+    std::memcpy(&fingerprint, data.data(), sizeof(fingerprint));
+    return fingerprint;
+}
+
+/**
+ * Transparent hasher and equality for containers keyed by Hash
+ *
+ * Lookups can pass a raw Hash256 without wrapping it in a Hash first.
+ */
+struct HashKeyHash {
+    using is_transparent = void;
+    size_t operator()(const Hash& hash) const noexcept { return hash_fingerprint(hash.data()); }
+    size_t operator()(const Hash256& data) const noexcept { return hash_fingerprint(data); }
+};
+
+struct HashKeyEqual {
+    using is_transparent = void;
+    bool operator()(const Hash& lhs, const Hash& rhs) const noexcept { return lhs.data() == rhs.data(); }
+    bool operator()(const Hash& lhs, const Hash256& rhs) const noexcept { return lhs.data() == rhs; }
+    bool operator()(const Hash256& lhs, const Hash& rhs) const noexcept { return lhs == rhs.data(); }
+};
+
 } // namespace chainforge::core
+
+// Hash specialization for std::unordered_map
+namespace std {
+    template<>
+    struct hash<chainforge::core::Hash> {
+        size_t operator()(const chainforge::core::Hash& h) const noexcept {
+            return chainforge::core::hash_fingerprint(h.data());
+        }
+    };
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace chainforge::core {
+
+/**
+ * Hex codec shared by Hash, Address, Amount and the RPC layer
+ *
+ * Encoding writes lowercase digits without a "0x" prefix or terminator.
+ * Decoding accepts either case. Blocks of 16 bytes go through SSE2 when the
+ * target has it; the remainder uses lookup tables.
+ */
+
+// Characters needed to encode any uint64_t with hex_encode_uint_into
+constexpr size_t HEX_UINT64_MAX_DIGITS = 16;
+
+// Write 2 * bytes.size() characters to `out` and return the end of the output
+char* hex_encode_into(std::span<const uint8_t> bytes, char* out) noexcept;
+std::string hex_encode(std::span<const uint8_t> bytes);
+
+// Decode hex.size() / 2 bytes into `out`; false for odd lengths or non-hex characters
+bool hex_decode_into(std::string_view hex, uint8_t* out) noexcept;
+
+// Shortest form of `value` ("0" for zero) and the end of the output
+char* hex_encode_uint_into(uint64_t value, char* out) noexcept;
+
+// Parse 1 to HEX_UINT64_MAX_DIGITS hex digits; false if anything else is present
+bool hex_decode_uint(std::string_view hex, uint64_t& value) noexcept;
+
+} // namespace chainforge::core
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace chainforge::core {
+
+enum class JsonStyle {
+    Compact,  // {"a":1,"b":[2,3]}
+    Pretty    // Two-space indentation, laid out like nlohmann::json::dump(2)
+};
+
+/**
+ * Streaming JSON writer
+ *
+ * Appends straight to a caller-owned std::string without building a
+ * document, so reusing the buffer across responses avoids allocation
+ * entirely. The caller supplies keys in the order they should appear and is
+ * responsible for balanced begin/end calls. Nesting is limited to
+ * MAX_DEPTH levels.
+ */
+class JsonWriter {
+public:
+    static constexpr int MAX_DEPTH = 64;
+
+    explicit JsonWriter(std::string& out, JsonStyle style = JsonStyle::Compact) : out_(out), style_(style) {}
+
+    // Containers
+    JsonWriter& begin_object();
+    JsonWriter& end_object();
+    JsonWriter& begin_array();
+    JsonWriter& end_array();
+
+    // Object member name; the next call writes its value
+    JsonWriter& key(std::string_view name);
+
+    // Scalars
+    JsonWriter& value(std::string_view text);
+    JsonWriter& value(const char* text) { return value(std::string_view(text)); }
+    JsonWriter& value(bool flag);
+    template <std::integral T>
+        requires(!std::same_as<T, bool>)
+    JsonWriter& value(T number) {
+        if constexpr (std::signed_integral<T>) {
+            return write_signed(static_cast<int64_t>(number));
+        } else {
+            return write_unsigned(static_cast<uint64_t>(number));
+        }
+    }
+    JsonWriter& null_value();
+
+    // Bytes as a lowercase hex string, optionally "0x"-prefixed, without a temporary
+    JsonWriter& hex_value(std::span<const uint8_t> bytes, bool prefix = false);
+
+    // key(name) followed by value(field_value)
+    template <typename T>
+    JsonWriter& field(std::string_view name, const T& field_value) {
+        key(name);
+        return value(field_value);
+    }
+
+    std::string& buffer() noexcept { return out_; }
+
+private:
+    std::string& out_;
+    JsonStyle style_;
+    int depth_ = 0;
+    // Bit d is set once the container at depth d has an element
+    uint64_t has_items_ = 0;
+    bool after_key_ = false;
+
+    void before_element();
+    void newline_and_indent();
+    JsonWriter& open(char bracket);
+    JsonWriter& close(char bracket);
+    JsonWriter& write_unsigned(uint64_t number);
+    JsonWriter& write_signed(int64_t number);
+    void write_string(std::string_view text);
+};
+
+} // namespace chainforge::core
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "hash.hpp"
+#include "transaction.hpp"
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace chainforge::core {
+
+// Below this many leaves, hashing them on the calling thread beats handing slices to workers
+constexpr size_t MERKLE_PARALLEL_LEAF_THRESHOLD = 1024;
+
+/**
+ * Merkle root over transaction hashes
+ *
+ * Adjacent nodes are paired with combine_hashes and an odd node at the end
+ * of a level is paired with itself. A single leaf is its own root and an
+ * empty tree has the zero hash. Leaf hashing is split into up to
+ * `max_workers` slices on WorkerPool::shared() (0 means one per pool thread
+ * plus the caller) once there are enough leaves to pay for them. Parents
+ * are hashed in batches through crypto::Hash::hash_pairs.
+ */
+Hash compute_merkle_root(std::span<const Transaction> transactions, size_t max_workers = 0);
+
+// Reduces already hashed leaves to their root, reusing the leaf buffer for every level
+Hash compute_merkle_root(std::vector<Hash> leaves);
+// Same, overwriting `leaves` in place
+Hash compute_merkle_root(std::span<Hash> leaves);
+
+// Transaction hashes in order, spread across workers the same way as compute_merkle_root
+std::vector<Hash> compute_merkle_leaves(std::span<const Transaction> transactions, size_t max_workers = 0);
+// Same, written into `leaves`, which must hold one hash per transaction
+void compute_merkle_leaves(std::span<const Transaction> transactions, std::span<Hash> leaves, size_t max_workers = 0);
+
+/**
+ * Inclusion proof for one leaf
+ *
+ * `siblings` runs from the leaf level upwards. A level where the node is
+ * the odd last one is paired with itself and contributes no sibling, which
+ * is why the verifier also needs the leaf count.
+ *
+ * Pairing the odd node with itself means [a, b, c] and [a, b, c, c] share a
+ * root (CVE-2012-2459), so a leaf count is not bound by the root. Equal
+ * siblings only arise from a duplicated transaction, which
+ * Block::validate_transactions rejects, so the verifiers reject any proof
+ * that pairs a node with an equal sibling. That closes the forged
+ * "c at index 3 of 4" proof against the [a, b, c] root.
+ */
+struct MerkleProof {
+    size_t index = 0;
+    size_t leaf_count = 0;
+    std::vector<Hash> siblings;
+};
+
+/**
+ * Inclusion proof for several leaves of the same tree
+ *
+ * Siblings that another proven node already provides, and nodes shared by
+ * several paths, are sent once. `indices` is sorted and unique; siblings
+ * are ordered level by level and left to right within a level.
+ */
+struct MerkleMultiProof {
+    std::vector<size_t> indices;
+    size_t leaf_count = 0;
+    std::vector<Hash> siblings;
+};
+
+// True when `leaf` at proof.index hashes up to `root`
+bool verify_merkle_proof(const Hash& root, const Hash& leaf, const MerkleProof& proof);
+
+// `leaves` are the proven leaf hashes in proof.indices order
+bool verify_merkle_multiproof(const Hash& root, std::span<const Hash> leaves, const MerkleMultiProof& proof);
+
+/**
+ * Persistent Merkle tree with the same shape as compute_merkle_root
+ *
+ * Every level is kept, so appending a leaf only rehashes the right edge.
+ * Erasing a leaf shifts everything after it; the nodes above that suffix
+ * are marked dirty and recomputed on the next call to root(). All levels
+ * are allocated from the memory resource given at construction.
+ */
+class MerkleAccumulator {
+public:
+    explicit MerkleAccumulator(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : levels_(1, resource) {}
+
+    // Add a leaf at the end: O(log n) while the tree is clean
+    void append(const Hash& leaf);
+
+    // Remove the leaf at `index` and defer rehashing everything after it
+    void erase(size_t index);
+
+    // Replace every leaf; the whole tree is recomputed lazily
+    void assign(std::span<const Hash> leaves);
+    // Resize to `leaf_count` leaves for the caller to fill in through the returned span
+    std::span<Hash> assign(size_t leaf_count);
+    void clear();
+
+    // Root of the current leaves, flushing any deferred work first
+    Hash root();
+
+    // Proofs read sibling nodes straight from the stored levels; empty for out-of-range indices
+    // and while the tree is dirty, so call root() after erasing
+    std::optional<MerkleProof> proof(size_t index) const;
+    std::optional<MerkleMultiProof> multi_proof(std::vector<size_t> indices) const;
+
+    size_t size() const noexcept { return levels_.front().size(); }
+    std::pmr::memory_resource* resource() const noexcept { return levels_.get_allocator().resource(); }
+    bool dirty() const noexcept { return dirty_from_ != SIZE_MAX; }
+
+private:
+    // levels_[0] holds the leaves and levels_.back() the root
+    std::pmr::vector<std::pmr::vector<Hash>> levels_;
+    // First leaf whose ancestors are stale; SIZE_MAX when the tree is clean
+    size_t dirty_from_ = SIZE_MAX;
+
+    void rebuild_from(size_t leaf_index);
+};
+
+} // namespace chainforge::core
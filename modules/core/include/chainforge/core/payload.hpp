@@ -0,0 +1,100 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory_resource>
+#include <span>
+#include <vector>
+
+namespace chainforge::core {
+
+/**
+ * Immutable transaction payload with small-buffer storage
+ *
+ * Payloads up to INLINE_CAPACITY bytes live inside the object, so plain
+ * transfers and short calls never allocate. Larger payloads sit in one
+ * reference-counted block drawn from a std::pmr::memory_resource; the bytes
+ * are never modified in place, only replaced.
+ *
+ * Plain copies share blocks from the global heap. A block from any other
+ * resource (such as a per-block arena) may not outlive it, so plain copies
+ * of those are made on the default resource instead; the resource-taking
+ * overloads copy into the given resource unless the block already lives there.
+ */
+class Payload {
+public:
+    // Fills the object out to 64 bytes together with the 4-byte size
+    static constexpr size_t INLINE_CAPACITY = 60;
+
+    // Constructors
+    Payload() noexcept : size_(0) {}
+    Payload(const uint8_t* bytes, size_t size, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+    Payload(std::span<const uint8_t> bytes) : Payload(bytes.data(), bytes.size()) {}
+    Payload(const std::vector<uint8_t>& bytes) : Payload(bytes.data(), bytes.size()) {}
+    Payload(std::initializer_list<uint8_t> bytes) : Payload(bytes.begin(), bytes.size()) {}
+
+    // Copy and move: the whole inline buffer is copied as one fixed-size block
+    Payload(const Payload& other) : storage_(other.storage_), size_(other.size_) {
+        if (!is_inline()) {
+            copy_heap(other, nullptr);
+        }
+    }
+    Payload(Payload&& other) noexcept : storage_(other.storage_), size_(other.size_) { other.size_ = 0; }
+    Payload(const Payload& other, std::pmr::memory_resource* resource) : storage_(other.storage_), size_(other.size_) {
+        if (!is_inline()) {
+            copy_heap(other, resource);
+        }
+    }
+    Payload(Payload&& other, std::pmr::memory_resource* resource);
+    Payload& operator=(const Payload& other);
+    Payload& operator=(Payload&& other) noexcept;
+
+    // Destructor
+    ~Payload() { release(); }
+
+    // Replace the contents
+    void assign(const uint8_t* first, const uint8_t* last) { *this = Payload(first, static_cast<size_t>(last - first)); }
+
+    // Accessors
+    size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    const uint8_t* data() const noexcept;
+    const uint8_t* begin() const noexcept { return data(); }
+    const uint8_t* end() const noexcept { return data() + size_; }
+    uint8_t operator[](size_t index) const noexcept { return data()[index]; }
+    operator std::span<const uint8_t>() const noexcept { return {data(), size_}; }
+    std::vector<uint8_t> to_vector() const { return {begin(), end()}; }
+
+    // Storage information
+    bool is_inline() const noexcept { return size_ <= INLINE_CAPACITY; }
+    size_t heap_bytes() const noexcept;
+    // Resource holding the bytes; nullptr while they are inline
+    std::pmr::memory_resource* resource() const noexcept;
+
+    friend bool operator==(const Payload& lhs, const Payload& rhs) noexcept;
+    friend bool operator==(const Payload& lhs, const std::vector<uint8_t>& rhs) noexcept;
+
+private:
+    struct HeapBlock;
+
+    // Inline bytes, or a HeapBlock* in the first pointer-sized bytes once size_ > INLINE_CAPACITY.
+    // Left byte-aligned so the object stays at 64 bytes; the pointer is only read through memcpy.
+    std::array<uint8_t, INLINE_CAPACITY> storage_;
+    uint32_t size_;
+
+    HeapBlock* heap() const noexcept;
+    void set_heap(HeapBlock* block) noexcept;
+    void copy_heap(const Payload& other, std::pmr::memory_resource* resource);
+    void release() noexcept {
+        if (!is_inline()) {
+            release_heap();
+        }
+        size_ = 0;
+    }
+    void release_heap() noexcept;
+};
+
+} // namespace chainforge::core
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace chainforge::core {
+
+/**
+ * Fast non-cryptographic random number generator (xoshiro256**)
+ *
+ * Intended for identifiers in tests, fuzzers and load generators. It must
+ * never produce key material; crypto::Random draws from system entropy for
+ * that. It satisfies UniformRandomBitGenerator, so the <random>
+ * distributions accept it.
+ *
+ * thread_instance() gives each thread its own generator, seeded from
+ * std::random_device on first use. Calling seed() on it makes that thread's
+ * sequence reproducible.
+ */
+class FastRandom {
+public:
+    using result_type = uint64_t;
+
+    explicit FastRandom(uint64_t seed) noexcept { this->seed(seed); }
+
+    // Reset the state from a 64-bit seed (expanded with splitmix64)
+    void seed(uint64_t seed) noexcept;
+
+    static constexpr result_type min() noexcept { return 0; }
+    static constexpr result_type max() noexcept { return UINT64_MAX; }
+
+    result_type operator()() noexcept {
+        const uint64_t result = rotl(state_[1] * 5, 7) * 9;
+        const uint64_t t = state_[1] << 17;
+        state_[2] ^= state_[0];
+        state_[3] ^= state_[1];
+        state_[1] ^= state_[2];
+        state_[0] ^= state_[3];
+        state_[2] ^= t;
+        state_[3] = rotl(state_[3], 45);
+        return result;
+    }
+
+    // Uniform value in [0, bound); bound must be non-zero
+    uint64_t next_below(uint64_t bound) noexcept;
+
+    // Fill a buffer of any length, eight bytes per generator step
+    void fill(uint8_t* out, size_t size) noexcept;
+    void fill(std::span<uint8_t> out) noexcept { fill(out.data(), out.size()); }
+
+    // Generator owned by the calling thread
+    static FastRandom& thread_instance();
+
+private:
+    std::array<uint64_t, 4> state_;
+
+    static constexpr uint64_t rotl(uint64_t x, int k) noexcept { return (x << k) | (x >> (64 - k)); }
+};
+
+} // namespace chainforge::core
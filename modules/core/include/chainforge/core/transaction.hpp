@@ -4,26 +4,36 @@
 #include "hash.hpp"
 #include "address.hpp"
 #include "amount.hpp"
+#include "json_writer.hpp"
 #include <vector>
 #include <memory>
-#include <optional>
+#include <memory_resource>
 
 namespace chainforge::core {
 
 /**
  * Transaction class representing a blockchain transaction
  * Contains transaction data and validation logic
+ *
+ * Allocator-aware: inside a std::pmr container, a payload too large to be
+ * stored inline is copied into the container's memory resource.
  */
 class Transaction {
 public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
     // Constructors
     Transaction() = default;
+    explicit Transaction(const allocator_type&) {}
     Transaction(const Address& from, const Address& to, const Amount& value);
     Transaction(const TransactionData& data);
+    Transaction(const TransactionData& data, const allocator_type& alloc);
     
     // Copy and move
     Transaction(const Transaction&) = default;
     Transaction(Transaction&&) = default;
+    Transaction(const Transaction& other, const allocator_type& alloc);
+    Transaction(Transaction&& other, const allocator_type& alloc);
     Transaction& operator=(const Transaction&) = default;
     Transaction& operator=(Transaction&&) = default;
     
@@ -40,7 +50,7 @@ public:
     Amount value() const noexcept { return Amount::from_wei(data_.value); }
     GasLimit gas_limit() const noexcept { return data_.gas_limit; }
     GasPrice gas_price() const noexcept { return data_.gas_price; }
-    const std::vector<uint8_t>& payload() const noexcept { return data_.data; }
+    const Payload& payload() const noexcept { return data_.data; }
     uint64_t nonce() const noexcept { return data_.nonce; }
     
     // Setters
@@ -49,7 +59,7 @@ public:
     void set_value(const Amount& value);
     void set_gas_limit(GasLimit gas_limit);
     void set_gas_price(GasPrice gas_price);
-    void set_data(const std::vector<uint8_t>& data);
+    void set_data(Payload data);
     void set_nonce(uint64_t nonce);
     
     // Transaction operations
@@ -71,15 +81,15 @@ public:
     
     // Utility methods
     std::string to_string() const;
-    std::string to_json() const;
+    std::string to_json(JsonStyle style = JsonStyle::Pretty) const;
+    // Appends this transaction as one JSON object
+    void write_json(JsonWriter& writer) const;
     std::string to_hex() const;
 
 private:
     TransactionData data_;
-    mutable std::optional<Hash> cached_hash_;
     
     // Helper methods
-    void invalidate_cache();
     bool validate_addresses() const;
     bool validate_nonce() const;
 };
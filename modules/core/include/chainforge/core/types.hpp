@@ -5,6 +5,7 @@
 #include <vector>
 #include <array>
 #include <memory>
+#include "payload.hpp"
 
 namespace chainforge::core {
 
@@ -44,7 +45,7 @@ struct TransactionData {
     uint64_t value;  // Amount in base units (wei)
     GasLimit gas_limit;
     GasPrice gas_price;
-    std::vector<uint8_t> data;
+    Payload data;  // Inline up to Payload::INLINE_CAPACITY bytes
     uint64_t nonce;
 };
 
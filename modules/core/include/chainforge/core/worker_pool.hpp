@@ -0,0 +1,54 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace chainforge::core {
+
+/**
+ * Fixed set of worker threads for splitting one call's work into slices
+ *
+ * run() hands slices out to idle workers and works on them from the calling
+ * thread too, returning once every slice is done. Because the caller always
+ * makes progress on its own, run() may be called from inside a slice and
+ * from several threads at once. Tasks must not throw.
+ *
+ * shared() is started on first use with one worker per extra hardware
+ * thread and lives until exit, so hot paths (Merkle leaf hashing, batch
+ * signature checks) no longer create and join threads on every call.
+ */
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t workers);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    static WorkerPool& shared();
+
+    // Calls task(slice) once for every slice in [0, slices)
+    void run(size_t slices, const std::function<void(size_t)>& task);
+
+    // Background threads, not counting callers of run()
+    size_t size() const noexcept { return threads_.size(); }
+
+private:
+    struct Batch;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<std::shared_ptr<Batch>> queue_;
+    bool stopping_ = false;
+    std::vector<std::thread> threads_;
+
+    void work_loop();
+};
+
+} // namespace chainforge::core
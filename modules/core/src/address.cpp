@@ -1,7 +1,6 @@
 #include "chainforge/core/address.hpp"
-#include <iomanip>
-#include <sstream>
-#include <random>
+#include "chainforge/core/hex.hpp"
+#include "chainforge/core/random.hpp"
 #include <algorithm>
 
 namespace chainforge::core {
@@ -13,9 +12,8 @@ Address::Address(const std::string& hex_string) {
         throw std::invalid_argument("Invalid hex string length for address");
     }
 
-    for (size_t i = 0; i < ADDRESS_SIZE; ++i) {
-        std::string byte_str = hex_string.substr(i * 2, 2);
-        data_[i] = static_cast<uint8_t>(std::stoi(byte_str, nullptr, 16));
+    if (!hex_decode_into(hex_string, data_.data())) {
+        throw std::invalid_argument("Invalid hex character in address");
     }
 }
 
@@ -27,14 +25,11 @@ Address::Address(const std::vector<uint8_t>& data) {
 }
 
 std::string Address::to_hex() const {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-
-    for (uint8_t byte : data_) {
-        ss << std::setw(2) << static_cast<int>(byte);
-    }
+    return hex_encode(data_);
+}
 
-    return ss.str();
+char* Address::to_hex_into(char* out) const noexcept {
+    return hex_encode_into(data_, out);
 }
 
 std::vector<uint8_t> Address::to_bytes() const {
@@ -74,13 +69,7 @@ Address Address::zero() noexcept {
 
 Address Address::random() {
     Address160 random_data;
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<uint8_t> dis(0, 255);
-
-    for (auto& byte : random_data) {
-        byte = dis(gen);
-    }
+    FastRandom::thread_instance().fill(random_data);
     return Address(random_data);
 }
 
@@ -1,4 +1,5 @@
 #include "chainforge/core/amount.hpp"
+#include "chainforge/core/hex.hpp"
 #include <sstream>
 #include <iomanip>
 #include <cmath>
@@ -51,9 +52,14 @@ std::string Amount::to_string() const {
 }
 
 std::string Amount::to_hex() const {
-    std::stringstream ss;
-    ss << "0x" << std::hex << wei_;
-    return ss.str();
+    char buffer[MAX_HEX_LENGTH];
+    return std::string(buffer, to_hex_into(buffer));
+}
+
+char* Amount::to_hex_into(char* out) const noexcept {
+    *out++ = '0';
+    *out++ = 'x';
+    return hex_encode_uint_into(wei_, out);
 }
 
 double Amount::to_double() const {
@@ -1,38 +1,56 @@
 #include "chainforge/core/block.hpp"
 #include "chainforge/core/transaction.hpp"
+#include "chainforge/core/merkle.hpp"
+#include "chainforge/core/hex.hpp"
+#include "chainforge/crypto/hash.hpp"
+#include "canonical_encoding.hpp"
 #include <sstream>
 #include <algorithm>
-#include <nlohmann/json.hpp>
+#include <unordered_set>
 
 namespace chainforge::core {
 
-Block::Block(BlockHeight height, const Hash& parent_hash, const Timestamp& timestamp)
+Block::Block(std::pmr::memory_resource* resource) : transactions_(resource), merkle_(resource) {}
+
+Block::Block(BlockHeight height, const Hash& parent_hash, const Timestamp& timestamp,
+             std::pmr::memory_resource* resource)
     : header_{height, parent_hash.data(), Hash::zero().data(), timestamp.seconds(), 0, 8000000, 1, 1},
-      transactions_{} {}
+      transactions_(resource), merkle_(resource) {}
 
-Block::Block(const BlockHeader& header, std::vector<Transaction> transactions)
-    : header_(header), transactions_(std::move(transactions)) {
+Block::Block(const BlockHeader& header, std::vector<Transaction> transactions, std::pmr::memory_resource* resource)
+    : header_(header), transactions_(resource), merkle_(resource) {
+    transactions_.reserve(transactions.size());
+    for (auto& tx : transactions) {
+        transactions_.push_back(std::move(tx));
+    }
     update_merkle_root();
 }
 
+Block& Block::operator=(Block&& other) {
+    // Moved transactions would keep payloads in the other block's resource
+    if (resource() != other.resource()) {
+        return *this = other;
+    }
+    header_ = other.header_;
+    transactions_ = std::move(other.transactions_);
+    merkle_ = std::move(other.merkle_);
+    return *this;
+}
+
 void Block::set_height(BlockHeight height) {
     header_.height = height;
-    invalidate_cache();
 }
 
 void Block::set_parent_hash(const Hash& parent_hash) {
     header_.parent_hash = parent_hash.data();
-    invalidate_cache();
 }
 
 void Block::set_timestamp(const Timestamp& timestamp) {
     header_.timestamp = timestamp.seconds();
-    invalidate_cache();
 }
 
 void Block::set_nonce(BlockNonce nonce) {
     header_.nonce = nonce;
-    invalidate_cache();
 }
 
 void Block::set_gas_limit(GasLimit gas_limit) {
@@ -49,109 +67,70 @@ void Block::set_chain_id(ChainId chain_id) {
 
 void Block::add_transaction(const Transaction& transaction) {
     transactions_.push_back(transaction);
-    update_merkle_root();
-    invalidate_cache();
+    if (merkle_.size() + 1 == transactions_.size()) {
+        merkle_.append(transactions_.back().calculate_hash());
+        header_.merkle_root = merkle_.root().data();
+    } else {
+        // transactions() was edited directly; resynchronize from scratch
+        update_merkle_root();
+    }
 }
 
 void Block::remove_transaction(size_t index) {
     if (index < transactions_.size()) {
         transactions_.erase(transactions_.begin() + static_cast<long>(index));
-        update_merkle_root();
-        invalidate_cache();
+        if (merkle_.size() == transactions_.size() + 1) {
+            // Only the nodes above the shifted suffix are rehashed
+            merkle_.erase(index);
+        } else {
+            compute_merkle_leaves(transactions_, merkle_.assign(transactions_.size()));
+        }
+        header_.merkle_root = merkle_.root().data();
     }
 }
 
 void Block::clear_transactions() {
     transactions_.clear();
+    merkle_.clear();
     header_.merkle_root = Hash::zero().data();
-    invalidate_cache();
 }
 
-Hash Block::calculate_hash() const {
-    if (cached_hash_.has_value()) {
-        return cached_hash_.value();
-    }
-
-    // Create a simple hash from block header
-    // TODO: Implement proper block header hashing
-    std::vector<uint8_t> hash_data;
-
-    // Add height (big-endian)
-    for (int i = sizeof(header_.height) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((header_.height >> (i * 8)) & 0xFF));
-    }
-
-    // Add parent hash
-    auto parent_hash_bytes = header_.parent_hash;
-    hash_data.insert(hash_data.end(), parent_hash_bytes.begin(), parent_hash_bytes.end());
-
-    // Add merkle root
-    auto merkle_root_bytes = header_.merkle_root;
-    hash_data.insert(hash_data.end(), merkle_root_bytes.begin(), merkle_root_bytes.end());
-
-    // Add timestamp
-    auto timestamp_seconds = header_.timestamp;
-    for (int i = sizeof(timestamp_seconds) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((timestamp_seconds >> (i * 8)) & 0xFF));
-    }
-
-    // Add nonce
-    for (int i = sizeof(header_.nonce) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((header_.nonce >> (i * 8)) & 0xFF));
-    }
-
-    // Add gas limit and price
-    for (int i = sizeof(header_.gas_limit) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((header_.gas_limit >> (i * 8)) & 0xFF));
-    }
+void Block::reserve_transactions(size_t count) {
+    transactions_.reserve(count);
+}
 
-    for (int i = sizeof(header_.gas_price) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((header_.gas_price >> (i * 8)) & 0xFF));
-    }
+Hash Block::calculate_hash() const {
+    // Two SHA-256 blocks over the encoded header; recomputed rather than cached so that
+    // const calls never write to the block
+    CanonicalEncoder<BLOCK_HEADER_ENCODED_SIZE> encoder;
+    encoder.put_uint(header_.height);
+    encoder.put_bytes(header_.parent_hash);
+    encoder.put_bytes(header_.merkle_root);
+    encoder.put_uint(header_.timestamp);
+    encoder.put_uint(header_.nonce);
+    encoder.put_uint(header_.gas_limit);
+    encoder.put_uint(header_.gas_price);
+    encoder.put_uint(header_.chain_id);
 
-    // Add chain id
-    for (int i = sizeof(header_.chain_id) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((header_.chain_id >> (i * 8)) & 0xFF));
-    }
+    crypto::Sha256Hasher hasher;
+    hasher.update(encoder.data(), encoder.size());
 
-    cached_hash_ = hash_sha256(hash_data);
-    return cached_hash_.value();
+    return Hash(hasher.finalize());
 }
 
 Hash Block::calculate_merkle_root() const {
-    if (transactions_.empty()) {
-        return Hash::zero();
-    }
-
-    if (transactions_.size() == 1) {
-        return transactions_[0].calculate_hash();
-    }
-
-    // Simple binary merkle tree calculation
-    std::vector<Hash> hashes;
-    hashes.reserve(transactions_.size());
-
-    for (const auto& tx : transactions_) {
-        hashes.push_back(tx.calculate_hash());
-    }
-
-    while (hashes.size() > 1) {
-        std::vector<Hash> new_hashes;
-        new_hashes.reserve((hashes.size() + 1) / 2);
-
-        for (size_t i = 0; i < hashes.size(); i += 2) {
-            if (i + 1 < hashes.size()) {
-                new_hashes.push_back(combine_hashes(hashes[i], hashes[i + 1]));
-            } else {
-                // Odd number of hashes, duplicate the last one
-                new_hashes.push_back(combine_hashes(hashes[i], hashes[i]));
-            }
-        }
+    // Scratch leaves come from the block's resource rather than the global heap
+    std::pmr::vector<Hash> leaves(transactions_.size(), resource());
+    compute_merkle_leaves(transactions_, leaves);
+    return compute_merkle_root(std::span<Hash>(leaves));
+}
 
-        hashes = std::move(new_hashes);
-    }
+std::optional<MerkleProof> Block::merkle_proof(size_t index) const {
+    return merkle_.proof(index);
+}
 
-    return hashes[0];
+std::optional<MerkleMultiProof> Block::merkle_multi_proof(std::vector<size_t> indices) const {
+    return merkle_.multi_proof(std::move(indices));
 }
 
 bool Block::is_genesis() const noexcept {
@@ -187,6 +166,15 @@ bool Block::validate_transactions() const {
             return false;
         }
     }
+    // A repeated transaction is how a block is made to share its Merkle root with a shorter one
+    // (CVE-2012-2459)
+    std::unordered_set<Hash, HashKeyHash, HashKeyEqual> seen;
+    seen.reserve(transactions_.size());
+    for (const auto& tx : transactions_) {
+        if (!seen.insert(tx.calculate_hash()).second) {
+            return false;
+        }
+    }
     return validate_gas_limits();
 }
 
@@ -196,12 +184,11 @@ bool Block::validate_size() const {
 
 std::string Block::to_string() const {
     std::stringstream ss;
-    Hash parent_hash(header_.parent_hash);
     Timestamp timestamp(header_.timestamp);
     ss << "Block{"
        << "height: " << header_.height
-       << ", hash: " << calculate_hash().to_hex().substr(0, 16) << "..."
-       << ", parent: " << parent_hash.to_hex().substr(0, 16) << "..."
+       << ", hash: " << hex_encode(std::span(calculate_hash().data()).first(8)) << "..."
+       << ", parent: " << hex_encode(std::span(header_.parent_hash).first(8)) << "..."
        << ", transactions: " << transactions_.size()
        << ", timestamp: " << timestamp.seconds()
        << ", gas_limit: " << header_.gas_limit
@@ -209,36 +196,39 @@ std::string Block::to_string() const {
     return ss.str();
 }
 
-std::string Block::to_json() const {
-    nlohmann::json j;
-    Hash parent_hash(header_.parent_hash);
-    Hash merkle_root(header_.merkle_root);
-    Timestamp timestamp(header_.timestamp);
-    j["height"] = header_.height;
-    j["hash"] = calculate_hash().to_hex();
-    j["parentHash"] = parent_hash.to_hex();
-    j["merkleRoot"] = merkle_root.to_hex();
-    j["timestamp"] = timestamp.seconds();
-    j["nonce"] = header_.nonce;
-    j["gasLimit"] = header_.gas_limit;
-    j["gasPrice"] = header_.gas_price;
-    j["chainId"] = header_.chain_id;
-
-    nlohmann::json txs = nlohmann::json::array();
+std::string Block::to_json(JsonStyle style) const {
+    std::string out;
+    // Roughly what each transaction object takes in pretty form
+    out.reserve(512 + transactions_.size() * 420);
+    JsonWriter writer(out, style);
+    write_json(writer);
+    return out;
+}
+
+void Block::write_json(JsonWriter& writer) const {
+    // Sorted keys, matching the layout clients already parse
+    Hash hash = calculate_hash();
+    writer.begin_object();
+    writer.field("chainId", header_.chain_id);
+    writer.field("gasLimit", header_.gas_limit);
+    writer.field("gasPrice", header_.gas_price);
+    writer.key("hash").hex_value(hash.data());
+    writer.field("height", header_.height);
+    writer.key("merkleRoot").hex_value(header_.merkle_root);
+    writer.field("nonce", header_.nonce);
+    writer.key("parentHash").hex_value(header_.parent_hash);
+    writer.field("timestamp", Timestamp(header_.timestamp).seconds());
+    writer.key("transactions").begin_array();
     for (const auto& tx : transactions_) {
-        txs.push_back(nlohmann::json::parse(tx.to_json()));
+        tx.write_json(writer);
     }
-    j["transactions"] = txs;
-
-    return j.dump(2);
+    writer.end_array();
+    writer.end_object();
 }
 
 void Block::update_merkle_root() {
-    header_.merkle_root = calculate_merkle_root().data();
-}
-
-void Block::invalidate_cache() {
-    cached_hash_.reset();
+    compute_merkle_leaves(transactions_, merkle_.assign(transactions_.size()));
+    header_.merkle_root = merkle_.root().data();
 }
 
 bool Block::validate_gas_limits() const {
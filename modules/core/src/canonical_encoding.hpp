@@ -0,0 +1,52 @@
+#pragma once
+
+#include "chainforge/core/types.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace chainforge::core {
+
+/**
+ * Fixed-layout canonical encoder
+ *
+ * Writes big-endian integers and raw byte arrays into a stack buffer whose
+ * capacity is known at compile time, so encoding never touches the heap.
+ */
+template <size_t Capacity>
+class CanonicalEncoder {
+public:
+    template <typename T>
+        requires std::is_unsigned_v<T>
+    void put_uint(T value) noexcept {
+        for (size_t i = 0; i < sizeof(T); ++i) {
+            buffer_[size_ + i] = static_cast<uint8_t>(value >> ((sizeof(T) - 1 - i) * 8));
+        }
+        size_ += sizeof(T);
+    }
+
+    template <size_t N>
+    void put_bytes(const std::array<uint8_t, N>& bytes) noexcept {
+        std::memcpy(buffer_.data() + size_, bytes.data(), N);
+        size_ += N;
+    }
+
+    const uint8_t* data() const noexcept { return buffer_.data(); }
+    size_t size() const noexcept { return size_; }
+
+private:
+    std::array<uint8_t, Capacity> buffer_;
+    size_t size_ = 0;
+};
+
+// Encoded size of everything in a transaction except its payload
+constexpr size_t TRANSACTION_FIXED_ENCODED_SIZE =
+    2 * ADDRESS_SIZE + sizeof(TransactionData::value) + sizeof(GasLimit) + sizeof(GasPrice) + sizeof(TransactionData::nonce);
+
+// Encoded size of a block header
+constexpr size_t BLOCK_HEADER_ENCODED_SIZE = sizeof(BlockHeight) + 2 * HASH_SIZE + sizeof(BlockHeader::timestamp) +
+                                             sizeof(BlockNonce) + sizeof(GasLimit) + sizeof(GasPrice) + sizeof(ChainId);
+
+} // namespace chainforge::core
@@ -1,12 +1,11 @@
 #include "chainforge/core/hash.hpp"
 #include "chainforge/core/address.hpp"
-#include <iomanip>
-#include <sstream>
-#include <random>
+#include "chainforge/core/hex.hpp"
+#include "chainforge/core/random.hpp"
 #include <algorithm>
 
-// TODO: Include crypto module when available
-// #include "chainforge/crypto/hash.hpp"
+#include "chainforge/crypto/hash.hpp"
+#include "chainforge/crypto/keccak.hpp"
 
 namespace chainforge::core {
 
@@ -17,9 +16,8 @@ Hash::Hash(const std::string& hex_string) {
         throw std::invalid_argument("Invalid hex string length for hash");
     }
 
-    for (size_t i = 0; i < HASH_SIZE; ++i) {
-        std::string byte_str = hex_string.substr(i * 2, 2);
-        data_[i] = static_cast<uint8_t>(std::stoi(byte_str, nullptr, 16));
+    if (!hex_decode_into(hex_string, data_.data())) {
+        throw std::invalid_argument("Invalid hex character in hash");
     }
 }
 
@@ -31,14 +29,11 @@ Hash::Hash(const std::vector<uint8_t>& data) {
 }
 
 std::string Hash::to_hex() const {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    
-    for (uint8_t byte : data_) {
-        ss << std::setw(2) << static_cast<int>(byte);
-    }
-    
-    return ss.str();
+    return hex_encode(data_);
+}
+
+char* Hash::to_hex_into(char* out) const noexcept {
+    return hex_encode_into(data_, out);
 }
 
 std::vector<uint8_t> Hash::to_bytes() const {
@@ -68,33 +63,21 @@ Hash Hash::zero() noexcept {
 
 Hash Hash::random() {
     Hash256 random_data;
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_int_distribution<uint8_t> dis(0, 255);
-    
-    for (auto& byte : random_data) {
-        byte = dis(gen);
-    }
+    FastRandom::thread_instance().fill(random_data);
     return Hash(random_data);
 }
 
 // Free functions
 Hash hash_sha256(const std::vector<uint8_t>& data) {
-    // TODO: Implement actual SHA256 hashing
-    // For now, return a placeholder hash
-    Hash256 hash_data{};
-    auto copy_size = static_cast<ptrdiff_t>(std::min(data.size(), HASH_SIZE));
-    std::copy(data.begin(), data.begin() + copy_size, hash_data.begin());
-    return Hash(hash_data);
+    crypto::Sha256Hasher hasher;
+    hasher.update(data.data(), data.size());
+    return Hash(hasher.finalize());
 }
 
 Hash hash_keccak256(const std::vector<uint8_t>& data) {
-    // TODO: Implement actual Keccak256 hashing
-    // For now, return a placeholder hash
-    Hash256 hash_data{};
-    auto copy_size = static_cast<ptrdiff_t>(std::min(data.size(), HASH_SIZE));
-    std::copy(data.begin(), data.begin() + copy_size, hash_data.begin());
-    return Hash(hash_data);
+    crypto::Keccak::StreamHasher hasher;
+    hasher.update(data.data(), data.size());
+    return Hash(hasher.finalize_256().value);
 }
 
 Hash hash_ripemd160(const std::vector<uint8_t>& data) {
@@ -107,13 +90,11 @@ Hash hash_ripemd160(const std::vector<uint8_t>& data) {
 }
 
 Hash combine_hashes(const Hash& left, const Hash& right) {
-    // Simple combination for now - in practice, this would be more sophisticated
-    Hash256 combined{};
-    for (size_t i = 0; i < HASH_SIZE / 2; ++i) {
-        combined[i] = left.data()[i];
-        combined[i + HASH_SIZE / 2] = right.data()[i];
-    }
-    return Hash(combined);
+    // SHA-256(left || right), the same pairing as crypto::Hash::hash_pair
+    crypto::Sha256Hasher hasher;
+    hasher.update(left.data().data(), HASH_SIZE);
+    hasher.update(right.data().data(), HASH_SIZE);
+    return Hash(hasher.finalize());
 }
 
 std::string hash_to_hex(const Hash& hash) {
@@ -125,30 +106,3 @@ Hash hash_from_hex(const std::string& hex_string) {
 }
 
 } // namespace chainforge::core
-
-// Hash specializations for std::unordered_map
-namespace std {
-    template<>
-    struct hash<chainforge::core::Hash> {
-        size_t operator()(const chainforge::core::Hash& h) const noexcept {
-            // Simple hash based on the first 8 bytes
-            size_t result = 0;
-            for (size_t i = 0; i < 8 && i < h.data().size(); ++i) {
-                result = (result << 8) | h.data()[i];
-            }
-            return result;
-        }
-    };
-    
-    template<>
-    struct hash<chainforge::core::Address> {
-        size_t operator()(const chainforge::core::Address& addr) const noexcept {
-            // Simple hash based on the first 8 bytes
-            size_t result = 0;
-            for (size_t i = 0; i < 8 && i < addr.data().size(); ++i) {
-                result = (result << 8) | addr.data()[i];
-            }
-            return result;
-        }
-    };
-}
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "chainforge/core/hex.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace chainforge::core {
+
+namespace {
+
+constexpr uint8_t INVALID_NIBBLE = 0xFF;
+
+// Two output characters per byte value
+constexpr std::array<char, 512> ENCODE_TABLE = [] {
+    constexpr char digits[] = "0123456789abcdef";
+    std::array<char, 512> table{};
+    for (size_t i = 0; i < 256; ++i) {
+        table[2 * i] = digits[i >> 4];
+        table[2 * i + 1] = digits[i & 0x0F];
+    }
+    return table;
+}();
+
+constexpr std::array<uint8_t, 256> DECODE_TABLE = [] {
+    std::array<uint8_t, 256> table{};
+    table.fill(INVALID_NIBBLE);
+    for (uint8_t i = 0; i < 10; ++i) {
+        table['0' + i] = i;
+    }
+    for (uint8_t i = 0; i < 6; ++i) {
+        table['a' + i] = static_cast<uint8_t>(10 + i);
+        table['A' + i] = static_cast<uint8_t>(10 + i);
+    }
+    return table;
+}();
+
+uint8_t decode_nibble(char c) noexcept {
+    return DECODE_TABLE[static_cast<uint8_t>(c)];
+}
+
+#if defined(__SSE2__)
+// 16 nibbles to their lowercase digits
+__m128i nibbles_to_ascii(__m128i nibbles) {
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+void encode_block(const uint8_t* bytes, char* out) noexcept {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes));
+    __m128i high = _mm_and_si128(_mm_srli_epi16(value, 4), mask);
+    __m128i low = _mm_and_si128(value, mask);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), nibbles_to_ascii(_mm_unpacklo_epi8(high, low)));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), nibbles_to_ascii(_mm_unpackhi_epi8(high, low)));
+}
+
+// 16 characters to 8 bytes, widened to 16-bit lanes; false if any character is not hex
+bool decode_half_block(const char* hex, __m128i& bytes) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex));
+
+    // Unsigned range checks: x <= n exactly when saturating x - n is zero
+    __m128i digit = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    __m128i is_digit = _mm_cmpeq_epi8(_mm_subs_epu8(digit, _mm_set1_epi8(9)), zero);
+    __m128i letter = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i is_letter = _mm_cmpeq_epi8(_mm_subs_epu8(letter, _mm_set1_epi8(5)), zero);
+    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xFFFF) {
+        return false;
+    }
+
+    __m128i nibbles = _mm_or_si128(_mm_and_si128(is_digit, digit),
+                                   _mm_and_si128(is_letter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+    // Each 16-bit lane holds (high nibble, low nibble) in memory order
+    bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0x00FF)), 4),
+                         _mm_srli_epi16(nibbles, 8));
+    return true;
+}
+
+bool decode_block(const char* hex, uint8_t* out) noexcept {
+    __m128i first;
+    __m128i second;
+    if (!decode_half_block(hex, first) || !decode_half_block(hex + 16, second)) {
+        return false;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_packus_epi16(first, second));
+    return true;
+}
+#endif
+
+} // namespace
+
+char* hex_encode_into(std::span<const uint8_t> bytes, char* out) noexcept {
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 16 <= bytes.size(); i += 16, out += 32) {
+        encode_block(bytes.data() + i, out);
+    }
+#endif
+    for (; i < bytes.size(); ++i) {
+        const char* pair = &ENCODE_TABLE[2 * size_t{bytes[i]}];
+        *out++ = pair[0];
+        *out++ = pair[1];
+    }
+    return out;
+}
+
+std::string hex_encode(std::span<const uint8_t> bytes) {
+    std::string result(bytes.size() * 2, '\0');
+    hex_encode_into(bytes, result.data());
+    return result;
+}
+
+bool hex_decode_into(std::string_view hex, uint8_t* out) noexcept {
+    if (hex.size() % 2 != 0) {
+        return false;
+    }
+
+    size_t i = 0;
+#if defined(__SSE2__)
+    for (; i + 32 <= hex.size(); i += 32, out += 16) {
+        if (!decode_block(hex.data() + i, out)) {
+            return false;
+        }
+    }
+#endif
+    for (; i < hex.size(); i += 2) {
+        uint8_t high = decode_nibble(hex[i]);
+        uint8_t low = decode_nibble(hex[i + 1]);
+        if (((high | low) & 0xF0) != 0) {
+            return false;
+        }
+        *out++ = static_cast<uint8_t>((high << 4) | low);
+    }
+    return true;
+}
+
+char* hex_encode_uint_into(uint64_t value, char* out) noexcept {
+    size_t digits = std::max<size_t>(1, (static_cast<size_t>(std::bit_width(value)) + 3) / 4);
+    for (size_t i = digits; i > 0; --i, value >>= 4) {
+        out[i - 1] = ENCODE_TABLE[2 * (value & 0x0F) + 1];
+    }
+    return out + digits;
+}
+
+bool hex_decode_uint(std::string_view hex, uint64_t& value) noexcept {
+    if (hex.empty() || hex.size() > HEX_UINT64_MAX_DIGITS) {
+        return false;
+    }
+
+    uint64_t result = 0;
+    for (char c : hex) {
+        uint8_t nibble = decode_nibble(c);
+        if (nibble == INVALID_NIBBLE) {
+            return false;
+        }
+        result = (result << 4) | nibble;
+    }
+    value = result;
+    return true;
+}
+
+} // namespace chainforge::core
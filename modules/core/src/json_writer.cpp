@@ -0,0 +1,165 @@
+#include "chainforge/core/json_writer.hpp"
+#include "chainforge/core/hex.hpp"
+#include <charconv>
+#include <stdexcept>
+
+namespace chainforge::core {
+
+namespace {
+
+// Characters that cannot appear raw inside a JSON string
+bool needs_escape(char c) noexcept {
+    return static_cast<unsigned char>(c) < 0x20 || c == '"' || c == '\\';
+}
+
+} // namespace
+
+JsonWriter& JsonWriter::begin_object() {
+    return open('{');
+}
+
+JsonWriter& JsonWriter::end_object() {
+    return close('}');
+}
+
+JsonWriter& JsonWriter::begin_array() {
+    return open('[');
+}
+
+JsonWriter& JsonWriter::end_array() {
+    return close(']');
+}
+
+JsonWriter& JsonWriter::key(std::string_view name) {
+    before_element();
+    write_string(name);
+    out_ += style_ == JsonStyle::Pretty ? ": " : ":";
+    after_key_ = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(std::string_view text) {
+    before_element();
+    write_string(text);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool flag) {
+    before_element();
+    out_ += flag ? "true" : "false";
+    return *this;
+}
+
+JsonWriter& JsonWriter::null_value() {
+    before_element();
+    out_ += "null";
+    return *this;
+}
+
+JsonWriter& JsonWriter::hex_value(std::span<const uint8_t> bytes, bool prefix) {
+    before_element();
+    size_t start = out_.size();
+    out_.resize(start + 2 + (prefix ? 2 : 0) + bytes.size() * 2);
+    char* cursor = out_.data() + start;
+    *cursor++ = '"';
+    if (prefix) {
+        *cursor++ = '0';
+        *cursor++ = 'x';
+    }
+    cursor = hex_encode_into(bytes, cursor);
+    *cursor = '"';
+    return *this;
+}
+
+void JsonWriter::before_element() {
+    if (after_key_) {
+        after_key_ = false;
+        return;
+    }
+    if (depth_ == 0) {
+        return;
+    }
+    uint64_t bit = uint64_t{1} << (depth_ - 1);
+    if (has_items_ & bit) {
+        out_ += ',';
+    }
+    has_items_ |= bit;
+    newline_and_indent();
+}
+
+void JsonWriter::newline_and_indent() {
+    if (style_ == JsonStyle::Pretty) {
+        out_ += '\n';
+        out_.append(static_cast<size_t>(depth_) * 2, ' ');
+    }
+}
+
+JsonWriter& JsonWriter::open(char bracket) {
+    if (depth_ == MAX_DEPTH) {
+        throw std::length_error("JSON nesting too deep");
+    }
+    before_element();
+    out_ += bracket;
+    has_items_ &= ~(uint64_t{1} << depth_);
+    ++depth_;
+    return *this;
+}
+
+JsonWriter& JsonWriter::close(char bracket) {
+    --depth_;
+    // Empty containers stay on one line
+    if (has_items_ & (uint64_t{1} << depth_)) {
+        newline_and_indent();
+    }
+    out_ += bracket;
+    return *this;
+}
+
+JsonWriter& JsonWriter::write_unsigned(uint64_t number) {
+    before_element();
+    char digits[20];
+    auto result = std::to_chars(digits, digits + sizeof(digits), number);
+    out_.append(digits, result.ptr);
+    return *this;
+}
+
+JsonWriter& JsonWriter::write_signed(int64_t number) {
+    before_element();
+    char digits[20];
+    auto result = std::to_chars(digits, digits + sizeof(digits), number);
+    out_.append(digits, result.ptr);
+    return *this;
+}
+
+void JsonWriter::write_string(std::string_view text) {
+    out_ += '"';
+    // Copy unescaped runs in one append
+    size_t run_start = 0;
+    for (size_t i = 0; i < text.size(); ++i) {
+        char c = text[i];
+        if (!needs_escape(c)) {
+            continue;
+        }
+        out_.append(text.data() + run_start, i - run_start);
+        run_start = i + 1;
+        switch (c) {
+        case '"': out_ += "\\\""; break;
+        case '\\': out_ += "\\\\"; break;
+        case '\b': out_ += "\\b"; break;
+        case '\f': out_ += "\\f"; break;
+        case '\n': out_ += "\\n"; break;
+        case '\r': out_ += "\\r"; break;
+        case '\t': out_ += "\\t"; break;
+        default: {
+            static constexpr char digits[] = "0123456789abcdef";
+            auto code = static_cast<unsigned char>(c);
+            char escape[] = {'\\', 'u', '0', '0', digits[code >> 4], digits[code & 0x0F]};
+            out_.append(escape, sizeof(escape));
+        }
+        }
+    }
+    out_.append(text.data() + run_start, text.size() - run_start);
+    out_ += '"';
+}
+
+} // namespace chainforge::core
@@ -0,0 +1,282 @@
+#include "chainforge/core/merkle.hpp"
+#include "chainforge/core/worker_pool.hpp"
+#include "chainforge/crypto/hash.hpp"
+#include <algorithm>
+
+namespace chainforge::core {
+
+namespace {
+
+// Parents hashed per call into the batched pair kernel
+constexpr size_t MERKLE_PAIR_CHUNK = 64;
+
+Hash merkle_parent(const std::pmr::vector<Hash>& level, size_t parent) {
+    const Hash& left = level[2 * parent];
+    return combine_hashes(left, 2 * parent + 1 < level.size() ? level[2 * parent + 1] : left);
+}
+
+// Parents [first, last) of a level `width` nodes wide, written to out[first, last) through the
+// batched pair kernel. `out` may be `level` itself: each chunk's children sit at or beyond its
+// own slots and are all read before the chunk is written back.
+void hash_parents(const Hash* level, size_t width, size_t first, size_t last, Hash* out) {
+    const Hash256* left[MERKLE_PAIR_CHUNK];
+    const Hash256* right[MERKLE_PAIR_CHUNK];
+    Hash256 parents[MERKLE_PAIR_CHUNK];
+    for (; first < last; first += MERKLE_PAIR_CHUNK) {
+        size_t count = std::min(MERKLE_PAIR_CHUNK, last - first);
+        for (size_t k = 0; k < count; ++k) {
+            size_t child = 2 * (first + k);
+            left[k] = &level[child].data();
+            right[k] = child + 1 < width ? &level[child + 1].data() : left[k];
+        }
+        crypto::Hash::hash_pairs(left, right, count, parents);
+        for (size_t k = 0; k < count; ++k) {
+            out[first + k] = Hash(parents[k]);
+        }
+    }
+}
+
+void hash_leaves(std::span<const Transaction> transactions, std::span<Hash> leaves) {
+    for (size_t i = 0; i < transactions.size(); ++i) {
+        leaves[i] = transactions[i].calculate_hash();
+    }
+}
+
+size_t leaf_workers(size_t leaf_count, size_t max_workers) {
+    if (max_workers == 0) {
+        max_workers = WorkerPool::shared().size() + 1;
+    }
+    return std::clamp<size_t>(leaf_count / MERKLE_PARALLEL_LEAF_THRESHOLD, 1, max_workers);
+}
+
+} // namespace
+
+Hash compute_merkle_root(std::span<const Transaction> transactions, size_t max_workers) {
+    return compute_merkle_root(compute_merkle_leaves(transactions, max_workers));
+}
+
+std::vector<Hash> compute_merkle_leaves(std::span<const Transaction> transactions, size_t max_workers) {
+    std::vector<Hash> leaves(transactions.size());
+    compute_merkle_leaves(transactions, leaves, max_workers);
+    return leaves;
+}
+
+void compute_merkle_leaves(std::span<const Transaction> transactions, std::span<Hash> leaves, size_t max_workers) {
+    // Each slice hashes one contiguous run of leaves on the shared pool
+    const size_t slices = leaf_workers(transactions.size(), max_workers);
+    if (slices == 1) {
+        hash_leaves(transactions, leaves);
+        return;
+    }
+    const size_t chunk = (transactions.size() + slices - 1) / slices;
+    WorkerPool::shared().run(slices, [&](size_t slice) {
+        size_t begin = std::min(slice * chunk, transactions.size());
+        size_t count = std::min(chunk, transactions.size() - begin);
+        hash_leaves(transactions.subspan(begin, count), leaves.subspan(begin, count));
+    });
+}
+
+Hash compute_merkle_root(std::vector<Hash> leaves) {
+    return compute_merkle_root(std::span<Hash>(leaves));
+}
+
+Hash compute_merkle_root(std::span<Hash> leaves) {
+    if (leaves.empty()) {
+        return Hash::zero();
+    }
+
+    // Parent i only reads children 2i and 2i + 1, so each level overwrites the front of the buffer
+    size_t width = leaves.size();
+    while (width > 1) {
+        size_t parents = (width + 1) / 2;
+        hash_parents(leaves.data(), width, 0, parents, leaves.data());
+        width = parents;
+    }
+
+    return leaves[0];
+}
+
+bool verify_merkle_proof(const Hash& root, const Hash& leaf, const MerkleProof& proof) {
+    if (proof.index >= proof.leaf_count) {
+        return false;
+    }
+
+    Hash node = leaf;
+    size_t index = proof.index;
+    size_t consumed = 0;
+    for (size_t width = proof.leaf_count; width > 1; width = (width + 1) / 2, index /= 2) {
+        if (index % 2 == 1) {
+            if (consumed == proof.siblings.size() || proof.siblings[consumed] == node) {
+                return false;
+            }
+            node = combine_hashes(proof.siblings[consumed++], node);
+        } else if (index + 1 < width) {
+            if (consumed == proof.siblings.size() || proof.siblings[consumed] == node) {
+                return false;
+            }
+            node = combine_hashes(node, proof.siblings[consumed++]);
+        } else {
+            node = combine_hashes(node, node);
+        }
+    }
+    return consumed == proof.siblings.size() && node == root;
+}
+
+bool verify_merkle_multiproof(const Hash& root, std::span<const Hash> leaves, const MerkleMultiProof& proof) {
+    const auto& indices = proof.indices;
+    if (indices.empty() || indices.size() != leaves.size() || indices.back() >= proof.leaf_count ||
+        !std::is_sorted(indices.begin(), indices.end()) ||
+        std::adjacent_find(indices.begin(), indices.end()) != indices.end()) {
+        return false;
+    }
+
+    // (position, hash) of every node known at the current level, left to right
+    std::vector<std::pair<size_t, Hash>> known;
+    known.reserve(indices.size());
+    for (size_t k = 0; k < indices.size(); ++k) {
+        known.emplace_back(indices[k], leaves[k]);
+    }
+
+    size_t consumed = 0;
+    for (size_t width = proof.leaf_count; width > 1; width = (width + 1) / 2) {
+        std::vector<std::pair<size_t, Hash>> parents;
+        parents.reserve(known.size());
+        for (size_t k = 0; k < known.size(); ++k) {
+            auto [position, node] = known[k];
+            Hash parent;
+            if (position % 2 == 0 && position + 1 >= width) {
+                parent = combine_hashes(node, node);
+            } else if (position % 2 == 0 && k + 1 < known.size() && known[k + 1].first == position + 1) {
+                if (known[k + 1].second == node) {
+                    return false;
+                }
+                parent = combine_hashes(node, known[++k].second);
+            } else if (consumed == proof.siblings.size() || proof.siblings[consumed] == node) {
+                return false;
+            } else if (position % 2 == 0) {
+                parent = combine_hashes(node, proof.siblings[consumed++]);
+            } else {
+                parent = combine_hashes(proof.siblings[consumed++], node);
+            }
+            parents.emplace_back(position / 2, parent);
+        }
+        known = std::move(parents);
+    }
+    return consumed == proof.siblings.size() && known.front().second == root;
+}
+
+void MerkleAccumulator::append(const Hash& leaf) {
+    levels_.front().push_back(leaf);
+    if (dirty()) {
+        return;
+    }
+
+    // Only the last node of each level has a new child
+    size_t index = size() - 1;
+    for (size_t level = 0; levels_[level].size() > 1; ++level) {
+        if (level + 1 == levels_.size()) {
+            levels_.emplace_back();
+        }
+        size_t parent = index / 2;
+        levels_[level + 1].resize((levels_[level].size() + 1) / 2);
+        levels_[level + 1][parent] = merkle_parent(levels_[level], parent);
+        index = parent;
+    }
+}
+
+void MerkleAccumulator::erase(size_t index) {
+    auto& leaves = levels_.front();
+    if (index >= leaves.size()) {
+        return;
+    }
+    leaves.erase(leaves.begin() + static_cast<std::ptrdiff_t>(index));
+    dirty_from_ = std::min(dirty_from_, index);
+}
+
+void MerkleAccumulator::assign(std::span<const Hash> leaves) {
+    auto slots = assign(leaves.size());
+    std::copy(leaves.begin(), leaves.end(), slots.begin());
+}
+
+std::span<Hash> MerkleAccumulator::assign(size_t leaf_count) {
+    levels_.resize(1);
+    levels_.front().resize(leaf_count);
+    dirty_from_ = 0;
+    return levels_.front();
+}
+
+void MerkleAccumulator::clear() {
+    levels_.resize(1);
+    levels_.front().clear();
+    dirty_from_ = SIZE_MAX;
+}
+
+Hash MerkleAccumulator::root() {
+    if (dirty_from_ != SIZE_MAX) {
+        rebuild_from(dirty_from_);
+        dirty_from_ = SIZE_MAX;
+    }
+    return levels_.front().empty() ? Hash::zero() : levels_.back().front();
+}
+
+std::optional<MerkleProof> MerkleAccumulator::proof(size_t index) const {
+    if (index >= size() || dirty()) {
+        return std::nullopt;
+    }
+
+    MerkleProof result{index, size(), {}};
+    for (size_t level = 0; level + 1 < levels_.size(); ++level, index /= 2) {
+        size_t sibling = index ^ 1;
+        if (sibling < levels_[level].size()) {
+            result.siblings.push_back(levels_[level][sibling]);
+        }
+    }
+    return result;
+}
+
+std::optional<MerkleMultiProof> MerkleAccumulator::multi_proof(std::vector<size_t> indices) const {
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    if (indices.empty() || indices.back() >= size() || dirty()) {
+        return std::nullopt;
+    }
+
+    MerkleMultiProof result{indices, size(), {}};
+    std::vector<size_t> known = std::move(indices);
+    for (size_t level = 0; level + 1 < levels_.size(); ++level) {
+        const auto& nodes = levels_[level];
+        for (size_t k = 0; k < known.size(); ++k) {
+            size_t sibling = known[k] ^ 1;
+            if (sibling >= nodes.size()) {
+                continue;
+            }
+            // A proven right neighbour makes the pair self-contained
+            if (sibling == known[k] + 1 && k + 1 < known.size() && known[k + 1] == sibling) {
+                ++k;
+                continue;
+            }
+            result.siblings.push_back(nodes[sibling]);
+        }
+        for (auto& node : known) {
+            node /= 2;
+        }
+        known.erase(std::unique(known.begin(), known.end()), known.end());
+    }
+    return result;
+}
+
+void MerkleAccumulator::rebuild_from(size_t leaf_index) {
+    // Nodes left of the dirty suffix still have their old children
+    size_t level = 0;
+    for (size_t first = leaf_index; levels_[level].size() > 1; ++level, first /= 2) {
+        if (level + 1 == levels_.size()) {
+            levels_.emplace_back();
+        }
+        size_t parents = (levels_[level].size() + 1) / 2;
+        levels_[level + 1].resize(parents);
+        hash_parents(levels_[level].data(), levels_[level].size(), first / 2, parents, levels_[level + 1].data());
+    }
+    levels_.resize(level + 1);
+}
+
+} // namespace chainforge::core
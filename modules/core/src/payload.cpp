@@ -0,0 +1,118 @@
+#include "chainforge/core/payload.hpp"
+#include <atomic>
+#include <limits>
+#include <new>
+#include <stdexcept>
+
+namespace chainforge::core {
+
+// Reference count and owning resource; the payload bytes follow in the same allocation
+struct Payload::HeapBlock {
+    std::atomic<uint32_t> references{1};
+    std::pmr::memory_resource* resource;
+
+    explicit HeapBlock(std::pmr::memory_resource* owner) : resource(owner) {}
+
+    uint8_t* bytes() noexcept { return reinterpret_cast<uint8_t*>(this + 1); }
+
+    static HeapBlock* create(const uint8_t* bytes, size_t size, std::pmr::memory_resource* resource) {
+        void* memory = resource->allocate(sizeof(HeapBlock) + size, alignof(HeapBlock));
+        auto* block = new (memory) HeapBlock(resource);
+        std::memcpy(block->bytes(), bytes, size);
+        return block;
+    }
+};
+
+Payload::Payload(const uint8_t* bytes, size_t size, std::pmr::memory_resource* resource) : size_(0) {
+    if (size > std::numeric_limits<uint32_t>::max()) {
+        throw std::length_error("Payload too large");
+    }
+    if (size <= INLINE_CAPACITY) {
+        if (size > 0) {
+            std::memcpy(storage_.data(), bytes, size);
+        }
+    } else {
+        set_heap(HeapBlock::create(bytes, size, resource));
+    }
+    size_ = static_cast<uint32_t>(size);
+}
+
+Payload::Payload(Payload&& other, std::pmr::memory_resource* resource) : storage_(other.storage_), size_(other.size_) {
+    if (!is_inline() && heap()->resource != resource) {
+        set_heap(HeapBlock::create(other.data(), size_, resource));
+        other.release();
+    }
+    other.size_ = 0;
+}
+
+Payload& Payload::operator=(const Payload& other) {
+    if (this != &other) {
+        Payload copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+Payload& Payload::operator=(Payload&& other) noexcept {
+    if (this != &other) {
+        release();
+        storage_ = other.storage_;
+        size_ = other.size_;
+        other.size_ = 0;
+    }
+    return *this;
+}
+
+const uint8_t* Payload::data() const noexcept {
+    return is_inline() ? storage_.data() : heap()->bytes();
+}
+
+size_t Payload::heap_bytes() const noexcept {
+    return is_inline() ? 0 : sizeof(HeapBlock) + size_;
+}
+
+std::pmr::memory_resource* Payload::resource() const noexcept {
+    return is_inline() ? nullptr : heap()->resource;
+}
+
+Payload::HeapBlock* Payload::heap() const noexcept {
+    HeapBlock* block;
+    std::memcpy(&block, storage_.data(), sizeof(block));
+    return block;
+}
+
+void Payload::set_heap(HeapBlock* block) noexcept {
+    std::memcpy(storage_.data(), &block, sizeof(block));
+}
+
+void Payload::copy_heap(const Payload& other, std::pmr::memory_resource* resource) {
+    // storage_ still holds other's block pointer here
+    HeapBlock* block = other.heap();
+    bool shareable = resource ? block->resource == resource : block->resource == std::pmr::new_delete_resource();
+    if (shareable) {
+        block->references.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    size_ = 0;  // stay valid if the allocation throws
+    set_heap(HeapBlock::create(block->bytes(), other.size_, resource ? resource : std::pmr::get_default_resource()));
+    size_ = other.size_;
+}
+
+void Payload::release_heap() noexcept {
+    HeapBlock* block = heap();
+    if (block->references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        std::pmr::memory_resource* resource = block->resource;
+        block->~HeapBlock();
+        resource->deallocate(block, sizeof(HeapBlock) + size_, alignof(HeapBlock));
+    }
+}
+
+bool operator==(const Payload& lhs, const Payload& rhs) noexcept {
+    return lhs.size() == rhs.size() && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+bool operator==(const Payload& lhs, const std::vector<uint8_t>& rhs) noexcept {
+    return lhs.size() == rhs.size() && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+} // namespace chainforge::core
@@ -0,0 +1,52 @@
+#include "chainforge/core/random.hpp"
+#include <cstring>
+#include <random>
+
+namespace chainforge::core {
+
+void FastRandom::seed(uint64_t seed) noexcept {
+    // splitmix64 never yields an all-zero state, which xoshiro cannot leave
+    for (auto& word : state_) {
+        seed += 0x9E3779B97F4A7C15ULL;
+        uint64_t z = seed;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        word = z ^ (z >> 31);
+    }
+}
+
+uint64_t FastRandom::next_below(uint64_t bound) noexcept {
+    // Lemire's multiply-shift; the retry removes the bias for bounds that do not divide 2^64
+    __extension__ using uint128 = unsigned __int128;
+    uint128 product = static_cast<uint128>((*this)()) * bound;
+    auto low = static_cast<uint64_t>(product);
+    if (low < bound) {
+        const uint64_t threshold = (0 - bound) % bound;
+        while (low < threshold) {
+            product = static_cast<uint128>((*this)()) * bound;
+            low = static_cast<uint64_t>(product);
+        }
+    }
+    return static_cast<uint64_t>(product >> 64);
+}
+
+void FastRandom::fill(uint8_t* out, size_t size) noexcept {
+    for (; size >= sizeof(uint64_t); out += sizeof(uint64_t), size -= sizeof(uint64_t)) {
+        uint64_t word = (*this)();
+        std::memcpy(out, &word, sizeof(word));
+    }
+    if (size > 0) {
+        uint64_t word = (*this)();
+        std::memcpy(out, &word, size);
+    }
+}
+
+FastRandom& FastRandom::thread_instance() {
+    thread_local FastRandom instance([] {
+        std::random_device device;
+        return (static_cast<uint64_t>(device()) << 32) | device();
+    }());
+    return instance;
+}
+
+} // namespace chainforge::core
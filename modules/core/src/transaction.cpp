@@ -1,7 +1,8 @@
 #include "chainforge/core/transaction.hpp"
+#include "chainforge/crypto/hash.hpp"
+#include "canonical_encoding.hpp"
 #include <sstream>
 #include <algorithm>
-#include <nlohmann/json.hpp>
 
 namespace chainforge::core {
 
@@ -10,82 +11,60 @@ Transaction::Transaction(const Address& from, const Address& to, const Amount& v
 
 Transaction::Transaction(const TransactionData& data) : data_(data) {}
 
+Transaction::Transaction(const TransactionData& data, const allocator_type& alloc)
+    : data_{data.from, data.to, data.value, data.gas_limit, data.gas_price,
+            Payload(data.data, alloc.resource()), data.nonce} {}
+
+Transaction::Transaction(const Transaction& other, const allocator_type& alloc)
+    : Transaction(other.data_, alloc) {}
+
+Transaction::Transaction(Transaction&& other, const allocator_type& alloc)
+    : data_{other.data_.from, other.data_.to, other.data_.value, other.data_.gas_limit, other.data_.gas_price,
+            Payload(std::move(other.data_.data), alloc.resource()), other.data_.nonce} {}
+
 void Transaction::set_from(const Address& from) {
     data_.from = from.data();
-    invalidate_cache();
 }
 
 void Transaction::set_to(const Address& to) {
     data_.to = to.data();
-    invalidate_cache();
 }
 
 void Transaction::set_value(const Amount& value) {
     data_.value = value.wei();
-    invalidate_cache();
 }
 
 void Transaction::set_gas_limit(GasLimit gas_limit) {
     data_.gas_limit = gas_limit;
-    invalidate_cache();
 }
 
 void Transaction::set_gas_price(GasPrice gas_price) {
     data_.gas_price = gas_price;
-    invalidate_cache();
 }
 
-void Transaction::set_data(const std::vector<uint8_t>& data) {
-    data_.data = data;
-    invalidate_cache();
+void Transaction::set_data(Payload data) {
+    data_.data = std::move(data);
 }
 
 void Transaction::set_nonce(uint64_t nonce) {
     data_.nonce = nonce;
-    invalidate_cache();
 }
 
 Hash Transaction::calculate_hash() const {
-    if (cached_hash_.has_value()) {
-        return cached_hash_.value();
-    }
-
-    // Create a simple hash from transaction data
-    // TODO: Implement proper transaction hashing with RLP encoding
-    std::vector<uint8_t> hash_data;
-
-    // Add addresses
-    auto from_bytes = data_.from;
-    hash_data.insert(hash_data.end(), from_bytes.begin(), from_bytes.end());
+    // Fixed fields go through a stack buffer; the payload is hashed in place
+    CanonicalEncoder<TRANSACTION_FIXED_ENCODED_SIZE> encoder;
+    encoder.put_bytes(data_.from);
+    encoder.put_bytes(data_.to);
+    encoder.put_uint(data_.value);
+    encoder.put_uint(data_.gas_limit);
+    encoder.put_uint(data_.gas_price);
+    encoder.put_uint(data_.nonce);
 
-    auto to_bytes = data_.to;
-    hash_data.insert(hash_data.end(), to_bytes.begin(), to_bytes.end());
+    crypto::Sha256Hasher hasher;
+    hasher.update(encoder.data(), encoder.size());
+    hasher.update(data_.data.data(), data_.data.size());
 
-    // Add value as bytes (big-endian)
-    auto value_wei = data_.value;
-    for (int i = sizeof(value_wei) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((value_wei >> (i * 8)) & 0xFF));
-    }
-
-    // Add gas limit and price
-    for (int i = sizeof(data_.gas_limit) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((data_.gas_limit >> (i * 8)) & 0xFF));
-    }
-
-    for (int i = sizeof(data_.gas_price) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((data_.gas_price >> (i * 8)) & 0xFF));
-    }
-
-    // Add nonce
-    for (int i = sizeof(data_.nonce) - 1; i >= 0; --i) {
-        hash_data.push_back(static_cast<uint8_t>((data_.nonce >> (i * 8)) & 0xFF));
-    }
-
-    // Add data
-    hash_data.insert(hash_data.end(), data_.data.begin(), data_.data.end());
-
-    cached_hash_ = hash_sha256(hash_data);
-    return cached_hash_.value();
+    return Hash(hasher.finalize());
 }
 
 Amount Transaction::calculate_fee() const {
@@ -126,9 +105,7 @@ bool Transaction::validate_amount() const {
 }
 
 size_t Transaction::size() const {
-    size_t size = sizeof(TransactionData);
-    size += data_.data.size();
-    return size;
+    return sizeof(TransactionData) + data_.data.size();
 }
 
 bool Transaction::is_too_large() const {
@@ -152,21 +129,26 @@ std::string Transaction::to_string() const {
     return ss.str();
 }
 
-std::string Transaction::to_json() const {
-    nlohmann::json j;
-    Address from_addr(data_.from);
-    Address to_addr(data_.to);
-    Amount value(data_.value);
-    j["from"] = from_addr.to_hex();
-    j["to"] = to_addr.to_hex();
-    j["value"] = value.to_string();
-    j["gasLimit"] = data_.gas_limit;
-    j["gasPrice"] = data_.gas_price;
-    j["nonce"] = data_.nonce;
-    j["data"] = "0x" + std::string(64, '0'); // Placeholder - 32 bytes of zeros
-    j["hash"] = calculate_hash().to_hex();
+std::string Transaction::to_json(JsonStyle style) const {
+    std::string out;
+    JsonWriter writer(out, style);
+    write_json(writer);
+    return out;
+}
 
-    return j.dump(2);
+void Transaction::write_json(JsonWriter& writer) const {
+    // Keys in alphabetical order, as the former nlohmann::json output had them
+    static constexpr uint8_t placeholder_data[32] = {};  // Placeholder - 32 bytes of zeros
+    writer.begin_object();
+    writer.key("data").hex_value(placeholder_data, true);
+    writer.key("from").hex_value(data_.from);
+    writer.field("gasLimit", data_.gas_limit);
+    writer.field("gasPrice", data_.gas_price);
+    writer.key("hash").hex_value(calculate_hash().data());
+    writer.field("nonce", data_.nonce);
+    writer.key("to").hex_value(data_.to);
+    writer.field("value", Amount(data_.value).to_string());
+    writer.end_object();
 }
 
 std::string Transaction::to_hex() const {
@@ -174,10 +156,6 @@ std::string Transaction::to_hex() const {
     return calculate_hash().to_hex();
 }
 
-void Transaction::invalidate_cache() {
-    cached_hash_.reset();
-}
-
 bool Transaction::validate_addresses() const {
     Address from_addr(data_.from);
     Address to_addr(data_.to);
@@ -0,0 +1,92 @@
+#include "chainforge/core/worker_pool.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace chainforge::core {
+
+struct WorkerPool::Batch {
+    const std::function<void(size_t)>& task;
+    const size_t slices;
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> finished{0};
+    std::mutex mutex;
+    std::condition_variable done;
+
+    Batch(const std::function<void(size_t)>& task_, size_t slices_) : task(task_), slices(slices_) {}
+
+    // Claim and run slices until none are left
+    void work() {
+        for (size_t slice = next.fetch_add(1); slice < slices; slice = next.fetch_add(1)) {
+            task(slice);
+            if (finished.fetch_add(1) + 1 == slices) {
+                std::lock_guard lock(mutex);
+                done.notify_all();
+            }
+        }
+    }
+};
+
+WorkerPool::WorkerPool(size_t workers) {
+    threads_.reserve(workers);
+    for (size_t i = 0; i < workers; ++i) {
+        threads_.emplace_back(&WorkerPool::work_loop, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+}
+
+WorkerPool& WorkerPool::shared() {
+    static WorkerPool pool(std::max<size_t>(1, std::thread::hardware_concurrency()) - 1);
+    return pool;
+}
+
+void WorkerPool::run(size_t slices, const std::function<void(size_t)>& task) {
+    if (slices == 0) {
+        return;
+    }
+
+    auto batch = std::make_shared<Batch>(task, slices);
+    // One queue entry per worker that could usefully join; the caller takes a share itself
+    size_t helpers = std::min(slices - 1, threads_.size());
+    if (helpers > 0) {
+        {
+            std::lock_guard lock(mutex_);
+            queue_.insert(queue_.end(), helpers, batch);
+        }
+        helpers == 1 ? wake_.notify_one() : wake_.notify_all();
+    }
+
+    batch->work();
+
+    // Workers may still be finishing slices they claimed; entries they have not
+    // popped yet keep the batch alive and find nothing left to do
+    std::unique_lock lock(batch->mutex);
+    batch->done.wait(lock, [&] { return batch->finished.load() == slices; });
+}
+
+void WorkerPool::work_loop() {
+    for (;;) {
+        std::shared_ptr<Batch> batch;
+        {
+            std::unique_lock lock(mutex_);
+            wake_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                return;
+            }
+            batch = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        batch->work();
+    }
+}
+
+} // namespace chainforge::core
@@ -0,0 +1,100 @@
+#include "chainforge/crypto/keypair.hpp"
+#include "chainforge/crypto/signature.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+crypto::BlsPrivateKey secret_key(size_t signer) {
+    crypto::BlsPrivateKey key{};
+    key[29] = static_cast<crypto::byte_t>(signer >> 16);
+    key[30] = static_cast<crypto::byte_t>(signer >> 8);
+    key[31] = static_cast<crypto::byte_t>(signer + 1);
+    return key;
+}
+
+struct Committee {
+    crypto::Message attestation;
+    std::vector<crypto::BlsPublicKey> public_keys;
+    std::vector<crypto::BlsSignature> signatures;
+};
+
+Committee make_committee(size_t size) {
+    Committee committee;
+    std::string text = "attestation, committee of " + std::to_string(size);
+    committee.attestation.assign(text.begin(), text.end());
+    for (size_t i = 0; i < size; ++i) {
+        committee.public_keys.push_back(crypto::KeyPair::derive_bls_public_key(secret_key(i)).value);
+        committee.signatures.push_back(crypto::Signature::bls_sign(committee.attestation, secret_key(i)).value);
+    }
+    return committee;
+}
+
+// Best wall time in seconds over rounds calls
+template <typename F>
+double best_of(size_t rounds, F&& run) {
+    double best = 1e18;
+    for (size_t round = 0; round < rounds; ++round) {
+        auto start = Clock::now();
+        run();
+        best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t max_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 512;
+    const size_t rounds = 3;
+
+    size_t failures = 0;
+    std::cout << "=== BLS committee attestation benchmark (best of " << rounds << ") ===" << std::endl;
+    std::cout << "signers\tbls_verify each\taggregate + fast_aggregate_verify\taggregate_verify, distinct messages"
+              << std::endl;
+    for (size_t size = 16; size <= max_size; size *= 2) {
+        Committee committee = make_committee(size);
+
+        double separate = best_of(rounds, [&] {
+            for (size_t i = 0; i < size; ++i) {
+                failures += !crypto::Signature::bls_verify(committee.attestation, committee.signatures[i],
+                                                           committee.public_keys[i]).value;
+            }
+        });
+        double fast = best_of(rounds, [&] {
+            auto aggregate = crypto::Signature::bls_aggregate_signatures(committee.signatures);
+            failures += !crypto::Signature::bls_fast_aggregate_verify(committee.attestation, aggregate.value,
+                                                                      committee.public_keys).value;
+        });
+
+        // Every signer on its own message: one Miller loop each, one final exponentiation
+        std::vector<crypto::Message> messages(size);
+        std::vector<crypto::BlsSignature> signatures(size);
+        for (size_t i = 0; i < size; ++i) {
+            std::string text = "shard " + std::to_string(i);
+            messages[i].assign(text.begin(), text.end());
+            signatures[i] = crypto::Signature::bls_sign(messages[i], secret_key(i)).value;
+        }
+        auto aggregate = crypto::Signature::bls_aggregate_signatures(signatures);
+        double distinct = best_of(rounds, [&] {
+            failures += !crypto::Signature::bls_verify_aggregate(messages, aggregate.value,
+                                                                 committee.public_keys).value;
+        });
+
+        std::cout << size << "\t" << separate * 1e3 << " ms\t" << fast * 1e3 << " ms (" << separate / fast << "x)\t"
+                  << distinct * 1e3 << " ms (" << separate / distinct << "x)" << std::endl;
+    }
+    if (failures > 0) {
+        std::cout << failures << " verifications FAILED" << std::endl;
+        return 1;
+    }
+    return 0;
+}
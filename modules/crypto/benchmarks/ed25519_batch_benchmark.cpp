@@ -0,0 +1,102 @@
+#include "chainforge/crypto/keypair.hpp"
+#include "chainforge/crypto/signature.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct SignedSet {
+    std::vector<crypto::Message> messages;
+    std::vector<crypto::Signature::Ed25519VerifyItem> items;
+};
+
+// One vote from each of count signers, numbered from first_signer
+SignedSet make_set(size_t count, size_t first_signer) {
+    SignedSet set;
+    set.messages.resize(count);
+    set.items.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        size_t signer = first_signer + i;
+        crypto::Ed25519PrivateKey seed{};
+        for (size_t j = 0; j < seed.size(); ++j) {
+            seed[j] = static_cast<crypto::byte_t>((signer >> (8 * (j % 4))) + j);
+        }
+        std::string text = "vote #" + std::to_string(i);
+        set.messages[i].assign(text.begin(), text.end());
+        set.items[i].message = set.messages[i];
+        set.items[i].signature = crypto::Signature::ed25519_sign(set.messages[i], seed).value;
+        set.items[i].public_key = crypto::KeyPair::derive_ed25519_public_key(seed).value;
+    }
+    return set;
+}
+
+// Seconds per signature, best of one round per set
+template <typename F>
+double best_per_signature(std::vector<SignedSet*> sets, F&& verify) {
+    double best = 1e18;
+    for (SignedSet* set : sets) {
+        auto start = Clock::now();
+        verify(*set);
+        double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+        best = std::min(best, elapsed / static_cast<double>(set->items.size()));
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t max_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024;
+    const size_t rounds = 3;
+
+    size_t failures = 0;
+    auto verify_single = [&](SignedSet& set) {
+        for (size_t i = 0; i < set.items.size(); ++i) {
+            const auto& item = set.items[i];
+            failures += !crypto::Signature::ed25519_verify(set.messages[i], item.signature, item.public_key).value;
+        }
+    };
+    auto verify_batch = [&](SignedSet& set) {
+        failures += !crypto::Signature::ed25519_verify_batch(set.items, 1).value;
+    };
+
+    std::cout << "=== Ed25519 verify benchmark (1 worker, best of " << rounds << ") ===" << std::endl;
+    std::cout << "batch\ted25519_verify\tbatch, new keys\t\tbatch, repeat signers" << std::endl;
+    size_t next_signer = 0;
+    for (size_t count = 16; count <= max_count; count *= 4) {
+        // New keys: each round brings signers the key cache has not seen
+        std::vector<SignedSet> fresh;
+        for (size_t round = 0; round < rounds; ++round) {
+            fresh.push_back(make_set(count, next_signer));
+            next_signer += count;
+        }
+        std::vector<SignedSet*> fresh_rounds;
+        for (auto& set : fresh) {
+            fresh_rounds.push_back(&set);
+        }
+        // A validator set signing block after block
+        SignedSet validators = make_set(count, next_signer);
+        next_signer += count;
+        std::vector<SignedSet*> repeat_rounds(rounds, &validators);
+
+        double single = best_per_signature(fresh_rounds, verify_single);
+        double cold = best_per_signature(fresh_rounds, verify_batch);
+        double warm = best_per_signature(repeat_rounds, verify_batch);
+
+        std::cout << count << "\t" << single * 1e6 << " us\t" << cold * 1e6 << " us (" << single / cold << "x)\t"
+                  << warm * 1e6 << " us (" << single / warm << "x)" << std::endl;
+    }
+    if (failures > 0) {
+        std::cout << failures << " verifications FAILED" << std::endl;
+        return 1;
+    }
+    return 0;
+}
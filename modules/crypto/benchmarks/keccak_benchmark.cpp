@@ -0,0 +1,82 @@
+#include "chainforge/crypto/keccak.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using crypto::Keccak;
+
+template <typename F>
+double seconds(F&& body) {
+    auto start = Clock::now();
+    body();
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+const char* backend_name(Keccak::BatchBackend backend) {
+    switch (backend) {
+    case Keccak::BatchBackend::Scalar: return "scalar";
+    case Keccak::BatchBackend::Avx2: return "AVX2 x4";
+    case Keccak::BatchBackend::Avx512: return "AVX-512 x8";
+    }
+    return "?";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    size_t sink = 0;
+
+    std::cout << "=== Keccak-256 benchmark ===" << std::endl;
+
+    // 32-byte state keys, the common case for trie and storage lookups
+    std::vector<crypto::ByteVector> keys(count, crypto::ByteVector(32));
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t j = 0; j < 32; ++j) {
+            keys[i][j] = static_cast<crypto::byte_t>(i * 31 + j);
+        }
+    }
+    std::vector<crypto::Hash256> digests(count);
+
+    double one_shot = seconds([&] {
+        for (size_t i = 0; i < count; ++i) {
+            digests[i] = Keccak::keccak256(keys[i]).value;
+        }
+    }) * 1e9 / static_cast<double>(count);
+    sink += digests[count / 2][0];
+    std::cout << "keccak256, one message per call: " << one_shot << " ns per 32-byte key" << std::endl;
+
+    Keccak::BatchBackend detected = Keccak::batch_backend();
+    for (auto backend : {Keccak::BatchBackend::Scalar, Keccak::BatchBackend::Avx2, Keccak::BatchBackend::Avx512}) {
+        if (!Keccak::set_batch_backend(backend)) {
+            std::cout << "keccak256_many, " << backend_name(backend) << ": not supported here" << std::endl;
+            continue;
+        }
+        double batch = seconds([&] { Keccak::keccak256_many(keys, digests); }) * 1e9 / static_cast<double>(count);
+        sink += digests[count / 2][0];
+        std::cout << "keccak256_many, " << backend_name(backend) << ": " << batch << " ns per key (" << one_shot / batch
+                  << "x)" << std::endl;
+    }
+    Keccak::set_batch_backend(detected);
+    std::cout << "Detected backend: " << backend_name(detected) << std::endl;
+
+    // Streaming throughput over a large input
+    std::vector<crypto::byte_t> bulk(64 << 20, 0x5A);
+    Keccak::StreamHasher hasher;
+    double stream_seconds = seconds([&] {
+        for (size_t offset = 0; offset < bulk.size(); offset += 4096) {
+            hasher.update(bulk.data() + offset, 4096);
+        }
+        sink += hasher.finalize_256().value[0];
+    });
+    std::cout << "StreamHasher: " << static_cast<double>(bulk.size()) / (1 << 20) / stream_seconds << " MB/s"
+              << std::endl;
+
+    return sink == 0 ? 1 : 0;
+}
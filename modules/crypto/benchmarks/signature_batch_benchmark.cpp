@@ -0,0 +1,128 @@
+#include "chainforge/crypto/keypair.hpp"
+#include "chainforge/crypto/signature.hpp"
+#include <openssl/ec.h>
+#include <openssl/ecdsa.h>
+#include <openssl/obj_mac.h>
+#include <openssl/sha.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Best of a few rounds; verification is long enough that one round is noisy
+template <typename F>
+double best_seconds(F&& body) {
+    double best = 1e18;
+    for (int round = 0; round < 3; ++round) {
+        auto start = Clock::now();
+        body();
+        best = std::min(best, std::chrono::duration<double>(Clock::now() - start).count());
+    }
+    return best;
+}
+
+// The previous per-call verify: a fresh EC_KEY, o2i key decoding and a DER parse every time
+bool legacy_verify(const crypto::Message& message, const std::vector<unsigned char>& der_signature,
+                   const crypto::Secp256k1PublicKey& public_key) {
+    unsigned char hash[SHA256_DIGEST_LENGTH];
+    SHA256(message.data(), message.size(), hash);
+
+    EC_KEY* ec_key = EC_KEY_new_by_curve_name(NID_secp256k1);
+    unsigned char encoded[65] = {0x04};
+    std::copy(public_key.begin(), public_key.end(), encoded + 1);
+    const unsigned char* key_data = encoded;
+    if (!o2i_ECPublicKey(&ec_key, &key_data, sizeof(encoded))) {
+        EC_KEY_free(ec_key);
+        return false;
+    }
+    const unsigned char* sig_data = der_signature.data();
+    ECDSA_SIG* sig = d2i_ECDSA_SIG(nullptr, &sig_data, static_cast<long>(der_signature.size()));
+    int result = ECDSA_do_verify(hash, SHA256_DIGEST_LENGTH, sig, ec_key);
+    ECDSA_SIG_free(sig);
+    EC_KEY_free(ec_key);
+    return result == 1;
+}
+
+std::vector<unsigned char> to_der(const crypto::Secp256k1Signature& signature) {
+    ECDSA_SIG* sig = ECDSA_SIG_new();
+    ECDSA_SIG_set0(sig, BN_bin2bn(signature.data(), 32, nullptr), BN_bin2bn(signature.data() + 32, 32, nullptr));
+    std::vector<unsigned char> der(static_cast<size_t>(i2d_ECDSA_SIG(sig, nullptr)));
+    unsigned char* cursor = der.data();
+    i2d_ECDSA_SIG(sig, &cursor);
+    ECDSA_SIG_free(sig);
+    return der;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+    const size_t senders = std::max<size_t>(1, count / 10);
+
+    // A block's worth of transfers, about ten per sender
+    std::vector<crypto::Secp256k1PrivateKey> private_keys(senders);
+    std::vector<crypto::Secp256k1PublicKey> public_keys(senders);
+    for (size_t i = 0; i < senders; ++i) {
+        for (size_t j = 0; j < 32; ++j) {
+            private_keys[i][j] = static_cast<crypto::byte_t>(i * 7 + j + 1);
+        }
+        public_keys[i] = crypto::KeyPair::derive_secp256k1_public_key(private_keys[i]).value;
+    }
+    std::vector<crypto::Message> messages(count);
+    std::vector<crypto::Signature::VerifyItem> items(count);
+    std::vector<std::vector<unsigned char>> der_signatures(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string text = "transfer #" + std::to_string(i);
+        messages[i].assign(text.begin(), text.end());
+        items[i].message = messages[i];
+        items[i].signature = crypto::Signature::ecdsa_secp256k1_sign(messages[i], private_keys[i % senders]).value;
+        items[i].public_key = public_keys[i % senders];
+        der_signatures[i] = to_der(items[i].signature);
+    }
+
+    size_t valid = 0;
+    double legacy = best_seconds([&] {
+        for (size_t i = 0; i < count; ++i) {
+            valid += legacy_verify(messages[i], der_signatures[i], items[i].public_key);
+        }
+    });
+    auto verify_each = [&] {
+        for (size_t i = 0; i < count; ++i) {
+            valid += crypto::Signature::ecdsa_secp256k1_verify(messages[i], items[i].signature, items[i].public_key).value;
+        }
+    };
+    crypto::Signature::set_secp256k1_key_cache_capacity(0);
+    double uncached = best_seconds(verify_each);
+    crypto::Signature::set_secp256k1_key_cache_capacity(crypto::Signature::DEFAULT_KEY_CACHE_CAPACITY);
+    double single = best_seconds(verify_each);
+    double batch_one = best_seconds([&] { valid += crypto::Signature::ecdsa_secp256k1_verify_batch(items, 1).value; });
+    const size_t cores = std::max<size_t>(1, std::thread::hardware_concurrency());
+    double batch_all = best_seconds([&] { valid += crypto::Signature::ecdsa_secp256k1_verify_batch(items, cores).value; });
+
+    auto rate = [&](double elapsed) { return static_cast<double>(count) / elapsed; };
+    std::cout << "=== secp256k1 verify benchmark (" << count << " signatures, " << senders << " senders) ===" << std::endl;
+    std::cout << "Legacy per-call EC_KEY + DER: " << rate(legacy) << " verifies/s/core" << std::endl;
+    std::cout << "verify, key cache off:        " << rate(uncached) << " verifies/s/core (" << legacy / uncached << "x)"
+              << std::endl;
+    std::cout << "ecdsa_secp256k1_verify:       " << rate(single) << " verifies/s/core (" << legacy / single << "x)"
+              << std::endl;
+    std::cout << "verify_batch, 1 worker:       " << rate(batch_one) << " verifies/s/core (" << legacy / batch_one
+              << "x)" << std::endl;
+    std::cout << "verify_batch, " << cores << " workers:      " << rate(batch_all) << " verifies/s total, "
+              << rate(batch_all) / static_cast<double>(cores) << " per core" << std::endl;
+
+    auto cache = crypto::Signature::secp256k1_key_cache_stats();
+    std::cout << "Key cache: " << cache.hits << " hits, " << cache.misses << " misses, " << cache.size << " of "
+              << cache.capacity << " entries" << std::endl;
+
+    return valid == 3 * (3 * count + 2) ? 0 : 1;
+}
@@ -2,6 +2,7 @@
 
 #include "types.hpp"
 #include <optional>
+#include <span>
 
 namespace chainforge::crypto {
 
@@ -77,8 +78,14 @@ public:
         static bool is_valid_g1_point(const BlsPublicKey& point);
         static bool is_valid_g2_point(const BlsSignature& point);
 
-        // Pairing operations
+        // Pairing operations: whether e(g1_point, g2_point) is one
         static CryptoResult<bool> pairing_check(const BlsPublicKey& g1_point, const BlsSignature& g2_point);
+        // Whether prod e(g1_points[i], g2_points[i]) is one, with a single
+        // final exponentiation for the whole product
+        static CryptoResult<bool> multi_pairing_check(
+            std::span<const BlsPublicKey> g1_points,
+            std::span<const BlsSignature> g2_points
+        );
 
         // Generators
         static const BlsPublicKey& g1_generator();
@@ -51,6 +51,24 @@ public:
     static CryptoResult<Hash256> hash_pair(const Hash256& left, const Hash256& right);
     static CryptoResult<Hash256> hash_many(const std::vector<Hash256>& hashes);
 
+    // SHA-256 of many independent pairs, the shape of every Merkle parent:
+    // out[i] = SHA-256(*left[i] || *right[i]). Runs 8 pairs at a time across
+    // AVX2 registers, or each pair through the SHA extensions, when the CPU
+    // supports it. `out` must not overlap any input.
+    static void hash_pairs(const Hash256* const* left, const Hash256* const* right, size_t count,
+                           Hash256* out) noexcept;
+
+    // Instruction set used by hash_pairs, detected once at startup
+    enum class PairBackend {
+        Scalar,
+        Avx2,
+        ShaNi
+    };
+    static PairBackend pair_backend() noexcept;
+    static bool is_pair_backend_supported(PairBackend backend) noexcept;
+    // Switch backends (e.g. to compare them); false if this CPU or build lacks it
+    static bool set_pair_backend(PairBackend backend) noexcept;
+
     // Utility functions
     static std::string to_hex(const Hash256& hash);
     static std::string to_hex(const Ripemd160Hash& hash);
@@ -66,4 +84,29 @@ private:
     static CryptoResult<Ripemd160Hash> internal_ripemd160(const byte_t* data, size_t length);
 };
 
+/**
+ * Incremental SHA-256
+ * The digest context lives inline, so feeding data through it never allocates.
+ * The digest matches Hash::sha256 over the concatenation of every update.
+ */
+class Sha256Hasher {
+public:
+    Sha256Hasher() noexcept { reset(); }
+
+    // Absorb more input
+    void update(const byte_t* data, size_t length) noexcept;
+
+    // Produce the digest and reset for the next message
+    Hash256 finalize() noexcept;
+
+    // Start a new message
+    void reset() noexcept;
+
+private:
+    // Opaque storage for the OpenSSL context, kept out of this header
+    static constexpr size_t CONTEXT_SIZE = 128;
+
+    alignas(8) std::array<byte_t, CONTEXT_SIZE> context_;
+};
+
 } // namespace chainforge::crypto
@@ -1,14 +1,18 @@
 #pragma once
 
 #include "types.hpp"
+#include <span>
 #include <string>
-#include <memory>
 
 namespace chainforge::crypto {
 
 /**
  * Keccak hash function implementation
  * Provides optimized Keccak operations for blockchain use
+ *
+ * This is the original Keccak padding (0x01) used by Ethereum, not FIPS 202
+ * SHA-3. Every output size d uses capacity 2d, so keccak160 is Keccak[c=320]
+ * rather than a truncated keccak256.
  */
 class Keccak {
 public:
@@ -39,29 +43,61 @@ public:
     static CryptoResult<std::array<byte_t, 64>> keccak512(const ByteVector& data);
     static CryptoResult<std::array<byte_t, 64>> keccak512(const byte_t* data, size_t length);
 
-    // Streaming Keccak interface for large data
+    // Keccak-256 of many independent messages: out[i] = keccak256(messages[i]).
+    // Runs 8 (AVX-512) or 4 (AVX2) messages per permutation when the CPU
+    // supports it. Messages of different lengths are fine; batches of similar
+    // length waste the fewest lanes.
+    static CryptoResult<void> keccak256_many(std::span<const ByteVector> messages, std::span<Hash256> out);
+    static void keccak256_many(const byte_t* const* data, const size_t* lengths, size_t count, Hash256* out) noexcept;
+
+    // Instruction set used by keccak256_many, detected once at startup
+    enum class BatchBackend {
+        Scalar,
+        Avx2,
+        Avx512
+    };
+    static BatchBackend batch_backend() noexcept;
+    static bool is_batch_backend_supported(BatchBackend backend) noexcept;
+    // Switch backends (e.g. to compare them); false if this CPU or build lacks it
+    static bool set_batch_backend(BatchBackend backend) noexcept;
+
+    /**
+     * Streaming Keccak
+     * Input is absorbed into the sponge as it arrives, so nothing is buffered
+     * and nothing is allocated. The output size fixes the sponge rate and
+     * must be chosen up front; finalizing with any other size reports
+     * CryptoError::INVALID_LENGTH.
+     */
     class StreamHasher {
     public:
-        StreamHasher();
-        ~StreamHasher();
+        // output_bits is 160, 256, 384 or 512
+        explicit StreamHasher(size_t output_bits = 256) noexcept;
 
         // Update with data
-        void update(const ByteVector& data);
-        void update(const byte_t* data, size_t length);
-        void update(const std::string& data);
+        void update(const ByteVector& data) noexcept;
+        void update(const byte_t* data, size_t length) noexcept;
+        void update(const std::string& data) noexcept;
 
-        // Finalize and get hash
-        CryptoResult<Hash256> finalize_256();
-        CryptoResult<std::array<byte_t, 20>> finalize_160();
-        CryptoResult<std::array<byte_t, 48>> finalize_384();
-        CryptoResult<std::array<byte_t, 64>> finalize_512();
+        // Finalize and get hash; the hasher is reset for the next message
+        CryptoResult<Hash256> finalize_256() noexcept;
+        CryptoResult<std::array<byte_t, 20>> finalize_160() noexcept;
+        CryptoResult<std::array<byte_t, 48>> finalize_384() noexcept;
+        CryptoResult<std::array<byte_t, 64>> finalize_512() noexcept;
 
         // Reset for reuse
-        void reset();
+        void reset() noexcept;
+
+        size_t output_bits() const noexcept { return output_bits_; }
 
     private:
-        class Impl;
-        std::unique_ptr<Impl> impl_;
+        std::array<uint64_t, 25> state_;
+        size_t output_bits_;
+        size_t rate_;
+        // Bytes absorbed into the current block
+        size_t offset_;
+
+        template <size_t N>
+        CryptoResult<std::array<byte_t, N>> finalize() noexcept;
     };
 
     // Utility functions
@@ -76,11 +112,8 @@ public:
 
     // Mining-related operations (for PoW)
     static void keccak_f800_round(byte_t* state);
+    // Full 24-round Keccak-f[1600] over a 200-byte state of little-endian lanes
     static void keccak_f1600_round(byte_t* state);
-
-private:
-    // Internal Keccak implementation
-    static CryptoResult<Hash256> internal_keccak(const byte_t* data, size_t length, size_t output_bits);
 };
 
 } // namespace chainforge::crypto
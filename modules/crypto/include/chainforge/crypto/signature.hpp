@@ -2,6 +2,7 @@
 
 #include "types.hpp"
 #include <optional>
+#include <span>
 
 namespace chainforge::crypto {
 
@@ -24,6 +25,8 @@ public:
     ~Signature() = default;
 
     // ECDSA secp256k1 signatures
+    // Signatures are compact r || s and public keys are x || y without the
+    // 0x04 prefix; the message is hashed with SHA-256 before signing.
     static CryptoResult<Secp256k1Signature> ecdsa_secp256k1_sign(
         const Message& message,
         const Secp256k1PrivateKey& private_key
@@ -35,6 +38,41 @@ public:
         const Secp256k1PublicKey& public_key
     );
 
+    // One entry of a batch verification; result is filled in by the call
+    struct VerifyItem {
+        std::span<const byte_t> message;
+        Secp256k1Signature signature;
+        Secp256k1PublicKey public_key;
+        CryptoResult<bool> result{false, CryptoError::VERIFICATION_FAILED};
+    };
+
+    // Verify many signatures at once, e.g. every transaction in a block.
+    // Each distinct public key is looked up once per worker, and the items are
+    // split across up to max_workers threads of the shared core::WorkerPool
+    // (0 = all of them, plus the caller).
+    // Every item gets the result ecdsa_secp256k1_verify would return for it.
+    // The returned value is true only if every item verified.
+    static CryptoResult<bool> ecdsa_secp256k1_verify_batch(std::span<VerifyItem> items, size_t max_workers = 0);
+
+    // Both verify calls look decoded secp256k1 public keys up in a bounded
+    // LRU shared by all threads, so repeat senders skip point decoding.
+    // Keys that fail to decode are never cached.
+    struct KeyCacheStats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+        size_t size = 0;
+        size_t capacity = 0;
+    };
+
+    static constexpr size_t DEFAULT_KEY_CACHE_CAPACITY = 8192;
+
+    static KeyCacheStats secp256k1_key_cache_stats();
+    // 0 disables the cache; shrinking evicts least recently used keys
+    static void set_secp256k1_key_cache_capacity(size_t capacity);
+    // Drops all entries and resets the counters
+    static void clear_secp256k1_key_cache();
+
     static CryptoResult<Secp256k1PublicKey> ecdsa_secp256k1_recover_public_key(
         const Message& message,
         const Secp256k1Signature& signature,
@@ -47,13 +85,33 @@ public:
         const Ed25519PrivateKey& private_key
     );
 
+    // Verification follows ZIP-215: s must be below the group order, any
+    // encoding of R and A that decodes to a curve point is accepted, and the
+    // check is the cofactored [8]([s]B - R - [h]A) == 0
     static CryptoResult<bool> ed25519_verify(
         const Message& message,
         const Ed25519Signature& signature,
         const Ed25519PublicKey& public_key
     );
 
-    // BLS signatures
+    struct Ed25519VerifyItem {
+        std::span<const byte_t> message;
+        Ed25519Signature signature;
+        Ed25519PublicKey public_key;
+        CryptoResult<bool> result{false, CryptoError::VERIFICATION_FAILED};
+    };
+
+    // Verify many Ed25519 signatures, e.g. a validator set's votes. Each
+    // worker's slice is checked with one randomized batch equation; when that
+    // fails, its items are verified one by one to find the bad ones.
+    // Every item gets the result ed25519_verify would return for it, including
+    // for signatures crafted with small-order components.
+    static CryptoResult<bool> ed25519_verify_batch(std::span<Ed25519VerifyItem> items, size_t max_workers = 0);
+
+    // BLS signatures over BLS12-381: public keys are compressed G1 points and
+    // signatures compressed G2 points. Messages are hashed to G2 under the
+    // proof-of-possession ciphersuite, BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_.
+    // In builds without blst every BLS call returns UNSUPPORTED_ALGORITHM.
     static CryptoResult<BlsSignature> bls_sign(
         const Message& message,
         const BlsPrivateKey& private_key
@@ -65,17 +123,42 @@ public:
         const BlsPublicKey& public_key
     );
 
-    // Aggregate BLS signatures
+    // Aggregate BLS signatures: the sum of the G2 points
     static CryptoResult<BlsSignature> bls_aggregate_signatures(
         const std::vector<BlsSignature>& signatures
     );
 
+    static CryptoResult<BlsPublicKey> bls_aggregate_public_keys(
+        const std::vector<BlsPublicKey>& public_keys
+    );
+
+    // messages[i] signed by public_keys[i]. Costs one Miller loop per signer
+    // plus one for the signature, and a single final exponentiation.
     static CryptoResult<bool> bls_verify_aggregate(
         const std::vector<Message>& messages,
         const BlsSignature& aggregate_signature,
         const std::vector<BlsPublicKey>& public_keys
     );
 
+    // One message signed by every key, e.g. a committee attestation. The keys
+    // are summed first, so this costs two Miller loops however many signed.
+    // Summing keys is open to rogue-key forgeries unless each key's owner has
+    // proved possession of its secret key, so only pass registered keys.
+    static CryptoResult<bool> bls_fast_aggregate_verify(
+        const Message& message,
+        const BlsSignature& aggregate_signature,
+        const std::vector<BlsPublicKey>& public_keys
+    );
+
+    // Proof of possession: a signature over the public key under a separate
+    // tag, checked once when the key is registered
+    static CryptoResult<BlsSignature> bls_prove_possession(const BlsPrivateKey& private_key);
+
+    static CryptoResult<bool> bls_verify_possession(
+        const BlsPublicKey& public_key,
+        const BlsSignature& proof
+    );
+
     // Utility functions (templated to avoid overloading conflicts)
     template<typename T>
     static std::string signature_to_hex(const T& sig);
@@ -0,0 +1,98 @@
+#include "bls12_381.hpp"
+#include "lru_cache.hpp"
+#include <functional>
+#include <vector>
+
+namespace chainforge::crypto {
+
+namespace {
+
+// A few committees' worth of validators
+constexpr size_t BLS_KEY_CACHE_CAPACITY = 4096;
+
+struct BlsKeyHash {
+    size_t operator()(const BlsPublicKey& key) const noexcept {
+        return std::hash<std::string_view>{}(
+            std::string_view(reinterpret_cast<const char*>(key.data()), key.size()));
+    }
+};
+
+using BlsKeyCache = ShardedLruCache<BlsPublicKey, blst_p1_affine, BlsKeyHash>;
+
+const byte_t* tag_bytes(std::string_view dst) {
+    return reinterpret_cast<const byte_t*>(dst.data());
+}
+
+} // namespace
+
+bool bls_decode_secret_key(const BlsPrivateKey& private_key, blst_scalar& scalar) {
+    blst_scalar_from_bendian(&scalar, private_key.data());
+    return blst_sk_check(&scalar);
+}
+
+bool bls_decode_g1(const BlsPublicKey& encoded, blst_p1_affine& point) {
+    return blst_p1_uncompress(&point, encoded.data()) == BLST_SUCCESS && blst_p1_affine_in_g1(&point);
+}
+
+bool bls_decode_g2(const BlsSignature& encoded, blst_p2_affine& point) {
+    return blst_p2_uncompress(&point, encoded.data()) == BLST_SUCCESS && blst_p2_affine_in_g2(&point);
+}
+
+BlsPublicKey bls_encode_g1(const blst_p1& point) {
+    BlsPublicKey encoded;
+    blst_p1_compress(encoded.data(), &point);
+    return encoded;
+}
+
+BlsSignature bls_encode_g2(const blst_p2& point) {
+    BlsSignature encoded;
+    blst_p2_compress(encoded.data(), &point);
+    return encoded;
+}
+
+std::shared_ptr<const blst_p1_affine> bls_decode_public_key(const BlsPublicKey& public_key) {
+    static BlsKeyCache cache(BLS_KEY_CACHE_CAPACITY);
+    return cache.get_or_create(public_key, [](const BlsPublicKey& key) -> BlsKeyCache::ValuePtr {
+        auto point = std::make_shared<blst_p1_affine>();
+        if (!bls_decode_g1(key, *point) || blst_p1_affine_is_inf(point.get())) {
+            return nullptr;
+        }
+        return point;
+    });
+}
+
+blst_p2_affine bls_hash_to_g2(std::span<const byte_t> message, std::string_view dst) {
+    blst_p2 hashed;
+    blst_hash_to_g2(&hashed, message.data(), message.size(), tag_bytes(dst), dst.size(), nullptr, 0);
+    blst_p2_affine point;
+    blst_p2_to_affine(&point, &hashed);
+    return point;
+}
+
+bool bls_pairing_product_is_one(std::span<const blst_p1_affine> g1_points, std::span<const blst_p2_affine> g2_points) {
+    blst_fp12 product = *blst_fp12_one();
+    for (size_t i = 0; i < g1_points.size() && i < g2_points.size(); ++i) {
+        if (blst_p1_affine_is_inf(&g1_points[i]) || blst_p2_affine_is_inf(&g2_points[i])) {
+            continue;
+        }
+        blst_fp12 loop;
+        blst_miller_loop(&loop, &g2_points[i], &g1_points[i]);
+        blst_fp12_mul(&product, &product, &loop);
+    }
+    blst_fp12 result;
+    blst_final_exp(&result, &product);
+    return blst_fp12_is_one(&result);
+}
+
+const blst_p1_affine& bls_negated_g1_generator() {
+    static const blst_p1_affine negated = [] {
+        blst_p1 generator = *blst_p1_generator();
+        blst_p1_cneg(&generator, true);
+        blst_p1_affine point;
+        blst_p1_to_affine(&point, &generator);
+        return point;
+    }();
+    return negated;
+}
+
+} // namespace chainforge::crypto
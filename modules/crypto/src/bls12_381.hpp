@@ -0,0 +1,58 @@
+#pragma once
+
+#include "chainforge/crypto/types.hpp"
+#include <string_view>
+
+#ifdef CHAINFORGE_HAVE_BLST
+#include <blst.h>
+#include <memory>
+#include <span>
+#endif
+
+namespace chainforge::crypto {
+
+// Hash-to-curve tags of the proof-of-possession ciphersuite with public keys
+// in G1 and signatures in G2, as used by Ethereum consensus
+inline constexpr std::string_view BLS_SIGNATURE_DST = "BLS_SIG_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_";
+inline constexpr std::string_view BLS_POSSESSION_DST = "BLS_POP_BLS12381G2_XMD:SHA-256_SSWU_RO_POP_";
+
+#ifdef CHAINFORGE_HAVE_BLST
+
+// Big-endian scalar in [1, r)
+bool bls_decode_secret_key(const BlsPrivateKey& private_key, blst_scalar& scalar);
+
+// Compressed points on the curve and in the order-r subgroup; the identity
+// is accepted
+bool bls_decode_g1(const BlsPublicKey& encoded, blst_p1_affine& point);
+bool bls_decode_g2(const BlsSignature& encoded, blst_p2_affine& point);
+
+BlsPublicKey bls_encode_g1(const blst_p1& point);
+BlsSignature bls_encode_g2(const blst_p2& point);
+
+/**
+ * Decoded public key, or null if it fails KeyValidate (not a subgroup point,
+ * or the identity)
+ *
+ * Decompression and the subgroup check cost about as much as a Miller loop,
+ * and committees sign slot after slot, so decoded keys are kept in a bounded
+ * LRU shared by all threads.
+ */
+std::shared_ptr<const blst_p1_affine> bls_decode_public_key(const BlsPublicKey& public_key);
+
+blst_p2_affine bls_hash_to_g2(std::span<const byte_t> message, std::string_view dst);
+
+/**
+ * Whether prod e(g1_points[i], g2_points[i]) is one
+ *
+ * Runs one Miller loop per pair and a single final exponentiation for the
+ * whole product, which is where the pairing cost is. Pairs with the identity
+ * on either side contribute one and are skipped.
+ */
+bool bls_pairing_product_is_one(std::span<const blst_p1_affine> g1_points, std::span<const blst_p2_affine> g2_points);
+
+// -G1: e(pk, H(m)) * e(-G1, sig) == 1 is the verify equation as one product
+const blst_p1_affine& bls_negated_g1_generator();
+
+#endif // CHAINFORGE_HAVE_BLST
+
+} // namespace chainforge::crypto
@@ -1,5 +1,7 @@
 #include "chainforge/crypto/curve.hpp"
+#include "bls12_381.hpp"
 #include <algorithm>
+#include <vector>
 
 // Implementation of curve operations
 // TODO: Implement full curve operations using the respective crypto libraries
@@ -112,58 +114,184 @@ const Ed25519PublicKey& Curve::Ed25519::generator() {
 }
 
 // BLS12-381 curve operations
+#ifdef CHAINFORGE_HAVE_BLST
+namespace {
+
+// Scalars are big-endian and used as is, without reduction mod r
+blst_scalar bls_scalar(const BlsPrivateKey& scalar) {
+    blst_scalar decoded;
+    blst_scalar_from_bendian(&decoded, scalar.data());
+    return decoded;
+}
+
+constexpr size_t BLS_SCALAR_BITS = 8 * BLS_PRIVATE_KEY_SIZE;
+
+} // namespace
+
+CryptoResult<BlsPublicKey> Curve::Bls12_381::g1_multiply_base(const BlsPrivateKey& scalar) {
+    const blst_scalar k = bls_scalar(scalar);
+    blst_p1 result;
+    blst_p1_mult(&result, blst_p1_generator(), k.b, BLS_SCALAR_BITS);
+    return CryptoResult<BlsPublicKey>{bls_encode_g1(result), CryptoError::SUCCESS};
+}
+
+CryptoResult<BlsPublicKey> Curve::Bls12_381::g1_multiply(const BlsPublicKey& point, const BlsPrivateKey& scalar) {
+    blst_p1_affine decoded;
+    if (!bls_decode_g1(point, decoded)) {
+        return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::INVALID_KEY};
+    }
+    blst_p1 base;
+    blst_p1_from_affine(&base, &decoded);
+    const blst_scalar k = bls_scalar(scalar);
+    blst_p1 result;
+    blst_p1_mult(&result, &base, k.b, BLS_SCALAR_BITS);
+    return CryptoResult<BlsPublicKey>{bls_encode_g1(result), CryptoError::SUCCESS};
+}
+
+CryptoResult<BlsPublicKey> Curve::Bls12_381::g1_add(const BlsPublicKey& p1, const BlsPublicKey& p2) {
+    blst_p1_affine a;
+    blst_p1_affine b;
+    if (!bls_decode_g1(p1, a) || !bls_decode_g1(p2, b)) {
+        return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::INVALID_KEY};
+    }
+    blst_p1 sum;
+    blst_p1_from_affine(&sum, &a);
+    blst_p1_add_or_double_affine(&sum, &sum, &b);
+    return CryptoResult<BlsPublicKey>{bls_encode_g1(sum), CryptoError::SUCCESS};
+}
+
+CryptoResult<BlsSignature> Curve::Bls12_381::g2_multiply_base(const BlsPrivateKey& scalar) {
+    const blst_scalar k = bls_scalar(scalar);
+    blst_p2 result;
+    blst_p2_mult(&result, blst_p2_generator(), k.b, BLS_SCALAR_BITS);
+    return CryptoResult<BlsSignature>{bls_encode_g2(result), CryptoError::SUCCESS};
+}
+
+CryptoResult<BlsSignature> Curve::Bls12_381::g2_multiply(const BlsSignature& point, const BlsPrivateKey& scalar) {
+    blst_p2_affine decoded;
+    if (!bls_decode_g2(point, decoded)) {
+        return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::INVALID_SIGNATURE};
+    }
+    blst_p2 base;
+    blst_p2_from_affine(&base, &decoded);
+    const blst_scalar k = bls_scalar(scalar);
+    blst_p2 result;
+    blst_p2_mult(&result, &base, k.b, BLS_SCALAR_BITS);
+    return CryptoResult<BlsSignature>{bls_encode_g2(result), CryptoError::SUCCESS};
+}
+
+CryptoResult<BlsSignature> Curve::Bls12_381::g2_add(const BlsSignature& s1, const BlsSignature& s2) {
+    blst_p2_affine a;
+    blst_p2_affine b;
+    if (!bls_decode_g2(s1, a) || !bls_decode_g2(s2, b)) {
+        return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::INVALID_SIGNATURE};
+    }
+    blst_p2 sum;
+    blst_p2_from_affine(&sum, &a);
+    blst_p2_add_or_double_affine(&sum, &sum, &b);
+    return CryptoResult<BlsSignature>{bls_encode_g2(sum), CryptoError::SUCCESS};
+}
+
+bool Curve::Bls12_381::is_valid_g1_point(const BlsPublicKey& point) {
+    blst_p1_affine decoded;
+    return bls_decode_g1(point, decoded);
+}
+
+bool Curve::Bls12_381::is_valid_g2_point(const BlsSignature& point) {
+    blst_p2_affine decoded;
+    return bls_decode_g2(point, decoded);
+}
+
+CryptoResult<bool> Curve::Bls12_381::pairing_check(const BlsPublicKey& g1_point, const BlsSignature& g2_point) {
+    return multi_pairing_check(std::span<const BlsPublicKey>(&g1_point, 1), std::span<const BlsSignature>(&g2_point, 1));
+}
+
+CryptoResult<bool> Curve::Bls12_381::multi_pairing_check(
+    std::span<const BlsPublicKey> g1_points,
+    std::span<const BlsSignature> g2_points
+) {
+    if (g1_points.size() != g2_points.size()) {
+        return CryptoResult<bool>{false, CryptoError::INVALID_LENGTH};
+    }
+
+    std::vector<blst_p1_affine> decoded_g1(g1_points.size());
+    std::vector<blst_p2_affine> decoded_g2(g2_points.size());
+    for (size_t i = 0; i < g1_points.size(); ++i) {
+        if (!bls_decode_g1(g1_points[i], decoded_g1[i])) {
+            return CryptoResult<bool>{false, CryptoError::INVALID_KEY};
+        }
+        if (!bls_decode_g2(g2_points[i], decoded_g2[i])) {
+            return CryptoResult<bool>{false, CryptoError::INVALID_SIGNATURE};
+        }
+    }
+    return CryptoResult<bool>{bls_pairing_product_is_one(decoded_g1, decoded_g2), CryptoError::SUCCESS};
+}
+
+const BlsPublicKey& Curve::Bls12_381::g1_generator() {
+    static const BlsPublicKey g1_generator = bls_encode_g1(*blst_p1_generator());
+    return g1_generator;
+}
+
+const BlsSignature& Curve::Bls12_381::g2_generator() {
+    static const BlsSignature g2_generator = bls_encode_g2(*blst_p2_generator());
+    return g2_generator;
+}
+#else
+// Built without blst: every operation reports UNSUPPORTED_ALGORITHM and no
+// point validates
 CryptoResult<BlsPublicKey> Curve::Bls12_381::g1_multiply_base(const BlsPrivateKey& scalar) {
-    // TODO: Implement BLS G1 base multiplication
     (void)scalar; // Suppress unused parameter warnings
     return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
 CryptoResult<BlsPublicKey> Curve::Bls12_381::g1_multiply(const BlsPublicKey& point, const BlsPrivateKey& scalar) {
-    // TODO: Implement BLS G1 multiplication
     (void)point; (void)scalar; // Suppress unused parameter warnings
     return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
 CryptoResult<BlsPublicKey> Curve::Bls12_381::g1_add(const BlsPublicKey& p1, const BlsPublicKey& p2) {
-    // TODO: Implement BLS G1 addition
     (void)p1; (void)p2; // Suppress unused parameter warnings
     return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
 CryptoResult<BlsSignature> Curve::Bls12_381::g2_multiply_base(const BlsPrivateKey& scalar) {
-    // TODO: Implement BLS G2 base multiplication
     (void)scalar; // Suppress unused parameter warnings
     return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
 CryptoResult<BlsSignature> Curve::Bls12_381::g2_multiply(const BlsSignature& point, const BlsPrivateKey& scalar) {
-    // TODO: Implement BLS G2 multiplication
     (void)point; (void)scalar; // Suppress unused parameter warnings
     return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
 CryptoResult<BlsSignature> Curve::Bls12_381::g2_add(const BlsSignature& s1, const BlsSignature& s2) {
-    // TODO: Implement BLS G2 addition
     (void)s1; (void)s2; // Suppress unused parameter warnings
     return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
 bool Curve::Bls12_381::is_valid_g1_point(const BlsPublicKey& point) {
-    // TODO: Implement BLS G1 point validation
-    return point.size() == BLS_PUBLIC_KEY_SIZE;
+    (void)point; // Suppress unused parameter warnings
+    return false;
 }
 
 bool Curve::Bls12_381::is_valid_g2_point(const BlsSignature& point) {
-    // TODO: Implement BLS G2 point validation
-    return point.size() == BLS_SIGNATURE_SIZE;
+    (void)point; // Suppress unused parameter warnings
+    return false;
 }
 
 CryptoResult<bool> Curve::Bls12_381::pairing_check(const BlsPublicKey& g1_point, const BlsSignature& g2_point) {
-    // TODO: Implement BLS pairing check
     (void)g1_point; (void)g2_point; // Suppress unused parameter warnings
     return CryptoResult<bool>{false, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
+CryptoResult<bool> Curve::Bls12_381::multi_pairing_check(
+    std::span<const BlsPublicKey> g1_points,
+    std::span<const BlsSignature> g2_points
+) {
+    (void)g1_points; (void)g2_points; // Suppress unused parameter warnings
+    return CryptoResult<bool>{false, CryptoError::UNSUPPORTED_ALGORITHM};
+}
+
 const BlsPublicKey& Curve::Bls12_381::g1_generator() {
     static const BlsPublicKey g1_generator{};
     return g1_generator;
@@ -173,5 +301,6 @@ const BlsSignature& Curve::Bls12_381::g2_generator() {
     static const BlsSignature g2_generator{};
     return g2_generator;
 }
+#endif
 
 } // namespace chainforge::crypto
@@ -0,0 +1,682 @@
+#include "ed25519_batch.hpp"
+#include "lru_cache.hpp"
+#include "sodium_support.hpp"
+#include <openssl/sha.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+namespace chainforge::crypto {
+
+namespace {
+
+#if defined(__SIZEOF_INT128__)
+__extension__ using u128 = unsigned __int128;
+#else
+// Just the 128-bit operations the field arithmetic uses, for compilers
+// without __int128 (MSVC), so every build verifies with the same code
+struct u128 {
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+
+    constexpr u128() = default;
+    constexpr u128(uint64_t low) : lo(low) {}
+
+    // Only ever called on a widened 64-bit value
+    friend u128 operator*(u128 a, uint64_t b) {
+        u128 r;
+#if defined(_MSC_VER) && defined(_M_X64)
+        r.lo = _umul128(a.lo, b, &r.hi);
+#elif defined(_MSC_VER) && defined(_M_ARM64)
+        r.lo = a.lo * b;
+        r.hi = __umulh(a.lo, b);
+#else
+        const uint64_t a0 = a.lo & 0xFFFFFFFF, a1 = a.lo >> 32;
+        const uint64_t b0 = b & 0xFFFFFFFF, b1 = b >> 32;
+        const uint64_t low = a0 * b0;
+        const uint64_t middle = (low >> 32) + (a1 * b0 & 0xFFFFFFFF) + a0 * b1;
+        r.lo = (middle << 32) | (low & 0xFFFFFFFF);
+        r.hi = a1 * b1 + (a1 * b0 >> 32) + (middle >> 32);
+#endif
+        return r;
+    }
+
+    friend u128 operator+(u128 a, u128 b) {
+        u128 r;
+        r.lo = a.lo + b.lo;
+        r.hi = a.hi + b.hi + (r.lo < a.lo ? 1 : 0);
+        return r;
+    }
+
+    u128& operator+=(u128 b) {
+        return *this = *this + b;
+    }
+
+    // 0 < shift < 64
+    friend u128 operator>>(u128 a, int shift) {
+        u128 r;
+        r.lo = (a.lo >> shift) | (a.hi << (64 - shift));
+        r.hi = a.hi >> shift;
+        return r;
+    }
+
+    explicit operator uint64_t() const {
+        return lo;
+    }
+};
+#endif
+
+using Scalar = std::array<byte_t, 32>;
+
+// Field elements mod p = 2^255 - 19 in five 51-bit limbs. fe_mul and fe_sq
+// take limbs below 2^54 and return them just above 2^51; the other helpers
+// carry back to that size, except the _lazy ones used inside point formulas.
+struct Fe {
+    uint64_t v[5];
+};
+
+constexpr uint64_t LIMB_MASK = (uint64_t{1} << 51) - 1;
+
+constexpr Fe FE_ZERO = {{0, 0, 0, 0, 0}};
+constexpr Fe FE_ONE = {{1, 0, 0, 0, 0}};
+// -121665 / 121666, twice that, and 2^((p - 1) / 4)
+constexpr Fe FE_D = {{0x34dca135978a3ULL, 0x1a8283b156ebdULL, 0x5e7a26001c029ULL, 0x739c663a03cbbULL, 0x52036cee2b6ffULL}};
+constexpr Fe FE_D2 = {{0x69b9426b2f159ULL, 0x35050762add7aULL, 0x3cf44c0038052ULL, 0x6738cc7407977ULL, 0x2406d9dc56dffULL}};
+constexpr Fe FE_SQRTM1 = {{0x61b274a0ea0b0ULL, 0xd5a5fc8f189dULL, 0x7ef5e9cbd0c60ULL, 0x78595a6804c9eULL, 0x2b8324804fc1dULL}};
+
+// Group order L, little-endian
+constexpr Scalar GROUP_ORDER = {0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7,
+                                0xa2, 0xde, 0xf9, 0xde, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10};
+
+constexpr byte_t BASE_POINT[32] = {0x58, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+                                   0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+                                   0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66};
+
+uint64_t load_le64(const byte_t* bytes) {
+    uint64_t word = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        word |= uint64_t{bytes[i]} << (8 * i);
+    }
+    return word;
+}
+
+void store_le64(byte_t* bytes, uint64_t word) {
+    for (size_t i = 0; i < 8; ++i) {
+        bytes[i] = static_cast<byte_t>(word >> (8 * i));
+    }
+}
+
+[[gnu::always_inline]] inline Fe fe_carry(Fe a) {
+    for (size_t i = 0; i < 4; ++i) {
+        a.v[i + 1] += a.v[i] >> 51;
+        a.v[i] &= LIMB_MASK;
+    }
+    a.v[0] += 19 * (a.v[4] >> 51);
+    a.v[4] &= LIMB_MASK;
+    return a;
+}
+
+[[gnu::always_inline]] inline Fe fe_add(const Fe& a, const Fe& b) {
+    Fe r;
+    for (size_t i = 0; i < 5; ++i) {
+        r.v[i] = a.v[i] + b.v[i];
+    }
+    return fe_carry(r);
+}
+
+// Adds 2p first so no limb goes negative
+[[gnu::always_inline]] inline Fe fe_sub(const Fe& a, const Fe& b) {
+    Fe r;
+    r.v[0] = a.v[0] + 0xFFFFFFFFFFFDAULL - b.v[0];
+    for (size_t i = 1; i < 5; ++i) {
+        r.v[i] = a.v[i] + 0xFFFFFFFFFFFFEULL - b.v[i];
+    }
+    return fe_carry(r);
+}
+
+[[gnu::always_inline]] inline Fe fe_neg(const Fe& a) {
+    return fe_sub(FE_ZERO, a);
+}
+
+// Uncarried: the result may reach 2^53, so it should only feed fe_mul, fe_sq,
+// or the first operand of another lazy op
+[[gnu::always_inline]] inline Fe fe_add_lazy(const Fe& a, const Fe& b) {
+    Fe r;
+    for (size_t i = 0; i < 5; ++i) {
+        r.v[i] = a.v[i] + b.v[i];
+    }
+    return r;
+}
+
+// b must be carried, i.e. below 2p limb by limb
+[[gnu::always_inline]] inline Fe fe_sub_lazy(const Fe& a, const Fe& b) {
+    Fe r;
+    r.v[0] = a.v[0] + 0xFFFFFFFFFFFDAULL - b.v[0];
+    for (size_t i = 1; i < 5; ++i) {
+        r.v[i] = a.v[i] + 0xFFFFFFFFFFFFEULL - b.v[i];
+    }
+    return r;
+}
+
+[[gnu::always_inline]] inline Fe fe_reduce_product(u128 t0, u128 t1, u128 t2, u128 t3, u128 t4) {
+    Fe r;
+    t1 += t0 >> 51;
+    t2 += t1 >> 51;
+    t3 += t2 >> 51;
+    t4 += t3 >> 51;
+    r.v[0] = static_cast<uint64_t>(t0) & LIMB_MASK;
+    r.v[1] = static_cast<uint64_t>(t1) & LIMB_MASK;
+    r.v[2] = static_cast<uint64_t>(t2) & LIMB_MASK;
+    r.v[3] = static_cast<uint64_t>(t3) & LIMB_MASK;
+    r.v[4] = static_cast<uint64_t>(t4) & LIMB_MASK;
+    r.v[0] += 19 * static_cast<uint64_t>(t4 >> 51);
+    r.v[1] += r.v[0] >> 51;
+    r.v[0] &= LIMB_MASK;
+    return r;
+}
+
+[[gnu::always_inline]] inline Fe fe_mul(const Fe& a, const Fe& b) {
+    const uint64_t b1_19 = 19 * b.v[1];
+    const uint64_t b2_19 = 19 * b.v[2];
+    const uint64_t b3_19 = 19 * b.v[3];
+    const uint64_t b4_19 = 19 * b.v[4];
+    auto m = [](uint64_t x, uint64_t y) { return u128{x} * y; };
+    return fe_reduce_product(
+        m(a.v[0], b.v[0]) + m(a.v[1], b4_19) + m(a.v[2], b3_19) + m(a.v[3], b2_19) + m(a.v[4], b1_19),
+        m(a.v[0], b.v[1]) + m(a.v[1], b.v[0]) + m(a.v[2], b4_19) + m(a.v[3], b3_19) + m(a.v[4], b2_19),
+        m(a.v[0], b.v[2]) + m(a.v[1], b.v[1]) + m(a.v[2], b.v[0]) + m(a.v[3], b4_19) + m(a.v[4], b3_19),
+        m(a.v[0], b.v[3]) + m(a.v[1], b.v[2]) + m(a.v[2], b.v[1]) + m(a.v[3], b.v[0]) + m(a.v[4], b4_19),
+        m(a.v[0], b.v[4]) + m(a.v[1], b.v[3]) + m(a.v[2], b.v[2]) + m(a.v[3], b.v[1]) + m(a.v[4], b.v[0]));
+}
+
+[[gnu::always_inline]] inline Fe fe_sq(const Fe& a) {
+    const uint64_t a0_2 = 2 * a.v[0];
+    const uint64_t a1_2 = 2 * a.v[1];
+    const uint64_t a2_2 = 2 * a.v[2];
+    const uint64_t a3_19 = 19 * a.v[3];
+    const uint64_t a4_19 = 19 * a.v[4];
+    auto m = [](uint64_t x, uint64_t y) { return u128{x} * y; };
+    return fe_reduce_product(
+        m(a.v[0], a.v[0]) + m(a1_2, a4_19) + m(a2_2, a3_19),
+        m(a0_2, a.v[1]) + m(a2_2, a4_19) + m(a.v[3], a3_19),
+        m(a0_2, a.v[2]) + m(a.v[1], a.v[1]) + m(2 * a.v[3], a4_19),
+        m(a0_2, a.v[3]) + m(a1_2, a.v[2]) + m(a.v[4], a4_19),
+        m(a0_2, a.v[4]) + m(a1_2, a.v[3]) + m(a.v[2], a.v[2]));
+}
+
+Fe fe_sq_times(Fe a, int times) {
+    for (int i = 0; i < times; ++i) {
+        a = fe_sq(a);
+    }
+    return a;
+}
+
+// Bit 255 is ignored, as in the encoding
+Fe fe_from_bytes(const byte_t* bytes) {
+    uint64_t w0 = load_le64(bytes);
+    uint64_t w1 = load_le64(bytes + 8);
+    uint64_t w2 = load_le64(bytes + 16);
+    uint64_t w3 = load_le64(bytes + 24);
+    return Fe{{w0 & LIMB_MASK, ((w0 >> 51) | (w1 << 13)) & LIMB_MASK, ((w1 >> 38) | (w2 << 26)) & LIMB_MASK,
+               ((w2 >> 25) | (w3 << 39)) & LIMB_MASK, (w3 >> 12) & LIMB_MASK}};
+}
+
+// Canonical little-endian encoding, fully reduced mod p
+void fe_to_bytes(byte_t* bytes, const Fe& a) {
+    Fe t = fe_carry(fe_carry(a));
+    // q = 1 exactly when t >= p, since then t + 19 reaches 2^255
+    uint64_t q = (t.v[0] + 19) >> 51;
+    for (size_t i = 1; i < 5; ++i) {
+        q = (t.v[i] + q) >> 51;
+    }
+    t.v[0] += 19 * q;
+    for (size_t i = 0; i < 4; ++i) {
+        t.v[i + 1] += t.v[i] >> 51;
+        t.v[i] &= LIMB_MASK;
+    }
+    t.v[4] &= LIMB_MASK;
+    store_le64(bytes, t.v[0] | (t.v[1] << 51));
+    store_le64(bytes + 8, (t.v[1] >> 13) | (t.v[2] << 38));
+    store_le64(bytes + 16, (t.v[2] >> 26) | (t.v[3] << 25));
+    store_le64(bytes + 24, (t.v[3] >> 39) | (t.v[4] << 12));
+}
+
+bool fe_is_zero(const Fe& a) {
+    byte_t bytes[32];
+    fe_to_bytes(bytes, a);
+    return std::all_of(bytes, bytes + 32, [](byte_t b) { return b == 0; });
+}
+
+bool fe_is_negative(const Fe& a) {
+    byte_t bytes[32];
+    fe_to_bytes(bytes, a);
+    return bytes[0] & 1;
+}
+
+// z^((p - 5) / 8) = z^(2^252 - 3)
+Fe fe_pow22523(const Fe& z) {
+    Fe t0 = fe_sq(z);
+    Fe t1 = fe_mul(z, fe_sq_times(t0, 2));    // z^9
+    t0 = fe_mul(t0, t1);                       // z^11
+    t0 = fe_mul(t1, fe_sq(t0));                // z^(2^5 - 1)
+    t0 = fe_mul(fe_sq_times(t0, 5), t0);       // z^(2^10 - 1)
+    t1 = fe_mul(fe_sq_times(t0, 10), t0);      // z^(2^20 - 1)
+    t1 = fe_mul(fe_sq_times(t1, 20), t1);      // z^(2^40 - 1)
+    t0 = fe_mul(fe_sq_times(t1, 10), t0);      // z^(2^50 - 1)
+    t1 = fe_mul(fe_sq_times(t0, 50), t0);      // z^(2^100 - 1)
+    t1 = fe_mul(fe_sq_times(t1, 100), t1);     // z^(2^200 - 1)
+    t0 = fe_mul(fe_sq_times(t1, 50), t0);      // z^(2^250 - 1)
+    return fe_mul(fe_sq_times(t0, 2), z);      // z^(2^252 - 3)
+}
+
+// Extended coordinates: x = X/Z, y = Y/Z, xy = T/Z
+struct Point {
+    Fe X, Y, Z, T;
+};
+
+constexpr Point IDENTITY = {FE_ZERO, FE_ONE, FE_ONE, FE_ZERO};
+
+// An affine point as (y + x, y - x, 2dxy), which makes mixed addition 7M
+struct NielsPoint {
+    Fe y_plus_x, y_minus_x, xy2d;
+};
+
+NielsPoint to_niels(const Fe& x, const Fe& y) {
+    return NielsPoint{fe_add(y, x), fe_sub(y, x), fe_mul(fe_mul(x, y), FE_D2)};
+}
+
+NielsPoint negate(const NielsPoint& p) {
+    return NielsPoint{p.y_minus_x, p.y_plus_x, fe_neg(p.xy2d)};
+}
+
+// Point coordinates always come straight out of fe_mul, so every lazy
+// operand below is either such a coordinate or a single lazy step away
+Point add(const Point& p, const NielsPoint& q) {
+    Fe a = fe_mul(fe_sub_lazy(p.Y, p.X), q.y_minus_x);
+    Fe b = fe_mul(fe_add_lazy(p.Y, p.X), q.y_plus_x);
+    Fe c = fe_mul(p.T, q.xy2d);
+    Fe d = fe_add_lazy(p.Z, p.Z);
+    Fe e = fe_sub_lazy(b, a);
+    Fe f = fe_sub_lazy(d, c);
+    Fe g = fe_add_lazy(d, c);
+    Fe h = fe_add_lazy(b, a);
+    return Point{fe_mul(e, f), fe_mul(g, h), fe_mul(f, g), fe_mul(e, h)};
+}
+
+// add() with -q, whose Niels form swaps y + x and y - x and negates 2dxy
+Point sub(const Point& p, const NielsPoint& q) {
+    Fe a = fe_mul(fe_sub_lazy(p.Y, p.X), q.y_plus_x);
+    Fe b = fe_mul(fe_add_lazy(p.Y, p.X), q.y_minus_x);
+    Fe c = fe_mul(p.T, q.xy2d);
+    Fe d = fe_add_lazy(p.Z, p.Z);
+    Fe e = fe_sub_lazy(b, a);
+    Fe f = fe_add_lazy(d, c);
+    Fe g = fe_sub_lazy(d, c);
+    Fe h = fe_add_lazy(b, a);
+    return Point{fe_mul(e, f), fe_mul(g, h), fe_mul(f, g), fe_mul(e, h)};
+}
+
+Point add(const Point& p, const Point& q) {
+    Fe a = fe_mul(fe_sub_lazy(p.Y, p.X), fe_sub_lazy(q.Y, q.X));
+    Fe b = fe_mul(fe_add_lazy(p.Y, p.X), fe_add_lazy(q.Y, q.X));
+    Fe c = fe_mul(fe_mul(p.T, q.T), FE_D2);
+    Fe zz = fe_mul(p.Z, q.Z);
+    Fe d = fe_add_lazy(zz, zz);
+    Fe e = fe_sub_lazy(b, a);
+    Fe f = fe_sub_lazy(d, c);
+    Fe g = fe_add_lazy(d, c);
+    Fe h = fe_add_lazy(b, a);
+    return Point{fe_mul(e, f), fe_mul(g, h), fe_mul(f, g), fe_mul(e, h)};
+}
+
+Point dbl(const Point& p) {
+    Fe a = fe_sq(p.X);
+    Fe b = fe_sq(p.Y);
+    Fe zz = fe_sq(p.Z);
+    Fe c = fe_add_lazy(zz, zz);
+    Fe h = fe_add_lazy(a, b);
+    Fe e = fe_sub_lazy(h, fe_sq(fe_add_lazy(p.X, p.Y)));
+    Fe g = fe_sub_lazy(a, b);
+    Fe f = fe_add_lazy(c, g);
+    return Point{fe_mul(e, f), fe_mul(g, h), fe_mul(f, g), fe_mul(e, h)};
+}
+
+bool is_identity(const Point& p) {
+    return fe_is_zero(p.X) && fe_is_zero(fe_sub(p.Y, p.Z));
+}
+
+/**
+ * Decodes a point under the ZIP-215 rules
+ *
+ * x = u v^3 (u v^7)^((p - 5) / 8) with u = y^2 - 1 and v = d y^2 + 1, fixed
+ * up by sqrt(-1) when that gives -u / v, and negated to match the sign bit.
+ * Unlike RFC 8032 this accepts y >= p and a set sign bit on x = 0, so every
+ * implementation following ZIP-215 agrees on which encodings are points.
+ */
+bool decode_point(const byte_t* bytes, Fe& x, Fe& y) {
+    y = fe_from_bytes(bytes);
+    Fe y2 = fe_sq(y);
+    Fe u = fe_sub(y2, FE_ONE);
+    Fe v = fe_add(fe_mul(y2, FE_D), FE_ONE);
+    Fe v3 = fe_mul(fe_sq(v), v);
+    Fe v7 = fe_mul(fe_sq(v3), v);
+    x = fe_mul(fe_mul(v3, u), fe_pow22523(fe_mul(v7, u)));
+
+    Fe vxx = fe_mul(v, fe_sq(x));
+    if (!fe_is_zero(fe_sub(vxx, u))) {
+        if (!fe_is_zero(fe_add(vxx, u))) {
+            return false;
+        }
+        x = fe_mul(x, FE_SQRTM1);
+    }
+
+    bool sign = bytes[31] >> 7;
+    if (fe_is_negative(x) != sign) {
+        x = fe_neg(x);
+    }
+    return true;
+}
+
+bool scalar_is_canonical(const byte_t* s) {
+    for (size_t i = 32; i-- > 0;) {
+        if (s[i] != GROUP_ORDER[i]) {
+            return s[i] < GROUP_ORDER[i];
+        }
+    }
+    return false;
+}
+
+/**
+ * Pippenger's bucket method with signed digits
+ *
+ * Each scalar is split into c-bit digits in [-2^(c-1), 2^(c-1)), so a window
+ * needs only 2^(c-1) buckets and a negative digit subtracts the point.
+ * Windows are walked from the top: c doublings, then every point goes into
+ * the bucket of its digit and a running sum weights bucket k by k.
+ */
+Point multi_scalar_mul(const std::vector<NielsPoint>& points, const std::vector<Scalar>& scalars) {
+    const size_t n = points.size();
+
+    // Per window: n mixed additions plus two additions per bucket
+    auto cost = [n](size_t c) { return (256 / c + 1) * (n * 7 + (size_t{1} << (c - 1)) * 18); };
+    size_t c = 2;
+    for (size_t candidate = 3; candidate <= 16; ++candidate) {
+        if (cost(candidate) < cost(c)) {
+            c = candidate;
+        }
+    }
+    const size_t windows = 256 / c + 1;
+    const int radix = 1 << c;
+
+    std::vector<int> digits(n * windows);
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t words[5] = {load_le64(scalars[i].data()), load_le64(scalars[i].data() + 8),
+                             load_le64(scalars[i].data() + 16), load_le64(scalars[i].data() + 24), 0};
+        int carry = 0;
+        for (size_t w = 0; w < windows; ++w) {
+            size_t bit = w * c;
+            uint64_t window = words[bit / 64] >> (bit % 64);
+            if (bit % 64 + c > 64) {
+                window |= words[bit / 64 + 1] << (64 - bit % 64);
+            }
+            int value = static_cast<int>(window & static_cast<uint64_t>(radix - 1)) + carry;
+            carry = value >= radix / 2;
+            digits[i * windows + w] = value - carry * radix;
+        }
+    }
+
+    std::vector<Point> buckets(static_cast<size_t>(radix / 2));
+    Point result = IDENTITY;
+    for (size_t w = windows; w-- > 0;) {
+        if (w + 1 < windows) {
+            for (size_t i = 0; i < c; ++i) {
+                result = dbl(result);
+            }
+        }
+
+        std::fill(buckets.begin(), buckets.end(), IDENTITY);
+        for (size_t i = 0; i < n; ++i) {
+            int digit = digits[i * windows + w];
+            if (digit > 0) {
+                Point& bucket = buckets[static_cast<size_t>(digit - 1)];
+                bucket = add(bucket, points[i]);
+            } else if (digit < 0) {
+                Point& bucket = buckets[static_cast<size_t>(-digit - 1)];
+                bucket = sub(bucket, points[i]);
+            }
+        }
+
+        Point running = IDENTITY;
+        Point window_sum = IDENTITY;
+        for (size_t k = buckets.size(); k-- > 0;) {
+            running = add(running, buckets[k]);
+            window_sum = add(window_sum, running);
+        }
+        result = add(result, window_sum);
+    }
+    return result;
+}
+
+const NielsPoint& base_point() {
+    static const NielsPoint base = [] {
+        Fe x, y;
+        decode_point(BASE_POINT, x, y);
+        return to_niels(x, y);
+    }();
+    return base;
+}
+
+Point negate(const Point& p) {
+    return Point{fe_neg(p.X), p.Y, p.Z, fe_neg(p.T)};
+}
+
+// P, 3P, ..., 15P: every odd digit of a width-5 NAF
+using OddMultiples = std::array<Point, 8>;
+
+OddMultiples odd_multiples(const Point& p) {
+    OddMultiples table;
+    table[0] = p;
+    const Point twice = dbl(p);
+    for (size_t i = 1; i < table.size(); ++i) {
+        table[i] = add(table[i - 1], twice);
+    }
+    return table;
+}
+
+const OddMultiples& base_odd_multiples() {
+    static const OddMultiples table = [] {
+        Fe x, y;
+        decode_point(BASE_POINT, x, y);
+        return odd_multiples(Point{x, y, FE_ONE, fe_mul(x, y)});
+    }();
+    return table;
+}
+
+// Sliding-window signed digits of a scalar below 2^255, each zero or odd in
+// [-15, 15], so only the odd multiples are ever added
+std::array<int8_t, 256> naf_digits(const byte_t* scalar) {
+    std::array<int8_t, 256> digits;
+    for (size_t i = 0; i < 256; ++i) {
+        digits[i] = static_cast<int8_t>((scalar[i / 8] >> (i % 8)) & 1);
+    }
+    for (size_t i = 0; i < 256; ++i) {
+        if (digits[i] == 0) {
+            continue;
+        }
+        for (size_t b = 1; b <= 6 && i + b < 256; ++b) {
+            if (digits[i + b] == 0) {
+                continue;
+            }
+            int shifted = digits[i + b] << b;
+            if (digits[i] + shifted <= 15) {
+                digits[i] = static_cast<int8_t>(digits[i] + shifted);
+                digits[i + b] = 0;
+            } else if (digits[i] - shifted >= -15) {
+                digits[i] = static_cast<int8_t>(digits[i] - shifted);
+                for (size_t k = i + b; k < 256; ++k) {
+                    if (digits[k] == 0) {
+                        digits[k] = 1;
+                        break;
+                    }
+                    digits[k] = 0;
+                }
+            } else {
+                break;
+            }
+        }
+    }
+    return digits;
+}
+
+// [a]P + [b]Q, sharing one chain of doublings between both scalars
+Point double_scalar_mul(const byte_t* a, const OddMultiples& p, const byte_t* b, const OddMultiples& q) {
+    const auto a_digits = naf_digits(a);
+    const auto b_digits = naf_digits(b);
+    auto add_digit = [](Point& result, int digit, const OddMultiples& table) {
+        if (digit > 0) {
+            result = add(result, table[static_cast<size_t>(digit / 2)]);
+        } else if (digit < 0) {
+            result = add(result, negate(table[static_cast<size_t>(-digit / 2)]));
+        }
+    };
+
+    Point result = IDENTITY;
+    size_t i = 256;
+    while (i > 0 && a_digits[i - 1] == 0 && b_digits[i - 1] == 0) {
+        --i;
+    }
+    for (; i-- > 0;) {
+        result = dbl(result);
+        add_digit(result, a_digits[i], p);
+        add_digit(result, b_digits[i], q);
+    }
+    return result;
+}
+
+// h = SHA-512(R || A || M) mod L, over the encodings as received
+Scalar challenge(const Ed25519Signature& signature, const Ed25519PublicKey& public_key, const byte_t* message,
+                 size_t message_len) {
+    SHA512_CTX ctx;
+    SHA512_Init(&ctx);
+    SHA512_Update(&ctx, signature.data(), 32);
+    SHA512_Update(&ctx, public_key.data(), public_key.size());
+    SHA512_Update(&ctx, message, message_len);
+    byte_t digest[SHA512_DIGEST_LENGTH];
+    SHA512_Final(digest, &ctx);
+
+    Scalar h;
+    crypto_core_ed25519_scalar_reduce(h.data(), digest);
+    return h;
+}
+
+struct KeyHash {
+    size_t operator()(const Ed25519PublicKey& key) const noexcept {
+        return std::hash<std::string_view>{}(std::string_view(reinterpret_cast<const char*>(key.data()), key.size()));
+    }
+};
+
+// Validator sets sign every block with the same keys, so -A is kept decoded;
+// keys that do not decode are not stored
+constexpr size_t ED25519_KEY_CACHE_CAPACITY = 4096;
+
+using Ed25519KeyCache = ShardedLruCache<Ed25519PublicKey, NielsPoint, KeyHash>;
+
+Ed25519KeyCache::ValuePtr negated_public_key(const Ed25519PublicKey& public_key) {
+    static Ed25519KeyCache cache(ED25519_KEY_CACHE_CAPACITY);
+    return cache.get_or_create(public_key, [](const Ed25519PublicKey& key) -> Ed25519KeyCache::ValuePtr {
+        Fe x, y;
+        if (!decode_point(key.data(), x, y)) {
+            return nullptr;
+        }
+        return std::make_shared<const NielsPoint>(negate(to_niels(x, y)));
+    });
+}
+
+} // namespace
+
+bool ed25519_batch_equation_holds(std::span<const Signature::Ed25519VerifyItem> items, std::vector<bool>& in_batch) {
+    in_batch.assign(items.size(), false);
+    if (!sodium_ready()) {
+        return false;
+    }
+
+    // Point 0 is B; each R_i and each distinct A follow, both negated
+    std::vector<NielsPoint> points{base_point()};
+    std::vector<Scalar> scalars(1);
+    std::unordered_map<Ed25519PublicKey, size_t, KeyHash> key_terms;
+    points.reserve(2 * items.size() + 1);
+    scalars.reserve(2 * items.size() + 1);
+
+    std::vector<byte_t> randomness(16 * items.size());
+    randombytes_buf(randomness.data(), randomness.size());
+
+    for (size_t i = 0; i < items.size(); ++i) {
+        const auto& item = items[i];
+        const byte_t* s = item.signature.data() + 32;
+        Fe rx, ry;
+        if (!scalar_is_canonical(s) || !decode_point(item.signature.data(), rx, ry)) {
+            continue;
+        }
+
+        // A key that was rejected once keeps term 0, which is never a key term
+        auto [key_term, new_key] = key_terms.try_emplace(item.public_key, points.size());
+        if (new_key) {
+            auto negated_key = negated_public_key(item.public_key);
+            if (!negated_key) {
+                key_term->second = 0;
+                continue;
+            }
+            points.push_back(*negated_key);
+            scalars.emplace_back();
+        } else if (key_term->second == 0) {
+            continue;
+        }
+        in_batch[i] = true;
+
+        Scalar z{};
+        std::copy_n(randomness.begin() + static_cast<std::ptrdiff_t>(16 * i), 16, z.begin());
+        Scalar h = challenge(item.signature, item.public_key, item.message.data(), item.message.size());
+        Scalar term;
+
+        crypto_core_ed25519_scalar_mul(term.data(), z.data(), s);
+        crypto_core_ed25519_scalar_add(scalars[0].data(), scalars[0].data(), term.data());
+        crypto_core_ed25519_scalar_mul(term.data(), z.data(), h.data());
+        Scalar& key_scalar = scalars[key_term->second];
+        crypto_core_ed25519_scalar_add(key_scalar.data(), key_scalar.data(), term.data());
+
+        points.push_back(negate(to_niels(rx, ry)));
+        scalars.push_back(z);
+    }
+
+    // Clearing the cofactor makes the check independent of small-order components
+    Point sum = multi_scalar_mul(points, scalars);
+    return is_identity(dbl(dbl(dbl(sum))));
+}
+
+bool ed25519_verify_zip215(const byte_t* message, size_t message_len, const Ed25519Signature& signature,
+                           const Ed25519PublicKey& public_key) {
+    const byte_t* s = signature.data() + 32;
+    Fe rx, ry;
+    if (!scalar_is_canonical(s) || !decode_point(signature.data(), rx, ry)) {
+        return false;
+    }
+    Fe ax, ay;
+    if (!decode_point(public_key.data(), ax, ay)) {
+        return false;
+    }
+
+    // [8]([s]B - R - [h]A) == 0, the batch equation with a single item
+    const Point negated_key = negate(Point{ax, ay, FE_ONE, fe_mul(ax, ay)});
+    const Scalar h = challenge(signature, public_key, message, message_len);
+    Point sum = double_scalar_mul(s, base_odd_multiples(), h.data(), odd_multiples(negated_key));
+    sum = sub(sum, to_niels(rx, ry));
+    return is_identity(dbl(dbl(dbl(sum))));
+}
+
+} // namespace chainforge::crypto
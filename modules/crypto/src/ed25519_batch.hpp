@@ -0,0 +1,36 @@
+#pragma once
+
+#include "chainforge/crypto/signature.hpp"
+#include <span>
+#include <vector>
+
+namespace chainforge::crypto {
+
+/**
+ * Randomized Ed25519 batch equation
+ *
+ * Checks [8]((sum z_i s_i) B - sum z_i R_i - sum z_i h_i A_i) == 0 for random
+ * 128-bit z_i with a single multi-scalar multiplication; items signed by the
+ * same key share one A term. Items that can never verify (s >= L, or R or A
+ * not a point) are left out and flagged false in in_batch, for the caller to
+ * verify one by one.
+ *
+ * True means every item left in is valid under ed25519_verify_zip215.
+ * False means at least one is not, or this build has no fast path.
+ */
+bool ed25519_batch_equation_holds(std::span<const Signature::Ed25519VerifyItem> items, std::vector<bool>& in_batch);
+
+/**
+ * Single Ed25519 verification under the ZIP-215 rules
+ *
+ * Requires s < L and accepts any encoding of R and A that decodes to a
+ * curve point, including small-order and non-canonical ones, then checks
+ * the same cofactored equation [8]([s]B - R - [h]A) == 0 as the batch.
+ * Batch and single verification therefore accept exactly the same
+ * signatures, which a cofactorless single check cannot guarantee: a
+ * signature with a small-order component would pass one and fail the other.
+ */
+bool ed25519_verify_zip215(const byte_t* message, size_t message_len, const Ed25519Signature& signature,
+                           const Ed25519PublicKey& public_key);
+
+} // namespace chainforge::crypto
@@ -1,11 +1,61 @@
 #include "chainforge/crypto/hash.hpp"
+#include "chainforge/crypto/keccak.hpp"
+#include "sha256_pairs.hpp"
 #include <openssl/sha.h>
 #include <openssl/ripemd.h>
+#include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <sstream>
 
 namespace chainforge::crypto {
 
+namespace {
+
+Sha256PairKernel pair_kernel(Hash::PairBackend backend) noexcept {
+    switch (backend) {
+    case Hash::PairBackend::Avx2: return sha256_pairs_x8_avx2_kernel();
+    case Hash::PairBackend::ShaNi: return sha256_pairs_shani_kernel();
+    case Hash::PairBackend::Scalar: break;
+    }
+    return nullptr;
+}
+
+size_t pair_lanes(Hash::PairBackend backend) noexcept {
+    return backend == Hash::PairBackend::Avx2 ? 8 : 1;
+}
+
+bool cpu_supports(Hash::PairBackend backend) noexcept {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    switch (backend) {
+    case Hash::PairBackend::Avx2: return __builtin_cpu_supports("avx2");
+    case Hash::PairBackend::ShaNi: return __builtin_cpu_supports("sha") && __builtin_cpu_supports("sse4.1");
+    case Hash::PairBackend::Scalar: return true;
+    }
+    return false;
+#else
+    return backend == Hash::PairBackend::Scalar;
+#endif
+}
+
+// The SHA extensions beat eight AVX2 lanes per pair where both exist
+Hash::PairBackend detect_pair_backend() noexcept {
+    for (auto backend : {Hash::PairBackend::ShaNi, Hash::PairBackend::Avx2}) {
+        if (Hash::is_pair_backend_supported(backend)) {
+            return backend;
+        }
+    }
+    return Hash::PairBackend::Scalar;
+}
+
+std::atomic<Hash::PairBackend>& active_pair_backend() noexcept {
+    static std::atomic<Hash::PairBackend> backend{detect_pair_backend()};
+    return backend;
+}
+
+} // namespace
+
 CryptoResult<Hash256> Hash::sha256(const ByteVector& data) {
     return internal_sha256(data.data(), data.size());
 }
@@ -82,6 +132,57 @@ CryptoResult<Hash256> Hash::hash_pair(const Hash256& left, const Hash256& right)
     return sha256(combined);
 }
 
+void Hash::hash_pairs(const Hash256* const* left, const Hash256* const* right, size_t count, Hash256* out) noexcept {
+    PairBackend backend = pair_backend();
+    Sha256PairKernel kernel = pair_kernel(backend);
+    size_t lanes = pair_lanes(backend);
+
+    size_t i = 0;
+    if (kernel) {
+        for (; i + lanes <= count; i += lanes) {
+            kernel(left + i, right + i, out + i);
+        }
+        // Fill a partial group by repeating its first pair; a lone pair is cheaper on the scalar path
+        if (count - i > 1) {
+            const Hash256* group_left[8];
+            const Hash256* group_right[8];
+            Hash256 group_out[8];
+            std::fill(group_left, group_left + lanes, left[i]);
+            std::fill(group_right, group_right + lanes, right[i]);
+            std::copy(left + i, left + count, group_left);
+            std::copy(right + i, right + count, group_right);
+            kernel(group_left, group_right, group_out);
+            std::copy(group_out, group_out + (count - i), out + i);
+            i = count;
+        }
+    }
+    Sha256Hasher hasher;
+    for (; i < count; ++i) {
+        hasher.update(left[i]->data(), left[i]->size());
+        hasher.update(right[i]->data(), right[i]->size());
+        out[i] = hasher.finalize();
+    }
+}
+
+Hash::PairBackend Hash::pair_backend() noexcept {
+    return active_pair_backend().load(std::memory_order_relaxed);
+}
+
+bool Hash::is_pair_backend_supported(PairBackend backend) noexcept {
+    if (backend == PairBackend::Scalar) {
+        return true;
+    }
+    return pair_kernel(backend) != nullptr && cpu_supports(backend);
+}
+
+bool Hash::set_pair_backend(PairBackend backend) noexcept {
+    if (!is_pair_backend_supported(backend)) {
+        return false;
+    }
+    active_pair_backend().store(backend, std::memory_order_relaxed);
+    return true;
+}
+
 CryptoResult<Hash256> Hash::hash_many(const std::vector<Hash256>& hashes) {
     if (hashes.empty()) {
         Hash256 zero_hash{};
@@ -189,9 +290,7 @@ CryptoResult<Hash256> Hash::internal_sha256(const byte_t* data, size_t length) {
 }
 
 CryptoResult<Hash256> Hash::internal_keccak256(const byte_t* data, size_t length) {
-    // TODO: Implement Keccak256 using a proper Keccak library
-    // For now, fall back to SHA256 as placeholder
-    return internal_sha256(data, length);
+    return Keccak::keccak256(data, length);
 }
 
 CryptoResult<Ripemd160Hash> Hash::internal_ripemd160(const byte_t* data, size_t length) {
@@ -213,4 +312,24 @@ CryptoResult<Ripemd160Hash> Hash::internal_ripemd160(const byte_t* data, size_t
     return CryptoResult<Ripemd160Hash>{result, CryptoError::SUCCESS};
 }
 
+static_assert(sizeof(SHA256_CTX) <= sizeof(Sha256Hasher) && alignof(SHA256_CTX) <= alignof(Sha256Hasher),
+              "Sha256Hasher context storage is too small for SHA256_CTX");
+
+void Sha256Hasher::reset() noexcept {
+    SHA256_Init(reinterpret_cast<SHA256_CTX*>(context_.data()));
+}
+
+void Sha256Hasher::update(const byte_t* data, size_t length) noexcept {
+    if (length > 0) {
+        SHA256_Update(reinterpret_cast<SHA256_CTX*>(context_.data()), data, length);
+    }
+}
+
+Hash256 Sha256Hasher::finalize() noexcept {
+    Hash256 digest;
+    SHA256_Final(digest.data(), reinterpret_cast<SHA256_CTX*>(context_.data()));
+    reset();
+    return digest;
+}
+
 } // namespace chainforge::crypto
@@ -1,98 +1,165 @@
 #include "chainforge/crypto/keccak.hpp"
 #include "chainforge/crypto/hash.hpp"
+#include "keccak_f1600.hpp"
+#include <atomic>
 #include <iomanip>
 #include <sstream>
 
 namespace chainforge::crypto {
 
-// StreamHasher implementation
-class Keccak::StreamHasher::Impl {
-public:
-    Impl() = default;
-    ~Impl() = default;
+namespace {
 
-    void update(const ByteVector& data) {
-        buffer_.insert(buffer_.end(), data.begin(), data.end());
-    }
+constexpr bool is_supported_output(size_t output_bits) {
+    return output_bits == 160 || output_bits == 256 || output_bits == 384 || output_bits == 512;
+}
 
-    void update(const byte_t* data, size_t length) {
-        buffer_.insert(buffer_.end(), data, data + length);
+// XOR bytes into the state starting at byte offset, a whole lane at a time where possible
+void xor_into_state(uint64_t* state, size_t offset, const byte_t* data, size_t length) noexcept {
+    while (length > 0 && offset % 8 != 0) {
+        state[offset / 8] ^= uint64_t{*data++} << (8 * (offset % 8));
+        ++offset;
+        --length;
     }
-
-    void update(const std::string& data) {
-        buffer_.insert(buffer_.end(), data.begin(), data.end());
+    for (; length >= 8; offset += 8, data += 8, length -= 8) {
+        state[offset / 8] ^= load_le64(data);
     }
-
-    CryptoResult<Hash256> finalize_256() {
-        return Keccak::keccak256(buffer_);
+    for (; length > 0; ++offset, --length) {
+        state[offset / 8] ^= uint64_t{*data++} << (8 * (offset % 8));
     }
+}
 
-    CryptoResult<std::array<byte_t, 20>> finalize_160() {
-        return Keccak::keccak160(buffer_);
+Keccak256BatchKernel batch_kernel(Keccak::BatchBackend backend) noexcept {
+    switch (backend) {
+    case Keccak::BatchBackend::Avx2: return keccak256_x4_avx2_kernel();
+    case Keccak::BatchBackend::Avx512: return keccak256_x8_avx512_kernel();
+    case Keccak::BatchBackend::Scalar: break;
     }
+    return nullptr;
+}
 
-    CryptoResult<std::array<byte_t, 48>> finalize_384() {
-        return Keccak::keccak384(buffer_);
+size_t batch_lanes(Keccak::BatchBackend backend) noexcept {
+    switch (backend) {
+    case Keccak::BatchBackend::Avx2: return 4;
+    case Keccak::BatchBackend::Avx512: return 8;
+    case Keccak::BatchBackend::Scalar: break;
     }
+    return 1;
+}
 
-    CryptoResult<std::array<byte_t, 64>> finalize_512() {
-        return Keccak::keccak512(buffer_);
+bool cpu_supports(Keccak::BatchBackend backend) noexcept {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    switch (backend) {
+    case Keccak::BatchBackend::Avx2: return __builtin_cpu_supports("avx2");
+    case Keccak::BatchBackend::Avx512: return __builtin_cpu_supports("avx512f");
+    case Keccak::BatchBackend::Scalar: return true;
     }
+    return false;
+#else
+    return backend == Keccak::BatchBackend::Scalar;
+#endif
+}
 
-    void reset() {
-        buffer_.clear();
+Keccak::BatchBackend detect_batch_backend() noexcept {
+    for (auto backend : {Keccak::BatchBackend::Avx512, Keccak::BatchBackend::Avx2}) {
+        if (Keccak::is_batch_backend_supported(backend)) {
+            return backend;
+        }
     }
+    return Keccak::BatchBackend::Scalar;
+}
 
-private:
-    ByteVector buffer_;
-};
+std::atomic<Keccak::BatchBackend>& active_batch_backend() noexcept {
+    static std::atomic<Keccak::BatchBackend> backend{detect_batch_backend()};
+    return backend;
+}
 
-Keccak::StreamHasher::StreamHasher() : impl_(std::make_unique<Impl>()) {}
-Keccak::StreamHasher::~StreamHasher() = default;
+} // namespace
 
-void Keccak::StreamHasher::update(const ByteVector& data) {
-    impl_->update(data);
+// StreamHasher implementation
+Keccak::StreamHasher::StreamHasher(size_t output_bits) noexcept
+    : output_bits_(output_bits),
+      rate_(is_supported_output(output_bits) ? KECCAK_STATE_SIZE - output_bits / 4 : KECCAK256_RATE) {
+    reset();
 }
 
-void Keccak::StreamHasher::update(const byte_t* data, size_t length) {
-    impl_->update(data, length);
+void Keccak::StreamHasher::update(const ByteVector& data) noexcept {
+    update(data.data(), data.size());
 }
 
-void Keccak::StreamHasher::update(const std::string& data) {
-    impl_->update(data);
+void Keccak::StreamHasher::update(const byte_t* data, size_t length) noexcept {
+    while (length > 0) {
+        size_t take = std::min(length, rate_ - offset_);
+        xor_into_state(state_.data(), offset_, data, take);
+        data += take;
+        length -= take;
+        offset_ += take;
+        if (offset_ == rate_) {
+            keccak_f1600<ScalarLanes>(state_.data());
+            offset_ = 0;
+        }
+    }
 }
 
-CryptoResult<Hash256> Keccak::StreamHasher::finalize_256() {
-    return impl_->finalize_256();
+void Keccak::StreamHasher::update(const std::string& data) noexcept {
+    update(reinterpret_cast<const byte_t*>(data.data()), data.size());
 }
 
-CryptoResult<std::array<byte_t, 20>> Keccak::StreamHasher::finalize_160() {
-    return impl_->finalize_160();
+template <size_t N>
+CryptoResult<std::array<byte_t, N>> Keccak::StreamHasher::finalize() noexcept {
+    std::array<byte_t, N> digest{};
+    if (output_bits_ != N * 8) {
+        return CryptoResult<std::array<byte_t, N>>{digest, CryptoError::INVALID_LENGTH};
+    }
+
+    state_[offset_ / 8] ^= uint64_t{0x01} << (8 * (offset_ % 8));
+    state_[(rate_ - 1) / 8] ^= uint64_t{0x80} << (8 * ((rate_ - 1) % 8));
+    keccak_f1600<ScalarLanes>(state_.data());
+
+    // Every supported output fits in one block, so a single squeeze suffices
+    for (size_t i = 0; i < N; i += 8) {
+        byte_t lane[8];
+        store_le64(lane, state_[i / 8]);
+        std::copy(lane, lane + std::min<size_t>(8, N - i), digest.begin() + static_cast<ptrdiff_t>(i));
+    }
+    reset();
+    return CryptoResult<std::array<byte_t, N>>{digest, CryptoError::SUCCESS};
 }
 
-CryptoResult<std::array<byte_t, 48>> Keccak::StreamHasher::finalize_384() {
-    return impl_->finalize_384();
+CryptoResult<Hash256> Keccak::StreamHasher::finalize_256() noexcept {
+    return finalize<32>();
 }
 
-CryptoResult<std::array<byte_t, 64>> Keccak::StreamHasher::finalize_512() {
-    return impl_->finalize_512();
+CryptoResult<std::array<byte_t, 20>> Keccak::StreamHasher::finalize_160() noexcept {
+    return finalize<20>();
 }
 
-void Keccak::StreamHasher::reset() {
-    impl_->reset();
+CryptoResult<std::array<byte_t, 48>> Keccak::StreamHasher::finalize_384() noexcept {
+    return finalize<48>();
+}
+
+CryptoResult<std::array<byte_t, 64>> Keccak::StreamHasher::finalize_512() noexcept {
+    return finalize<64>();
+}
+
+void Keccak::StreamHasher::reset() noexcept {
+    state_.fill(0);
+    offset_ = 0;
 }
 
 // Static Keccak functions
 CryptoResult<Hash256> Keccak::keccak256(const ByteVector& data) {
-    return internal_keccak(data.data(), data.size(), 256);
+    return keccak256(data.data(), data.size());
 }
 
 CryptoResult<Hash256> Keccak::keccak256(const byte_t* data, size_t length) {
-    return internal_keccak(data, length, 256);
+    StreamHasher hasher(256);
+    hasher.update(data, length);
+    return hasher.finalize_256();
 }
 
 CryptoResult<Hash256> Keccak::keccak256(const std::string& data) {
-    return internal_keccak(reinterpret_cast<const byte_t*>(data.data()), data.size(), 256);
+    return keccak256(reinterpret_cast<const byte_t*>(data.data()), data.size());
 }
 
 CryptoResult<std::array<byte_t, 20>> Keccak::keccak160(const ByteVector& data) {
@@ -100,10 +167,9 @@ CryptoResult<std::array<byte_t, 20>> Keccak::keccak160(const ByteVector& data) {
 }
 
 CryptoResult<std::array<byte_t, 20>> Keccak::keccak160(const byte_t* data, size_t length) {
-    auto result = internal_keccak(data, length, 160);
-    std::array<byte_t, 20> output;
-    std::copy(result.value.begin(), result.value.begin() + 20, output.begin());
-    return CryptoResult<std::array<byte_t, 20>>{output, result.error};
+    StreamHasher hasher(160);
+    hasher.update(data, length);
+    return hasher.finalize_160();
 }
 
 CryptoResult<std::array<byte_t, 48>> Keccak::keccak384(const ByteVector& data) {
@@ -111,10 +177,9 @@ CryptoResult<std::array<byte_t, 48>> Keccak::keccak384(const ByteVector& data) {
 }
 
 CryptoResult<std::array<byte_t, 48>> Keccak::keccak384(const byte_t* data, size_t length) {
-    auto result = internal_keccak(data, length, 384);
-    std::array<byte_t, 48> output;
-    std::copy(result.value.begin(), result.value.begin() + 48, output.begin());
-    return CryptoResult<std::array<byte_t, 48>>{output, result.error};
+    StreamHasher hasher(384);
+    hasher.update(data, length);
+    return hasher.finalize_384();
 }
 
 CryptoResult<std::array<byte_t, 64>> Keccak::keccak512(const ByteVector& data) {
@@ -122,10 +187,77 @@ CryptoResult<std::array<byte_t, 64>> Keccak::keccak512(const ByteVector& data) {
 }
 
 CryptoResult<std::array<byte_t, 64>> Keccak::keccak512(const byte_t* data, size_t length) {
-    auto result = internal_keccak(data, length, 512);
-    std::array<byte_t, 64> output;
-    std::copy(result.value.begin(), result.value.begin() + 64, output.begin());
-    return CryptoResult<std::array<byte_t, 64>>{output, result.error};
+    StreamHasher hasher(512);
+    hasher.update(data, length);
+    return hasher.finalize_512();
+}
+
+// Batch hashing
+CryptoResult<void> Keccak::keccak256_many(std::span<const ByteVector> messages, std::span<Hash256> out) {
+    if (out.size() != messages.size()) {
+        return CryptoResult<void>{CryptoError::INVALID_LENGTH};
+    }
+
+    constexpr size_t CHUNK = 64;
+    const byte_t* data[CHUNK];
+    size_t lengths[CHUNK];
+    for (size_t start = 0; start < messages.size(); start += CHUNK) {
+        size_t count = std::min(CHUNK, messages.size() - start);
+        for (size_t i = 0; i < count; ++i) {
+            data[i] = messages[start + i].data();
+            lengths[i] = messages[start + i].size();
+        }
+        keccak256_many(data, lengths, count, out.data() + start);
+    }
+    return CryptoResult<void>{CryptoError::SUCCESS};
+}
+
+void Keccak::keccak256_many(const byte_t* const* data, const size_t* lengths, size_t count, Hash256* out) noexcept {
+    BatchBackend backend = batch_backend();
+    Keccak256BatchKernel kernel = batch_kernel(backend);
+    size_t lanes = batch_lanes(backend);
+
+    size_t i = 0;
+    if (kernel) {
+        for (; i + lanes <= count; i += lanes) {
+            kernel(data + i, lengths + i, out + i);
+        }
+        // Pad a partial group with empty messages; a lone message is cheaper on the scalar path
+        if (count - i > 1) {
+            const byte_t* group_data[8] = {};
+            size_t group_lengths[8] = {};
+            Hash256 group_out[8];
+            std::copy(data + i, data + count, group_data);
+            std::copy(lengths + i, lengths + count, group_lengths);
+            kernel(group_data, group_lengths, group_out);
+            std::copy(group_out, group_out + (count - i), out + i);
+            i = count;
+        }
+    }
+    for (; i < count; ++i) {
+        StreamHasher hasher(256);
+        hasher.update(data[i], lengths[i]);
+        out[i] = hasher.finalize_256().value;
+    }
+}
+
+Keccak::BatchBackend Keccak::batch_backend() noexcept {
+    return active_batch_backend().load(std::memory_order_relaxed);
+}
+
+bool Keccak::is_batch_backend_supported(BatchBackend backend) noexcept {
+    if (backend == BatchBackend::Scalar) {
+        return true;
+    }
+    return batch_kernel(backend) != nullptr && cpu_supports(backend);
+}
+
+bool Keccak::set_batch_backend(BatchBackend backend) noexcept {
+    if (!is_batch_backend_supported(backend)) {
+        return false;
+    }
+    active_batch_backend().store(backend, std::memory_order_relaxed);
+    return true;
 }
 
 // Utility functions
@@ -184,43 +316,20 @@ CryptoResult<Hash256> Keccak::ethereum_signature_hash(const ByteVector& data) {
     return keccak256(message);
 }
 
-// Mining functions (placeholders)
+// Mining functions
 void Keccak::keccak_f800_round(byte_t* state) {
     // TODO: Implement Keccak-f[800] round function
     (void)state; // Suppress unused parameter warning
 }
 
 void Keccak::keccak_f1600_round(byte_t* state) {
-    // TODO: Implement Keccak-f[1600] round function
-    (void)state; // Suppress unused parameter warning
-}
-
-// Internal implementation
-CryptoResult<Hash256> Keccak::internal_keccak(const byte_t* data, size_t length, size_t output_bits) {
-    // TODO: Implement proper Keccak hashing
-    // For now, fall back to SHA256 as placeholder
-    // This should be replaced with a proper Keccak implementation
-
-    if (output_bits == 256) {
-        return Hash::sha256(data, length);
+    uint64_t lanes[KECCAK_STATE_LANES];
+    for (size_t i = 0; i < KECCAK_STATE_LANES; ++i) {
+        lanes[i] = load_le64(state + i * 8);
     }
-
-    // For other output sizes, return truncated/extended SHA256
-    auto sha256_result = Hash::sha256(data, length);
-    if (!sha256_result.success()) {
-        return sha256_result;
-    }
-
-    // Adjust output size
-    if (output_bits < 256) {
-        // Truncate
-        Hash256 truncated{};
-        size_t bytes_to_copy = (output_bits + 7) / 8; // Round up to bytes
-        std::copy(sha256_result.value.begin(), sha256_result.value.begin() + bytes_to_copy, truncated.begin());
-        return CryptoResult<Hash256>{truncated, CryptoError::SUCCESS};
-    } else {
-        // For larger outputs, we'd need to extend, but for now just return SHA256
-        return sha256_result;
+    keccak_f1600<ScalarLanes>(lanes);
+    for (size_t i = 0; i < KECCAK_STATE_LANES; ++i) {
+        store_le64(state + i * 8, lanes[i]);
     }
 }
 
@@ -0,0 +1,58 @@
+// Built with -mavx2 where the compiler supports it; only entered after a
+// runtime CPU check in keccak.cpp
+#include "keccak_f1600.hpp"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace chainforge::crypto {
+
+#if defined(__AVX2__)
+
+namespace {
+
+// Four states, one per 64-bit element of a 256-bit register
+struct Avx2Lanes {
+    using Lane = __m256i;
+
+    static Lane xor2(Lane a, Lane b) noexcept { return _mm256_xor_si256(a, b); }
+    static Lane xor5(Lane a, Lane b, Lane c, Lane d, Lane e) noexcept {
+        return xor2(xor2(xor2(a, b), xor2(c, d)), e);
+    }
+    static Lane chi(Lane a, Lane b, Lane c) noexcept { return _mm256_xor_si256(a, _mm256_andnot_si256(b, c)); }
+    template <int N>
+    static Lane rotl(Lane a) noexcept {
+        if constexpr (N == 0) {
+            return a;
+        } else {
+            return _mm256_or_si256(_mm256_slli_epi64(a, N), _mm256_srli_epi64(a, 64 - N));
+        }
+    }
+    static Lane broadcast(uint64_t word) noexcept { return _mm256_set1_epi64x(static_cast<long long>(word)); }
+    static Lane load(const uint64_t* words) noexcept {
+        return _mm256_load_si256(reinterpret_cast<const __m256i*>(words));
+    }
+    static void store(uint64_t* words, Lane lane) noexcept {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(words), lane);
+    }
+};
+
+void keccak256_x4_avx2(const byte_t* const* data, const size_t* lengths, Hash256* out) {
+    keccak256_lanes<Avx2Lanes, 4>(data, lengths, out);
+}
+
+} // namespace
+
+Keccak256BatchKernel keccak256_x4_avx2_kernel() noexcept {
+    return &keccak256_x4_avx2;
+}
+
+#else
+
+Keccak256BatchKernel keccak256_x4_avx2_kernel() noexcept {
+    return nullptr;
+}
+
+#endif
+
+} // namespace chainforge::crypto
@@ -0,0 +1,58 @@
+// Built with -mavx512f where the compiler supports it; only entered after a
+// runtime CPU check in keccak.cpp
+#include "keccak_f1600.hpp"
+#if defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+namespace chainforge::crypto {
+
+#if defined(__AVX512F__)
+
+namespace {
+
+// Eight states per 512-bit register. vpternlogq folds the five-way theta XOR
+// and chi into fewer instructions, and vprolq rotates in one.
+struct Avx512Lanes {
+    using Lane = __m512i;
+
+    static Lane xor2(Lane a, Lane b) noexcept { return _mm512_xor_si512(a, b); }
+    static Lane xor5(Lane a, Lane b, Lane c, Lane d, Lane e) noexcept {
+        return _mm512_ternarylogic_epi64(_mm512_ternarylogic_epi64(a, b, c, 0x96), d, e, 0x96);
+    }
+    // 0xD2 is a ^ (~b & c)
+    static Lane chi(Lane a, Lane b, Lane c) noexcept { return _mm512_ternarylogic_epi64(a, b, c, 0xD2); }
+    template <int N>
+    static Lane rotl(Lane a) noexcept {
+        if constexpr (N == 0) {
+            return a;
+        } else {
+            // The zero-masked form is the same vprolq; GCC's unmasked wrapper
+            // trips -Wuninitialized on its undefined passthrough operand
+            return _mm512_maskz_rol_epi64(0xFF, a, N);
+        }
+    }
+    static Lane broadcast(uint64_t word) noexcept { return _mm512_set1_epi64(static_cast<long long>(word)); }
+    static Lane load(const uint64_t* words) noexcept { return _mm512_load_si512(words); }
+    static void store(uint64_t* words, Lane lane) noexcept { _mm512_store_si512(words, lane); }
+};
+
+void keccak256_x8_avx512(const byte_t* const* data, const size_t* lengths, Hash256* out) {
+    keccak256_lanes<Avx512Lanes, 8>(data, lengths, out);
+}
+
+} // namespace
+
+Keccak256BatchKernel keccak256_x8_avx512_kernel() noexcept {
+    return &keccak256_x8_avx512;
+}
+
+#else
+
+Keccak256BatchKernel keccak256_x8_avx512_kernel() noexcept {
+    return nullptr;
+}
+
+#endif
+
+} // namespace chainforge::crypto
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "chainforge/crypto/types.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+namespace chainforge::crypto {
+
+constexpr size_t KECCAK_STATE_LANES = 25;
+constexpr size_t KECCAK_STATE_SIZE = KECCAK_STATE_LANES * 8;
+constexpr size_t KECCAK256_RATE = KECCAK_STATE_SIZE - 2 * KECCAK256_SIZE;
+
+// Batch kernels hash exactly 4 (AVX2) or 8 (AVX-512) messages per call.
+// The getters return nullptr when the build has no code for that
+// instruction set; callers must still check the CPU before calling.
+using Keccak256BatchKernel = void (*)(const byte_t* const* data, const size_t* lengths, Hash256* out);
+Keccak256BatchKernel keccak256_x4_avx2_kernel() noexcept;
+Keccak256BatchKernel keccak256_x8_avx512_kernel() noexcept;
+
+// Everything below has internal linkage on purpose: the batch kernels live in
+// translation units built with -mavx2 / -mavx512f, and a shared inline
+// definition could let the linker keep their copy for the scalar path.
+namespace {
+
+constexpr std::array<uint64_t, 24> KECCAK_ROUND_CONSTANTS = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+    0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+    0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+    0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+    0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+    0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+};
+
+// rho rotation for lane x + 5y
+constexpr std::array<int, KECCAK_STATE_LANES> KECCAK_RHO_OFFSETS = {
+     0,  1, 62, 28, 27,
+    36, 44,  6, 55, 20,
+     3, 10, 43, 25, 39,
+    41, 45, 15, 21,  8,
+    18,  2, 61, 56, 14,
+};
+
+// pi moves lane (x, y) to (y, 2x + 3y)
+constexpr size_t keccak_pi_target(size_t lane) {
+    size_t x = lane % 5;
+    size_t y = lane / 5;
+    return y + 5 * ((2 * x + 3 * y) % 5);
+}
+
+inline uint64_t load_le64(const byte_t* bytes) noexcept {
+    uint64_t word = 0;
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(&word, bytes, 8);
+    } else {
+        for (size_t i = 0; i < 8; ++i) {
+            word |= uint64_t{bytes[i]} << (8 * i);
+        }
+    }
+    return word;
+}
+
+inline void store_le64(byte_t* bytes, uint64_t word) noexcept {
+    if constexpr (std::endian::native == std::endian::little) {
+        std::memcpy(bytes, &word, 8);
+    } else {
+        for (size_t i = 0; i < 8; ++i) {
+            bytes[i] = static_cast<byte_t>(word >> (8 * i));
+        }
+    }
+}
+
+// One state in general-purpose registers
+struct ScalarLanes {
+    using Lane = uint64_t;
+
+    static Lane xor2(Lane a, Lane b) noexcept { return a ^ b; }
+    static Lane xor5(Lane a, Lane b, Lane c, Lane d, Lane e) noexcept { return a ^ b ^ c ^ d ^ e; }
+    // a ^ (~b & c)
+    static Lane chi(Lane a, Lane b, Lane c) noexcept { return a ^ (~b & c); }
+    template <int N>
+    static Lane rotl(Lane a) noexcept { return std::rotl(a, N); }
+    static Lane broadcast(uint64_t word) noexcept { return word; }
+};
+
+// The round pieces are forced inline: left to itself GCC -O2 outlines the
+// 25-lane body and the whole state round-trips through memory every round
+template <typename Ops, size_t... X>
+[[gnu::always_inline]] inline void keccak_theta(const typename Ops::Lane* a, typename Ops::Lane* d, std::index_sequence<X...>) noexcept {
+    typename Ops::Lane c[5] = {Ops::xor5(a[X], a[X + 5], a[X + 10], a[X + 15], a[X + 20])...};
+    ((d[X] = Ops::xor2(c[(X + 4) % 5], Ops::template rotl<1>(c[(X + 1) % 5]))), ...);
+}
+
+template <typename Ops, size_t... I>
+[[gnu::always_inline]] inline void keccak_rho_pi_chi(typename Ops::Lane* a, const typename Ops::Lane* d, std::index_sequence<I...>) noexcept {
+    typename Ops::Lane b[KECCAK_STATE_LANES];
+    ((b[keccak_pi_target(I)] = Ops::template rotl<KECCAK_RHO_OFFSETS[I]>(Ops::xor2(a[I], d[I % 5]))), ...);
+    ((a[I] = Ops::chi(b[I], b[I / 5 * 5 + (I + 1) % 5], b[I / 5 * 5 + (I + 2) % 5])), ...);
+}
+
+// Keccak-f[1600]; the index sequences unroll each round completely
+template <typename Ops>
+inline void keccak_f1600(typename Ops::Lane* state) noexcept {
+    for (uint64_t round_constant : KECCAK_ROUND_CONSTANTS) {
+        typename Ops::Lane d[5];
+        keccak_theta<Ops>(state, d, std::make_index_sequence<5>{});
+        keccak_rho_pi_chi<Ops>(state, d, std::make_index_sequence<KECCAK_STATE_LANES>{});
+        // iota
+        state[0] = Ops::xor2(state[0], Ops::broadcast(round_constant));
+    }
+}
+
+/**
+ * Keccak-256 of Lanes independent messages, one per vector lane
+ *
+ * Ops supplies the vector type plus load/store of Lanes words. Messages may
+ * differ in length: each lane absorbs its own blocks and its digest is taken
+ * right after its final block, while lanes that are already done absorb zeros.
+ */
+template <typename Ops, size_t Lanes>
+inline void keccak256_lanes(const byte_t* const* data, const size_t* lengths, Hash256* out) noexcept {
+    using Lane = typename Ops::Lane;
+
+    Lane state[KECCAK_STATE_LANES];
+    for (auto& lane : state) {
+        lane = Ops::broadcast(0);
+    }
+
+    // Final blocks with the 0x01 ... 0x80 padding already applied
+    alignas(64) byte_t tails[Lanes][KECCAK256_RATE] = {};
+    size_t blocks[Lanes];
+    size_t max_blocks = 0;
+    for (size_t i = 0; i < Lanes; ++i) {
+        blocks[i] = lengths[i] / KECCAK256_RATE + 1;
+        max_blocks = std::max(max_blocks, blocks[i]);
+        size_t tail = lengths[i] % KECCAK256_RATE;
+        if (tail > 0) {
+            std::memcpy(tails[i], data[i] + (blocks[i] - 1) * KECCAK256_RATE, tail);
+        }
+        tails[i][tail] ^= 0x01;
+        tails[i][KECCAK256_RATE - 1] ^= 0x80;
+    }
+
+    alignas(64) uint64_t words[Lanes];
+    for (size_t block = 0; block < max_blocks; ++block) {
+        const byte_t* sources[Lanes];
+        for (size_t i = 0; i < Lanes; ++i) {
+            if (block + 1 < blocks[i]) {
+                sources[i] = data[i] + block * KECCAK256_RATE;
+            } else {
+                sources[i] = block + 1 == blocks[i] ? tails[i] : nullptr;
+            }
+        }
+
+        for (size_t w = 0; w < KECCAK256_RATE / 8; ++w) {
+            for (size_t i = 0; i < Lanes; ++i) {
+                words[i] = sources[i] ? load_le64(sources[i] + w * 8) : 0;
+            }
+            state[w] = Ops::xor2(state[w], Ops::load(words));
+        }
+        keccak_f1600<Ops>(state);
+
+        bool any_done = false;
+        for (size_t i = 0; i < Lanes; ++i) {
+            any_done |= blocks[i] == block + 1;
+        }
+        if (!any_done) {
+            continue;
+        }
+        alignas(64) uint64_t digest_words[4][Lanes];
+        for (size_t w = 0; w < 4; ++w) {
+            Ops::store(digest_words[w], state[w]);
+        }
+        for (size_t i = 0; i < Lanes; ++i) {
+            if (blocks[i] == block + 1) {
+                for (size_t w = 0; w < 4; ++w) {
+                    store_le64(out[i].data() + w * 8, digest_words[w][i]);
+                }
+            }
+        }
+    }
+}
+
+} // namespace
+
+} // namespace chainforge::crypto
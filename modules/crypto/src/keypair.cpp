@@ -1,16 +1,32 @@
 #include "chainforge/crypto/keypair.hpp"
 #include "chainforge/crypto/random.hpp"
 #include "chainforge/crypto/hash.hpp"
+#include "bls12_381.hpp"
+#include "sodium_support.hpp"
 #include <openssl/ec.h>
 #include <openssl/bn.h>
 #include <openssl/obj_mac.h>
-#include <sodium.h>
 #include <secp256k1.h>
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 
 namespace chainforge::crypto {
 
+namespace {
+
+// Public keys are stored as x || y; libsecp256k1 parses and writes the
+// 65-byte SEC1 form, which carries a 0x04 prefix
+int parse_secp256k1_public_key(const secp256k1_context* ctx, secp256k1_pubkey* pubkey,
+                               const Secp256k1PublicKey& public_key) {
+    byte_t encoded[1 + SECP256K1_PUBLIC_KEY_SIZE];
+    encoded[0] = 0x04;
+    std::copy(public_key.begin(), public_key.end(), encoded + 1);
+    return secp256k1_ec_pubkey_parse(ctx, pubkey, encoded, sizeof(encoded));
+}
+
+} // namespace
+
 CryptoResult<KeyPair::Secp256k1KeyPair> KeyPair::generate_secp256k1() {
     auto private_key_result = Random::generate_secp256k1_private_key();
     if (!private_key_result.success()) {
@@ -47,7 +63,7 @@ CryptoResult<Secp256k1CompressedPublicKey> KeyPair::compress_secp256k1_public_ke
     }
 
     secp256k1_pubkey pubkey;
-    int parse_result = secp256k1_ec_pubkey_parse(ctx, &pubkey, public_key.data(), public_key.size());
+    int parse_result = parse_secp256k1_public_key(ctx, &pubkey, public_key);
 
     if (parse_result != 1) {
         secp256k1_context_destroy(ctx);
@@ -81,16 +97,19 @@ CryptoResult<Secp256k1PublicKey> KeyPair::decompress_secp256k1_public_key(const
         return CryptoResult<Secp256k1PublicKey>{Secp256k1PublicKey{}, CryptoError::INVALID_KEY};
     }
 
-    Secp256k1PublicKey uncompressed;
-    size_t uncompressed_size = uncompressed.size();
-    int serialize_result = secp256k1_ec_pubkey_serialize(ctx, uncompressed.data(), &uncompressed_size, &pubkey, SECP256K1_EC_UNCOMPRESSED);
+    byte_t encoded[1 + SECP256K1_PUBLIC_KEY_SIZE];
+    size_t encoded_size = sizeof(encoded);
+    int serialize_result = secp256k1_ec_pubkey_serialize(ctx, encoded, &encoded_size, &pubkey, SECP256K1_EC_UNCOMPRESSED);
 
     secp256k1_context_destroy(ctx);
 
-    if (serialize_result != 1) {
+    if (serialize_result != 1 || encoded_size != sizeof(encoded)) {
         return CryptoResult<Secp256k1PublicKey>{Secp256k1PublicKey{}, CryptoError::INVALID_KEY};
     }
 
+    // Drop the 0x04 prefix
+    Secp256k1PublicKey uncompressed;
+    std::copy(encoded + 1, encoded + sizeof(encoded), uncompressed.begin());
     return CryptoResult<Secp256k1PublicKey>{uncompressed, CryptoError::SUCCESS};
 }
 
@@ -157,7 +176,7 @@ bool KeyPair::is_valid_secp256k1_public_key(const Secp256k1PublicKey& public_key
     if (!ctx) return false;
 
     secp256k1_pubkey pubkey;
-    bool result = secp256k1_ec_pubkey_parse(ctx, &pubkey, public_key.data(), public_key.size()) == 1;
+    bool result = parse_secp256k1_public_key(ctx, &pubkey, public_key) == 1;
     secp256k1_context_destroy(ctx);
     return result;
 }
@@ -183,16 +202,30 @@ bool KeyPair::is_valid_ed25519_public_key(const Ed25519PublicKey& public_key) {
     return public_key.size() == ED25519_PUBLIC_KEY_SIZE;
 }
 
+#ifdef CHAINFORGE_HAVE_BLST
 bool KeyPair::is_valid_bls_private_key(const BlsPrivateKey& private_key) {
-    // BLS private keys are 32 bytes, always "valid" if not zero
-    return private_key != BlsPrivateKey{};
+    blst_scalar scalar;
+    bool valid = bls_decode_secret_key(private_key, scalar);
+    sodium_memzero(&scalar, sizeof(scalar));
+    return valid;
 }
 
 bool KeyPair::is_valid_bls_public_key(const BlsPublicKey& public_key) {
-    // BLS public keys are 48 bytes, basic size check
-    return public_key.size() == BLS_PUBLIC_KEY_SIZE;
+    return bls_decode_public_key(public_key) != nullptr;
+}
+#else
+// Without blst no BLS key can be checked, so none is accepted
+bool KeyPair::is_valid_bls_private_key(const BlsPrivateKey& private_key) {
+    (void)private_key; // Suppress unused parameter warnings
+    return false;
 }
 
+bool KeyPair::is_valid_bls_public_key(const BlsPublicKey& public_key) {
+    (void)public_key; // Suppress unused parameter warnings
+    return false;
+}
+#endif
+
 // Hex conversion functions
 std::string KeyPair::secp256k1_private_key_to_hex(const Secp256k1PrivateKey& key) {
     std::stringstream ss;
@@ -399,47 +432,61 @@ CryptoResult<Secp256k1PublicKey> KeyPair::internal_derive_secp256k1_public_key(c
     }
     BN_free(priv_bn);
 
-    // Generate public key
-    if (!EC_KEY_generate_key(ec_key)) {
+    // Public key = private key * G
+    const EC_GROUP* group = EC_KEY_get0_group(ec_key);
+    EC_POINT* pub_point = EC_POINT_new(group);
+    if (!pub_point || !EC_POINT_mul(group, pub_point, EC_KEY_get0_private_key(ec_key), nullptr, nullptr, nullptr)) {
+        EC_POINT_free(pub_point);
         EC_KEY_free(ec_key);
         return CryptoResult<Secp256k1PublicKey>{Secp256k1PublicKey{}, CryptoError::INVALID_KEY};
     }
 
-    // Serialize public key to uncompressed format
-    const EC_POINT* pub_point = EC_KEY_get0_public_key(ec_key);
-    const EC_GROUP* group = EC_KEY_get0_group(ec_key);
-
-    Secp256k1PublicKey public_key;
+    // Serialize uncompressed and drop the 0x04 prefix
+    byte_t encoded[1 + SECP256K1_PUBLIC_KEY_SIZE];
     size_t key_size = EC_POINT_point2oct(group, pub_point, POINT_CONVERSION_UNCOMPRESSED,
-                                        public_key.data(), public_key.size(), nullptr);
+                                        encoded, sizeof(encoded), nullptr);
 
+    EC_POINT_free(pub_point);
     EC_KEY_free(ec_key);
 
-    if (key_size != public_key.size()) {
+    if (key_size != sizeof(encoded)) {
         return CryptoResult<Secp256k1PublicKey>{Secp256k1PublicKey{}, CryptoError::INVALID_KEY};
     }
 
+    Secp256k1PublicKey public_key;
+    std::copy(encoded + 1, encoded + sizeof(encoded), public_key.begin());
     return CryptoResult<Secp256k1PublicKey>{public_key, CryptoError::SUCCESS};
 }
 
 CryptoResult<Ed25519PublicKey> KeyPair::internal_derive_ed25519_public_key(const Ed25519PrivateKey& private_key) {
-    if (sodium_init() == -1) {
+    if (!sodium_ready()) {
         return CryptoResult<Ed25519PublicKey>{Ed25519PublicKey{}, CryptoError::INVALID_KEY};
     }
 
+    // The private key is the seed; sk_to_pk would read a 64-byte secret key
     Ed25519PublicKey public_key;
-    crypto_sign_ed25519_sk_to_pk(public_key.data(), private_key.data());
+    byte_t secret_key[crypto_sign_ed25519_SECRETKEYBYTES];
+    crypto_sign_ed25519_seed_keypair(public_key.data(), secret_key, private_key.data());
+    sodium_memzero(secret_key, sizeof(secret_key));
 
     return CryptoResult<Ed25519PublicKey>{public_key, CryptoError::SUCCESS};
 }
 
 CryptoResult<BlsPublicKey> KeyPair::internal_derive_bls_public_key(const BlsPrivateKey& private_key) {
-    // BLS implementation not available - stub implementation
-    // In a real implementation, this would use blst or another BLS library
-    BlsPublicKey public_key{};
-    // Copy some data to make it look like a public key for testing
-    std::copy(private_key.begin(), private_key.begin() + std::min(private_key.size(), public_key.size()), public_key.begin());
-    return CryptoResult<BlsPublicKey>{public_key, CryptoError::SUCCESS};
+#ifndef CHAINFORGE_HAVE_BLST
+    (void)private_key; // Suppress unused parameter warnings
+    return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::UNSUPPORTED_ALGORITHM};
+#else
+    blst_scalar scalar;
+    if (!bls_decode_secret_key(private_key, scalar)) {
+        sodium_memzero(&scalar, sizeof(scalar));
+        return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::INVALID_KEY};
+    }
+    blst_p1 public_key;
+    blst_sk_to_pk_in_g1(&public_key, &scalar);
+    sodium_memzero(&scalar, sizeof(scalar));
+    return CryptoResult<BlsPublicKey>{bls_encode_g1(public_key), CryptoError::SUCCESS};
+#endif
 }
 
 } // namespace chainforge::crypto
@@ -0,0 +1,143 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace chainforge::crypto {
+
+struct LruCacheCounters {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t size = 0;
+    size_t capacity = 0;
+};
+
+/**
+ * Bounded LRU map shared between threads
+ *
+ * Keys are spread over a fixed number of shards, each with its own mutex,
+ * list and index, so concurrent lookups of different keys rarely contend.
+ * Recency and the capacity bound are per shard. Values are handed out as
+ * shared_ptr<const Value>: an entry evicted while another thread still uses
+ * it stays alive until that thread lets go.
+ */
+template <typename Key, typename Value, typename Hash, size_t Shards = 16>
+class ShardedLruCache {
+public:
+    using ValuePtr = std::shared_ptr<const Value>;
+
+    explicit ShardedLruCache(size_t capacity) { set_capacity(capacity); }
+
+    ShardedLruCache(const ShardedLruCache&) = delete;
+    ShardedLruCache& operator=(const ShardedLruCache&) = delete;
+
+    /**
+     * Cached value for key, or make(key) on a miss
+     *
+     * make runs without the shard lock held, so two threads missing on the
+     * same key may both build it; the first insert wins. A null result is
+     * returned but not cached.
+     */
+    template <typename Make>
+    ValuePtr get_or_create(const Key& key, Make&& make) {
+        const size_t hash = Hash{}(key);
+        Shard& shard = shards_[hash % Shards];
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto found = shard.index.find(key);
+            if (found != shard.index.end()) {
+                shard.entries.splice(shard.entries.begin(), shard.entries, found->second);
+                ++shard.hits;
+                return found->second->second;
+            }
+            ++shard.misses;
+        }
+
+        ValuePtr value = make(key);
+        if (!value) {
+            return value;
+        }
+
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        const size_t limit = shard_capacity_.load(std::memory_order_relaxed);
+        if (limit == 0) {
+            return value;
+        }
+        auto [slot, inserted] = shard.index.try_emplace(key);
+        if (!inserted) {
+            return slot->second->second;
+        }
+        shard.entries.emplace_front(key, value);
+        slot->second = shard.entries.begin();
+        shard.evict_to(limit);
+        return value;
+    }
+
+    // Capacity 0 turns caching off; lookups then always call make
+    void set_capacity(size_t capacity) {
+        const size_t limit = (capacity + Shards - 1) / Shards;
+        shard_capacity_.store(limit, std::memory_order_relaxed);
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.evict_to(limit);
+        }
+    }
+
+    size_t capacity() const { return shard_capacity_.load(std::memory_order_relaxed) * Shards; }
+
+    // Drops every entry and zeroes the counters
+    void clear() {
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.index.clear();
+            shard.entries.clear();
+            shard.hits = shard.misses = shard.evictions = 0;
+        }
+    }
+
+    LruCacheCounters counters() const {
+        LruCacheCounters total;
+        for (const auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total.hits += shard.hits;
+            total.misses += shard.misses;
+            total.evictions += shard.evictions;
+            total.size += shard.index.size();
+        }
+        total.capacity = capacity();
+        return total;
+    }
+
+private:
+    using Entry = std::pair<Key, ValuePtr>;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::list<Entry> entries;  // Most recently used first
+        std::unordered_map<Key, typename std::list<Entry>::iterator, Hash> index;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+
+        void evict_to(size_t limit) {
+            while (index.size() > limit) {
+                index.erase(entries.back().first);
+                entries.pop_back();
+                ++evictions;
+            }
+        }
+    };
+
+    std::array<Shard, Shards> shards_;
+    std::atomic<size_t> shard_capacity_{0};
+};
+
+} // namespace chainforge::crypto
@@ -1,4 +1,8 @@
 #include "chainforge/crypto/random.hpp"
+#include <sodium.h>
+#ifdef CHAINFORGE_HAVE_BLST
+#include <blst.h>
+#endif
 #include <algorithm>
 #include <stdexcept>
 
@@ -84,12 +88,26 @@ CryptoResult<Ed25519PrivateKey> Random::generate_ed25519_private_key() {
 }
 
 CryptoResult<BlsPrivateKey> Random::generate_bls_private_key() {
-    BlsPrivateKey result;
-    auto fill_result = fill_bytes(result.data(), result.size());
+#ifndef CHAINFORGE_HAVE_BLST
+    // Built without blst
+    return CryptoResult<BlsPrivateKey>{BlsPrivateKey{}, CryptoError::UNSUPPORTED_ALGORITHM};
+#else
+    // Over half of all 32-byte strings are >= r, so derive the scalar from
+    // random key material with the IETF KeyGen instead of using it directly
+    std::array<byte_t, 32> key_material;
+    auto fill_result = fill_bytes(key_material.data(), key_material.size());
     if (!fill_result.success()) {
         return CryptoResult<BlsPrivateKey>{BlsPrivateKey{}, fill_result.error};
     }
+
+    blst_scalar scalar;
+    blst_keygen(&scalar, key_material.data(), key_material.size());
+    BlsPrivateKey result;
+    blst_bendian_from_scalar(result.data(), &scalar);
+    sodium_memzero(key_material.data(), key_material.size());
+    sodium_memzero(&scalar, sizeof(scalar));
     return CryptoResult<BlsPrivateKey>{result, CryptoError::SUCCESS};
+#endif
 }
 
 CryptoResult<uint64_t> Random::generate_uint64() {
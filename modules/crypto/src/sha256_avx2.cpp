@@ -0,0 +1,112 @@
+// Built with -mavx2 where the compiler supports it; only entered after a
+// runtime CPU check in hash.cpp
+#include "sha256_pairs.hpp"
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace chainforge::crypto {
+
+#if defined(__AVX2__)
+
+namespace {
+
+// Eight messages, one per 32-bit element of a 256-bit register
+using Words = __m256i;
+
+Words add(Words a, Words b) noexcept { return _mm256_add_epi32(a, b); }
+Words broadcast(uint32_t word) noexcept { return _mm256_set1_epi32(static_cast<int>(word)); }
+
+template <int N>
+Words rotr(Words x) noexcept {
+    return _mm256_or_si256(_mm256_srli_epi32(x, N), _mm256_slli_epi32(x, 32 - N));
+}
+
+Words big_sigma0(Words a) noexcept { return _mm256_xor_si256(_mm256_xor_si256(rotr<2>(a), rotr<13>(a)), rotr<22>(a)); }
+Words big_sigma1(Words e) noexcept { return _mm256_xor_si256(_mm256_xor_si256(rotr<6>(e), rotr<11>(e)), rotr<25>(e)); }
+Words small_sigma0(Words w) noexcept {
+    return _mm256_xor_si256(_mm256_xor_si256(rotr<7>(w), rotr<18>(w)), _mm256_srli_epi32(w, 3));
+}
+Words small_sigma1(Words w) noexcept {
+    return _mm256_xor_si256(_mm256_xor_si256(rotr<17>(w), rotr<19>(w)), _mm256_srli_epi32(w, 10));
+}
+
+void round(Words (&s)[8], Words schedule_plus_constant) noexcept {
+    Words ch = _mm256_xor_si256(_mm256_and_si256(s[4], s[5]), _mm256_andnot_si256(s[4], s[6]));
+    Words maj = _mm256_or_si256(_mm256_and_si256(s[0], s[1]), _mm256_and_si256(s[2], _mm256_or_si256(s[0], s[1])));
+    Words t1 = add(add(add(s[7], big_sigma1(s[4])), ch), schedule_plus_constant);
+    Words t2 = add(big_sigma0(s[0]), maj);
+    s[7] = s[6];
+    s[6] = s[5];
+    s[5] = s[4];
+    s[4] = add(s[3], t1);
+    s[3] = s[2];
+    s[2] = s[1];
+    s[1] = s[0];
+    s[0] = add(t1, t2);
+}
+
+void sha256_pairs_x8_avx2(const Hash256* const* left, const Hash256* const* right, Hash256* out) {
+    // Message words transposed so that w[t] holds word t of every lane
+    Words w[16];
+    for (size_t t = 0; t < 16; ++t) {
+        const Hash256* const* half = t < 8 ? left : right;
+        size_t offset = 4 * (t % 8);
+        w[t] = _mm256_setr_epi32(static_cast<int>(sha256_load_be32(half[0]->data() + offset)),
+                                 static_cast<int>(sha256_load_be32(half[1]->data() + offset)),
+                                 static_cast<int>(sha256_load_be32(half[2]->data() + offset)),
+                                 static_cast<int>(sha256_load_be32(half[3]->data() + offset)),
+                                 static_cast<int>(sha256_load_be32(half[4]->data() + offset)),
+                                 static_cast<int>(sha256_load_be32(half[5]->data() + offset)),
+                                 static_cast<int>(sha256_load_be32(half[6]->data() + offset)),
+                                 static_cast<int>(sha256_load_be32(half[7]->data() + offset)));
+    }
+
+    Words s[8];
+    for (size_t i = 0; i < 8; ++i) {
+        s[i] = broadcast(SHA256_INITIAL_STATE[i]);
+    }
+
+    // First block: the message itself, with the schedule extended in a 16-word window
+    for (size_t t = 0; t < 64; ++t) {
+        if (t >= 16) {
+            w[t % 16] = add(add(w[t % 16], small_sigma0(w[(t + 1) % 16])),
+                            add(w[(t + 9) % 16], small_sigma1(w[(t + 14) % 16])));
+        }
+        round(s, add(w[t % 16], broadcast(SHA256_ROUND_CONSTANTS[t])));
+    }
+    Words middle[8];
+    for (size_t i = 0; i < 8; ++i) {
+        middle[i] = add(s[i], broadcast(SHA256_INITIAL_STATE[i]));
+        s[i] = middle[i];
+    }
+
+    // Second block: the fixed padding
+    for (size_t t = 0; t < 64; ++t) {
+        round(s, broadcast(SHA256_PADDING_BLOCK_SCHEDULE[t]));
+    }
+
+    alignas(32) uint32_t words[8];
+    for (size_t i = 0; i < 8; ++i) {
+        _mm256_store_si256(reinterpret_cast<__m256i*>(words), add(s[i], middle[i]));
+        for (size_t lane = 0; lane < 8; ++lane) {
+            sha256_store_be32(out[lane].data() + 4 * i, words[lane]);
+        }
+    }
+}
+
+} // namespace
+
+Sha256PairKernel sha256_pairs_x8_avx2_kernel() noexcept {
+    return &sha256_pairs_x8_avx2;
+}
+
+#else
+
+Sha256PairKernel sha256_pairs_x8_avx2_kernel() noexcept {
+    return nullptr;
+}
+
+#endif
+
+} // namespace chainforge::crypto
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "chainforge/crypto/types.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace chainforge::crypto {
+
+// Pair kernels hash exactly 8 (AVX2) or 1 (SHA extensions) left || right
+// messages per call. The getters return nullptr when the build has no code
+// for that instruction set; callers must still check the CPU before calling.
+using Sha256PairKernel = void (*)(const Hash256* const* left, const Hash256* const* right, Hash256* out);
+Sha256PairKernel sha256_pairs_x8_avx2_kernel() noexcept;
+Sha256PairKernel sha256_pairs_shani_kernel() noexcept;
+
+// Internal linkage for the same reason as keccak_f1600.hpp: these are
+// included by translation units built for wider instruction sets.
+namespace {
+
+constexpr std::array<uint32_t, 64> SHA256_ROUND_CONSTANTS = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+constexpr std::array<uint32_t, 8> SHA256_INITIAL_STATE = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+constexpr uint32_t sha256_rotr(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+// A 64-byte message always ends in the same padding block (0x80, zeros,
+// bit length 512), so its schedule plus the round constants is fixed
+constexpr std::array<uint32_t, 64> sha256_padding_block_schedule() {
+    std::array<uint32_t, 64> w{};
+    w[0] = 0x80000000;
+    w[15] = 512;
+    for (size_t t = 16; t < 64; ++t) {
+        uint32_t s0 = sha256_rotr(w[t - 15], 7) ^ sha256_rotr(w[t - 15], 18) ^ (w[t - 15] >> 3);
+        uint32_t s1 = sha256_rotr(w[t - 2], 17) ^ sha256_rotr(w[t - 2], 19) ^ (w[t - 2] >> 10);
+        w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+    for (size_t t = 0; t < 64; ++t) {
+        w[t] += SHA256_ROUND_CONSTANTS[t];
+    }
+    return w;
+}
+
+constexpr std::array<uint32_t, 64> SHA256_PADDING_BLOCK_SCHEDULE = sha256_padding_block_schedule();
+
+inline uint32_t sha256_load_be32(const byte_t* bytes) noexcept {
+    return (uint32_t{bytes[0]} << 24) | (uint32_t{bytes[1]} << 16) | (uint32_t{bytes[2]} << 8) | uint32_t{bytes[3]};
+}
+
+inline void sha256_store_be32(byte_t* bytes, uint32_t word) noexcept {
+    bytes[0] = static_cast<byte_t>(word >> 24);
+    bytes[1] = static_cast<byte_t>(word >> 16);
+    bytes[2] = static_cast<byte_t>(word >> 8);
+    bytes[3] = static_cast<byte_t>(word);
+}
+
+} // namespace
+
+} // namespace chainforge::crypto
@@ -0,0 +1,98 @@
+// Built with -msha -msse4.1 where the compiler supports it; only entered
+// after a runtime CPU check in hash.cpp
+#include "sha256_pairs.hpp"
+#if defined(__SHA__) && defined(__SSE4_1__)
+#include <immintrin.h>
+#endif
+
+namespace chainforge::crypto {
+
+#if defined(__SHA__) && defined(__SSE4_1__)
+
+namespace {
+
+// Byte order of every 32-bit word reversed: message words are big-endian
+__m128i word_byte_swap() noexcept {
+    return _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+}
+
+__m128i load_words(const uint32_t* words) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(words));
+}
+
+// Four rounds; `abef` and `cdgh` are the state in the layout sha256rnds2 expects
+void four_rounds(__m128i& abef, __m128i& cdgh, __m128i schedule_plus_constants) noexcept {
+    cdgh = _mm_sha256rnds2_epu32(cdgh, abef, schedule_plus_constants);
+    abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(schedule_plus_constants, 0x0E));
+}
+
+void sha256_pair_shani(const Hash256* const* left, const Hash256* const* right, Hash256* out) {
+    // Initial state as ABEF / CDGH
+    __m128i dcba = load_words(SHA256_INITIAL_STATE.data());
+    __m128i hgfe = load_words(SHA256_INITIAL_STATE.data() + 4);
+    __m128i cdab = _mm_shuffle_epi32(dcba, 0xB1);
+    __m128i efgh = _mm_shuffle_epi32(hgfe, 0x1B);
+    __m128i abef = _mm_alignr_epi8(cdab, efgh, 8);
+    __m128i cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+    const __m128i initial_abef = abef;
+    const __m128i initial_cdgh = cdgh;
+
+    // First block: message words in a rolling window of four registers
+    const __m128i swap = word_byte_swap();
+    __m128i w[4];
+    const byte_t* halves[2] = {left[0]->data(), right[0]->data()};
+    for (size_t group = 0; group < 16; ++group) {
+        if (group < 4) {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(halves[group / 2] + 16 * (group % 2)));
+            w[group] = _mm_shuffle_epi8(bytes, swap);
+        }
+        __m128i& current = w[group % 4];
+        __m128i message = _mm_add_epi32(current, load_words(SHA256_ROUND_CONSTANTS.data() + 4 * group));
+        cdgh = _mm_sha256rnds2_epu32(cdgh, abef, message);
+        if (group >= 3 && group < 15) {
+            __m128i& next = w[(group + 1) % 4];
+            next = _mm_add_epi32(next, _mm_alignr_epi8(current, w[(group + 3) % 4], 4));
+            next = _mm_sha256msg2_epu32(next, current);
+        }
+        abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(message, 0x0E));
+        if (group >= 1 && group < 13) {
+            __m128i& previous = w[(group + 3) % 4];
+            previous = _mm_sha256msg1_epu32(previous, current);
+        }
+    }
+    abef = _mm_add_epi32(abef, initial_abef);
+    cdgh = _mm_add_epi32(cdgh, initial_cdgh);
+    const __m128i middle_abef = abef;
+    const __m128i middle_cdgh = cdgh;
+
+    // Second block: the fixed padding
+    for (size_t group = 0; group < 16; ++group) {
+        four_rounds(abef, cdgh, load_words(SHA256_PADDING_BLOCK_SCHEDULE.data() + 4 * group));
+    }
+    abef = _mm_add_epi32(abef, middle_abef);
+    cdgh = _mm_add_epi32(cdgh, middle_cdgh);
+
+    // Back to DCBA / HGFE, then big-endian bytes
+    __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+    dcba = _mm_blend_epi16(feba, dchg, 0xF0);
+    hgfe = _mm_alignr_epi8(dchg, feba, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out[0].data()), _mm_shuffle_epi8(dcba, swap));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out[0].data() + 16), _mm_shuffle_epi8(hgfe, swap));
+}
+
+} // namespace
+
+Sha256PairKernel sha256_pairs_shani_kernel() noexcept {
+    return &sha256_pair_shani;
+}
+
+#else
+
+Sha256PairKernel sha256_pairs_shani_kernel() noexcept {
+    return nullptr;
+}
+
+#endif
+
+} // namespace chainforge::crypto
@@ -1,15 +1,246 @@
 #include "chainforge/crypto/signature.hpp"
+#include "chainforge/core/worker_pool.hpp"
+#include "bls12_381.hpp"
+#include "ed25519_batch.hpp"
+#include "lru_cache.hpp"
+#include "sodium_support.hpp"
 #include <openssl/ec.h>
 #include <openssl/ecdsa.h>
 #include <openssl/obj_mac.h>
 #include <openssl/sha.h>
-#include <sodium.h>
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace chainforge::crypto {
 
+namespace {
+
+constexpr int ECDSA_SCALAR_SIZE = 32;
+
+// A worker only pays for itself with enough verifications to share out
+constexpr size_t ECDSA_PARALLEL_ITEM_THRESHOLD = 16;
+
+// Ed25519 slices also need to be large enough for the multi-scalar
+// multiplication to beat separate verifies
+constexpr size_t ED25519_PARALLEL_ITEM_THRESHOLD = 64;
+constexpr size_t ED25519_MIN_BATCH = 4;
+
+/**
+ * Splits [0, count) into contiguous slices of at least threshold items for
+ * up to max_workers threads (0 = the shared pool plus the caller) and runs
+ * them on core::WorkerPool::shared(); the calling thread works on slices too
+ */
+template <typename Fn>
+void run_in_slices(size_t count, size_t max_workers, size_t threshold, Fn&& verify_slice) {
+    core::WorkerPool& pool = core::WorkerPool::shared();
+    if (max_workers == 0) {
+        max_workers = pool.size() + 1;
+    }
+    const size_t workers = std::clamp<size_t>(count / threshold, 1, max_workers);
+    if (workers == 1) {
+        verify_slice(0, count);
+        return;
+    }
+    const size_t chunk = (count + workers - 1) / workers;
+    const size_t slices = (count + chunk - 1) / chunk;
+    pool.run(slices, [&](size_t slice) {
+        verify_slice(slice * chunk, std::min(count, (slice + 1) * chunk));
+    });
+}
+
+template <typename Item>
+bool all_verified(std::span<const Item> items) {
+    return std::all_of(items.begin(), items.end(), [](const Item& item) {
+        return item.result.success() && item.result.value;
+    });
+}
+
+struct OpensslDeleter {
+    void operator()(EC_GROUP* group) const { EC_GROUP_free(group); }
+    void operator()(EC_KEY* key) const { EC_KEY_free(key); }
+    void operator()(EC_POINT* point) const { EC_POINT_free(point); }
+    void operator()(BN_CTX* ctx) const { BN_CTX_free(ctx); }
+    void operator()(ECDSA_SIG* sig) const { ECDSA_SIG_free(sig); }
+};
+
+template <typename T>
+using OpensslPtr = std::unique_ptr<T, OpensslDeleter>;
+
+// secp256k1 with a precomputed table of generator multiples, built once.
+// Named-curve groups carry no such table, and u1 * G is half of every verify.
+const EC_GROUP* precomputed_secp256k1_group() {
+    static const OpensslPtr<EC_GROUP> group = [] {
+        OpensslPtr<EC_GROUP> built(EC_GROUP_new_by_curve_name(NID_secp256k1));
+        if (built) {
+            EC_GROUP_precompute_mult(built.get(), nullptr);
+        }
+        return built;
+    }();
+    return group.get();
+}
+
+/**
+ * OpenSSL state for secp256k1 verification
+ *
+ * Building the curve group dominated a one-off verify, so each thread keeps
+ * one EC_KEY on the shared group and only swaps in the public point per call.
+ * Copying the group into the key shares its precomputed table by reference.
+ */
+class EcdsaVerifier {
+public:
+    EcdsaVerifier() : key_(EC_KEY_new()), bn_ctx_(BN_CTX_new()) {
+        const EC_GROUP* shared = precomputed_secp256k1_group();
+        if (!shared || !key_ || EC_KEY_set_group(key_.get(), shared) != 1) {
+            key_.reset();
+            return;
+        }
+        group_ = EC_KEY_get0_group(key_.get());
+    }
+
+    bool ready() const { return group_ && key_ && bn_ctx_; }
+
+    // Null when x || y is not a point on the curve. The point belongs to the
+    // shared group rather than this thread's copy, so it may outlive the thread.
+    OpensslPtr<EC_POINT> decode_public_key(const Secp256k1PublicKey& public_key) {
+        byte_t encoded[1 + SECP256K1_PUBLIC_KEY_SIZE];
+        encoded[0] = POINT_CONVERSION_UNCOMPRESSED;
+        std::copy(public_key.begin(), public_key.end(), encoded + 1);
+
+        OpensslPtr<EC_POINT> point(EC_POINT_new(precomputed_secp256k1_group()));
+        if (!point || EC_POINT_oct2point(group_, point.get(), encoded, sizeof(encoded), bn_ctx_.get()) != 1) {
+            return nullptr;
+        }
+        return point;
+    }
+
+    CryptoResult<bool> verify(const byte_t* message, size_t message_len,
+                              const Secp256k1Signature& signature, const EC_POINT* public_key) {
+        unsigned char hash[SHA256_DIGEST_LENGTH];
+        SHA256(message, message_len, hash);
+
+        OpensslPtr<ECDSA_SIG> sig(ECDSA_SIG_new());
+        BIGNUM* r = BN_bin2bn(signature.data(), ECDSA_SCALAR_SIZE, nullptr);
+        BIGNUM* s = BN_bin2bn(signature.data() + ECDSA_SCALAR_SIZE, ECDSA_SCALAR_SIZE, nullptr);
+        if (!sig || !r || !s) {
+            BN_free(r);
+            BN_free(s);
+            return CryptoResult<bool>{false, CryptoError::VERIFICATION_FAILED};
+        }
+        ECDSA_SIG_set0(sig.get(), r, s);
+
+        if (EC_KEY_set_public_key(key_.get(), public_key) != 1) {
+            return CryptoResult<bool>{false, CryptoError::VERIFICATION_FAILED};
+        }
+        int verify_result = ECDSA_do_verify(hash, SHA256_DIGEST_LENGTH, sig.get(), key_.get());
+        return CryptoResult<bool>{verify_result == 1, CryptoError::SUCCESS};
+    }
+
+private:
+    OpensslPtr<EC_KEY> key_;
+    const EC_GROUP* group_ = nullptr;
+    OpensslPtr<BN_CTX> bn_ctx_;
+};
+
+EcdsaVerifier& thread_ecdsa_verifier() {
+    thread_local EcdsaVerifier verifier;
+    return verifier;
+}
+
+struct PublicKeyHash {
+    size_t operator()(const Secp256k1PublicKey& key) const noexcept {
+        return std::hash<std::string_view>{}(
+            std::string_view(reinterpret_cast<const char*>(key.data()), key.size()));
+    }
+};
+
+// Decoded points are never modified after insertion, and EC_KEY_set_public_key
+// copies the point, so one entry can serve any number of verifying threads
+using PublicKeyCache = ShardedLruCache<Secp256k1PublicKey, EC_POINT, PublicKeyHash>;
+
+PublicKeyCache& secp256k1_key_cache() {
+    static PublicKeyCache cache(Signature::DEFAULT_KEY_CACHE_CAPACITY);
+    return cache;
+}
+
+PublicKeyCache::ValuePtr cached_public_key(EcdsaVerifier& verifier, const Secp256k1PublicKey& public_key) {
+    return secp256k1_key_cache().get_or_create(public_key, [&](const Secp256k1PublicKey& key) {
+        return PublicKeyCache::ValuePtr(verifier.decode_public_key(key));
+    });
+}
+
+#ifdef CHAINFORGE_HAVE_BLST
+CryptoResult<BlsSignature> bls_sign_message(std::span<const byte_t> message, std::string_view dst,
+                                            const BlsPrivateKey& private_key) {
+    blst_scalar secret_key;
+    if (!bls_decode_secret_key(private_key, secret_key)) {
+        sodium_memzero(&secret_key, sizeof(secret_key));
+        return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::INVALID_KEY};
+    }
+
+    const blst_p2_affine hashed_point = bls_hash_to_g2(message, dst);
+    blst_p2 hashed;
+    blst_p2_from_affine(&hashed, &hashed_point);
+    blst_p2 signature;
+    blst_sign_pk_in_g1(&signature, &hashed, &secret_key);
+    sodium_memzero(&secret_key, sizeof(secret_key));
+
+    return CryptoResult<BlsSignature>{bls_encode_g2(signature), CryptoError::SUCCESS};
+}
+
+// e(public_key, H(message)) == e(G1, signature)
+CryptoResult<bool> bls_core_verify(std::span<const byte_t> message, std::string_view dst,
+                                   const BlsSignature& signature, const BlsPublicKey& public_key) {
+    blst_p2_affine signature_point;
+    if (!bls_decode_g2(signature, signature_point)) {
+        return CryptoResult<bool>{false, CryptoError::INVALID_SIGNATURE};
+    }
+    auto key = bls_decode_public_key(public_key);
+    if (!key) {
+        return CryptoResult<bool>{false, CryptoError::INVALID_KEY};
+    }
+
+    const blst_p1_affine g1_points[] = {*key, bls_negated_g1_generator()};
+    const blst_p2_affine g2_points[] = {bls_hash_to_g2(message, dst), signature_point};
+    return CryptoResult<bool>{bls_pairing_product_is_one(g1_points, g2_points), CryptoError::SUCCESS};
+}
+
+// False if any key fails KeyValidate
+bool bls_sum_public_keys(const std::vector<BlsPublicKey>& public_keys, blst_p1& sum) {
+    for (size_t i = 0; i < public_keys.size(); ++i) {
+        auto key = bls_decode_public_key(public_keys[i]);
+        if (!key) {
+            return false;
+        }
+        if (i == 0) {
+            blst_p1_from_affine(&sum, key.get());
+        } else {
+            blst_p1_add_or_double_affine(&sum, &sum, key.get());
+        }
+    }
+    return !public_keys.empty();
+}
+#else
+// Built without blst: signing and verification report UNSUPPORTED_ALGORITHM
+CryptoResult<BlsSignature> bls_sign_message(std::span<const byte_t> message, std::string_view dst,
+                                            const BlsPrivateKey& private_key) {
+    (void)message; (void)dst; (void)private_key; // Suppress unused parameter warnings
+    return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::UNSUPPORTED_ALGORITHM};
+}
+
+CryptoResult<bool> bls_core_verify(std::span<const byte_t> message, std::string_view dst,
+                                   const BlsSignature& signature, const BlsPublicKey& public_key) {
+    (void)message; (void)dst; (void)signature; (void)public_key; // Suppress unused parameter warnings
+    return CryptoResult<bool>{false, CryptoError::UNSUPPORTED_ALGORITHM};
+}
+#endif
+
+} // namespace
+
 CryptoResult<Secp256k1Signature> Signature::ecdsa_secp256k1_sign(
     const Message& message,
     const Secp256k1PrivateKey& private_key
@@ -25,6 +256,56 @@ CryptoResult<bool> Signature::ecdsa_secp256k1_verify(
     return internal_ecdsa_verify(message.data(), message.size(), signature, public_key);
 }
 
+CryptoResult<bool> Signature::ecdsa_secp256k1_verify_batch(std::span<VerifyItem> items, size_t max_workers) {
+    // Number each distinct key so workers fetch its decoded point only once;
+    // a block often carries several transactions from one sender
+    std::vector<uint32_t> key_ids(items.size());
+    std::unordered_map<Secp256k1PublicKey, uint32_t, PublicKeyHash> distinct_keys;
+    for (size_t i = 0; i < items.size(); ++i) {
+        auto next_id = static_cast<uint32_t>(distinct_keys.size());
+        key_ids[i] = distinct_keys.try_emplace(items[i].public_key, next_id).first->second;
+    }
+
+    auto verify_slice = [&](size_t begin, size_t end) {
+        EcdsaVerifier& verifier = thread_ecdsa_verifier();
+        std::vector<PublicKeyCache::ValuePtr> points(distinct_keys.size());
+        std::vector<bool> decoded(distinct_keys.size());
+        for (size_t i = begin; i < end; ++i) {
+            VerifyItem& item = items[i];
+            if (!verifier.ready()) {
+                item.result = CryptoResult<bool>{false, CryptoError::VERIFICATION_FAILED};
+                continue;
+            }
+            uint32_t id = key_ids[i];
+            if (!decoded[id]) {
+                points[id] = cached_public_key(verifier, item.public_key);
+                decoded[id] = true;
+            }
+            if (!points[id]) {
+                item.result = CryptoResult<bool>{false, CryptoError::INVALID_KEY};
+                continue;
+            }
+            item.result = verifier.verify(item.message.data(), item.message.size(), item.signature, points[id].get());
+        }
+    };
+
+    run_in_slices(items.size(), max_workers, ECDSA_PARALLEL_ITEM_THRESHOLD, verify_slice);
+    return CryptoResult<bool>{all_verified<VerifyItem>(items), CryptoError::SUCCESS};
+}
+
+Signature::KeyCacheStats Signature::secp256k1_key_cache_stats() {
+    LruCacheCounters counters = secp256k1_key_cache().counters();
+    return KeyCacheStats{counters.hits, counters.misses, counters.evictions, counters.size, counters.capacity};
+}
+
+void Signature::set_secp256k1_key_cache_capacity(size_t capacity) {
+    secp256k1_key_cache().set_capacity(capacity);
+}
+
+void Signature::clear_secp256k1_key_cache() {
+    secp256k1_key_cache().clear();
+}
+
 CryptoResult<Secp256k1PublicKey> Signature::ecdsa_secp256k1_recover_public_key(
     const Message& message,
     const Secp256k1Signature& signature,
@@ -50,6 +331,26 @@ CryptoResult<bool> Signature::ed25519_verify(
     return internal_ed25519_verify(message.data(), message.size(), signature, public_key);
 }
 
+CryptoResult<bool> Signature::ed25519_verify_batch(std::span<Ed25519VerifyItem> items, size_t max_workers) {
+    auto verify_slice = [&](size_t begin, size_t end) {
+        auto slice = items.subspan(begin, end - begin);
+        std::vector<bool> in_batch;
+        bool batch_valid = slice.size() >= ED25519_MIN_BATCH && ed25519_batch_equation_holds(slice, in_batch);
+        for (size_t i = 0; i < slice.size(); ++i) {
+            Ed25519VerifyItem& item = slice[i];
+            if (batch_valid && in_batch[i]) {
+                item.result = CryptoResult<bool>{true, CryptoError::SUCCESS};
+            } else {
+                item.result = internal_ed25519_verify(item.message.data(), item.message.size(), item.signature,
+                                                      item.public_key);
+            }
+        }
+    };
+
+    run_in_slices(items.size(), max_workers, ED25519_PARALLEL_ITEM_THRESHOLD, verify_slice);
+    return CryptoResult<bool>{all_verified<Ed25519VerifyItem>(items), CryptoError::SUCCESS};
+}
+
 CryptoResult<BlsSignature> Signature::bls_sign(
     const Message& message,
     const BlsPrivateKey& private_key
@@ -65,6 +366,7 @@ CryptoResult<bool> Signature::bls_verify(
     return internal_bls_verify(message.data(), message.size(), signature, public_key);
 }
 
+#ifdef CHAINFORGE_HAVE_BLST
 CryptoResult<BlsSignature> Signature::bls_aggregate_signatures(
     const std::vector<BlsSignature>& signatures
 ) {
@@ -72,20 +374,151 @@ CryptoResult<BlsSignature> Signature::bls_aggregate_signatures(
         return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::INVALID_SIGNATURE};
     }
 
-    // TODO: Implement BLS signature aggregation
+    blst_p2 sum;
+    for (size_t i = 0; i < signatures.size(); ++i) {
+        blst_p2_affine point;
+        if (!bls_decode_g2(signatures[i], point)) {
+            return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::INVALID_SIGNATURE};
+        }
+        if (i == 0) {
+            blst_p2_from_affine(&sum, &point);
+        } else {
+            blst_p2_add_or_double_affine(&sum, &sum, &point);
+        }
+    }
+    return CryptoResult<BlsSignature>{bls_encode_g2(sum), CryptoError::SUCCESS};
+}
+
+CryptoResult<BlsPublicKey> Signature::bls_aggregate_public_keys(
+    const std::vector<BlsPublicKey>& public_keys
+) {
+    if (public_keys.empty()) {
+        return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::INVALID_KEY};
+    }
+
+    blst_p1 sum;
+    if (!bls_sum_public_keys(public_keys, sum)) {
+        return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::INVALID_KEY};
+    }
+    return CryptoResult<BlsPublicKey>{bls_encode_g1(sum), CryptoError::SUCCESS};
+}
+
+CryptoResult<bool> Signature::bls_verify_aggregate(
+    const std::vector<Message>& messages,
+    const BlsSignature& aggregate_signature,
+    const std::vector<BlsPublicKey>& public_keys
+) {
+    if (messages.empty() || messages.size() != public_keys.size()) {
+        return CryptoResult<bool>{false, CryptoError::INVALID_LENGTH};
+    }
+    blst_p2_affine signature_point;
+    if (!bls_decode_g2(aggregate_signature, signature_point)) {
+        return CryptoResult<bool>{false, CryptoError::INVALID_SIGNATURE};
+    }
+
+    // prod e(pk_i, H(m_i)) * e(-G1, signature) == 1
+    std::vector<blst_p1_affine> g1_points;
+    std::vector<blst_p2_affine> g2_points;
+    g1_points.reserve(messages.size() + 1);
+    g2_points.reserve(messages.size() + 1);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        auto key = bls_decode_public_key(public_keys[i]);
+        if (!key) {
+            return CryptoResult<bool>{false, CryptoError::INVALID_KEY};
+        }
+        g1_points.push_back(*key);
+        g2_points.push_back(bls_hash_to_g2(messages[i], BLS_SIGNATURE_DST));
+    }
+    g1_points.push_back(bls_negated_g1_generator());
+    g2_points.push_back(signature_point);
+
+    return CryptoResult<bool>{bls_pairing_product_is_one(g1_points, g2_points), CryptoError::SUCCESS};
+}
+
+CryptoResult<bool> Signature::bls_fast_aggregate_verify(
+    const Message& message,
+    const BlsSignature& aggregate_signature,
+    const std::vector<BlsPublicKey>& public_keys
+) {
+    if (public_keys.empty()) {
+        return CryptoResult<bool>{false, CryptoError::INVALID_LENGTH};
+    }
+    blst_p2_affine signature_point;
+    if (!bls_decode_g2(aggregate_signature, signature_point)) {
+        return CryptoResult<bool>{false, CryptoError::INVALID_SIGNATURE};
+    }
+
+    blst_p1 sum;
+    if (!bls_sum_public_keys(public_keys, sum)) {
+        return CryptoResult<bool>{false, CryptoError::INVALID_KEY};
+    }
+    blst_p1_affine aggregate_key;
+    blst_p1_to_affine(&aggregate_key, &sum);
+
+    const blst_p1_affine g1_points[] = {aggregate_key, bls_negated_g1_generator()};
+    const blst_p2_affine g2_points[] = {bls_hash_to_g2(message, BLS_SIGNATURE_DST), signature_point};
+    return CryptoResult<bool>{bls_pairing_product_is_one(g1_points, g2_points), CryptoError::SUCCESS};
+}
+
+CryptoResult<BlsSignature> Signature::bls_prove_possession(const BlsPrivateKey& private_key) {
+    blst_scalar secret_key;
+    if (!bls_decode_secret_key(private_key, secret_key)) {
+        sodium_memzero(&secret_key, sizeof(secret_key));
+        return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::INVALID_KEY};
+    }
+    blst_p1 public_key;
+    blst_sk_to_pk_in_g1(&public_key, &secret_key);
+    sodium_memzero(&secret_key, sizeof(secret_key));
+
+    const BlsPublicKey encoded = bls_encode_g1(public_key);
+    return bls_sign_message(encoded, BLS_POSSESSION_DST, private_key);
+}
+#else
+CryptoResult<BlsSignature> Signature::bls_aggregate_signatures(
+    const std::vector<BlsSignature>& signatures
+) {
+    (void)signatures; // Suppress unused parameter warnings
     return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
+CryptoResult<BlsPublicKey> Signature::bls_aggregate_public_keys(
+    const std::vector<BlsPublicKey>& public_keys
+) {
+    (void)public_keys; // Suppress unused parameter warnings
+    return CryptoResult<BlsPublicKey>{BlsPublicKey{}, CryptoError::UNSUPPORTED_ALGORITHM};
+}
+
 CryptoResult<bool> Signature::bls_verify_aggregate(
     const std::vector<Message>& messages,
     const BlsSignature& aggregate_signature,
     const std::vector<BlsPublicKey>& public_keys
 ) {
-    // TODO: Implement BLS aggregate verification
     (void)messages; (void)aggregate_signature; (void)public_keys; // Suppress unused parameter warnings
     return CryptoResult<bool>{false, CryptoError::UNSUPPORTED_ALGORITHM};
 }
 
+CryptoResult<bool> Signature::bls_fast_aggregate_verify(
+    const Message& message,
+    const BlsSignature& aggregate_signature,
+    const std::vector<BlsPublicKey>& public_keys
+) {
+    (void)message; (void)aggregate_signature; (void)public_keys; // Suppress unused parameter warnings
+    return CryptoResult<bool>{false, CryptoError::UNSUPPORTED_ALGORITHM};
+}
+
+CryptoResult<BlsSignature> Signature::bls_prove_possession(const BlsPrivateKey& private_key) {
+    (void)private_key; // Suppress unused parameter warnings
+    return CryptoResult<BlsSignature>{BlsSignature{}, CryptoError::UNSUPPORTED_ALGORITHM};
+}
+#endif
+
+CryptoResult<bool> Signature::bls_verify_possession(
+    const BlsPublicKey& public_key,
+    const BlsSignature& proof
+) {
+    return bls_core_verify(public_key, BLS_POSSESSION_DST, proof, public_key);
+}
+
 // Template implementation
 template<typename T>
 std::string Signature::signature_to_hex(const T& sig) {
@@ -190,22 +623,18 @@ CryptoResult<Secp256k1Signature> Signature::internal_ecdsa_sign(
         return CryptoResult<Secp256k1Signature>{Secp256k1Signature{}, CryptoError::SIGNATURE_FAILED};
     }
 
-    // Convert to DER format
-    int der_len = i2d_ECDSA_SIG(sig, nullptr);
-    if (der_len <= 0 || der_len > static_cast<int>(SECP256K1_SIGNATURE_SIZE)) {
-        ECDSA_SIG_free(sig);
-        EC_KEY_free(ec_key);
-        return CryptoResult<Secp256k1Signature>{Secp256k1Signature{}, CryptoError::SIGNATURE_FAILED};
-    }
-
+    // Encode as compact r || s
+    const BIGNUM* r = nullptr;
+    const BIGNUM* s = nullptr;
+    ECDSA_SIG_get0(sig, &r, &s);
     Secp256k1Signature result_sig;
-    unsigned char* der_data = result_sig.data();
-    int final_len = i2d_ECDSA_SIG(sig, &der_data);
+    bool encoded = BN_bn2binpad(r, result_sig.data(), ECDSA_SCALAR_SIZE) == ECDSA_SCALAR_SIZE &&
+                   BN_bn2binpad(s, result_sig.data() + ECDSA_SCALAR_SIZE, ECDSA_SCALAR_SIZE) == ECDSA_SCALAR_SIZE;
 
     ECDSA_SIG_free(sig);
     EC_KEY_free(ec_key);
 
-    if (final_len != der_len) {
+    if (!encoded) {
         return CryptoResult<Secp256k1Signature>{Secp256k1Signature{}, CryptoError::SIGNATURE_FAILED};
     }
 
@@ -217,50 +646,34 @@ CryptoResult<bool> Signature::internal_ecdsa_verify(
     const Secp256k1Signature& signature,
     const Secp256k1PublicKey& public_key
 ) {
-    // Hash the message first (Ethereum standard)
-    unsigned char hash[SHA256_DIGEST_LENGTH];
-    SHA256(message, message_len, hash);
-
-    // Create EC key from public key
-    EC_KEY* ec_key = EC_KEY_new_by_curve_name(NID_secp256k1);
-    if (!ec_key) {
+    EcdsaVerifier& verifier = thread_ecdsa_verifier();
+    if (!verifier.ready()) {
         return CryptoResult<bool>{false, CryptoError::VERIFICATION_FAILED};
     }
 
-    // Set the public key
-    const unsigned char* pub_key_data = public_key.data();
-    if (!o2i_ECPublicKey(&ec_key, &pub_key_data, static_cast<long>(public_key.size()))) {
-        EC_KEY_free(ec_key);
+    auto point = cached_public_key(verifier, public_key);
+    if (!point) {
         return CryptoResult<bool>{false, CryptoError::INVALID_KEY};
     }
-
-    // Parse DER signature
-    const unsigned char* sig_data = signature.data();
-    ECDSA_SIG* sig = d2i_ECDSA_SIG(nullptr, &sig_data, static_cast<long>(signature.size()));
-    if (!sig) {
-        EC_KEY_free(ec_key);
-        return CryptoResult<bool>{false, CryptoError::INVALID_SIGNATURE};
-    }
-
-    // Verify the signature
-    int verify_result = ECDSA_do_verify(hash, SHA256_DIGEST_LENGTH, sig, ec_key);
-
-    ECDSA_SIG_free(sig);
-    EC_KEY_free(ec_key);
-
-    return CryptoResult<bool>{verify_result == 1, CryptoError::SUCCESS};
+    return verifier.verify(message, message_len, signature, point.get());
 }
 
 CryptoResult<Ed25519Signature> Signature::internal_ed25519_sign(
     const byte_t* message, size_t message_len,
     const Ed25519PrivateKey& private_key
 ) {
-    if (sodium_init() == -1) {
+    if (!sodium_ready()) {
         return CryptoResult<Ed25519Signature>{Ed25519Signature{}, CryptoError::SIGNATURE_FAILED};
     }
 
+    // The private key is the 32-byte seed; libsodium signs with seed || public key
+    byte_t public_key[crypto_sign_ed25519_PUBLICKEYBYTES];
+    byte_t secret_key[crypto_sign_ed25519_SECRETKEYBYTES];
+    crypto_sign_ed25519_seed_keypair(public_key, secret_key, private_key.data());
+
     Ed25519Signature signature;
-    crypto_sign_ed25519_detached(signature.data(), nullptr, message, message_len, private_key.data());
+    crypto_sign_ed25519_detached(signature.data(), nullptr, message, message_len, secret_key);
+    sodium_memzero(secret_key, sizeof(secret_key));
 
     return CryptoResult<Ed25519Signature>{signature, CryptoError::SUCCESS};
 }
@@ -270,26 +683,19 @@ CryptoResult<bool> Signature::internal_ed25519_verify(
     const Ed25519Signature& signature,
     const Ed25519PublicKey& public_key
 ) {
-    if (sodium_init() == -1) {
+    if (!sodium_ready()) {
         return CryptoResult<bool>{false, CryptoError::VERIFICATION_FAILED};
     }
 
-    int result = crypto_sign_ed25519_verify_detached(signature.data(), message, message_len, public_key.data());
-
-    return CryptoResult<bool>{result == 0, CryptoError::SUCCESS};
+    bool valid = ed25519_verify_zip215(message, message_len, signature, public_key);
+    return CryptoResult<bool>{valid, CryptoError::SUCCESS};
 }
 
 CryptoResult<BlsSignature> Signature::internal_bls_sign(
     const byte_t* message, size_t message_len,
     const BlsPrivateKey& private_key
 ) {
-    // BLS implementation not available - stub implementation
-    // In a real implementation, this would use blst or another BLS library
-    (void)message; (void)message_len; // Suppress unused parameter warnings
-    BlsSignature signature{};
-    // Copy some data to make it look like a signature for testing
-    std::copy(private_key.begin(), private_key.begin() + std::min(private_key.size(), signature.size()), signature.begin());
-    return CryptoResult<BlsSignature>{signature, CryptoError::SUCCESS};
+    return bls_sign_message(std::span<const byte_t>(message, message_len), BLS_SIGNATURE_DST, private_key);
 }
 
 CryptoResult<bool> Signature::internal_bls_verify(
@@ -297,10 +703,7 @@ CryptoResult<bool> Signature::internal_bls_verify(
     const BlsSignature& signature,
     const BlsPublicKey& public_key
 ) {
-    // BLS implementation not available - stub implementation
-    // In a real implementation, this would use blst or another BLS library
-    (void)message; (void)message_len; (void)signature; (void)public_key;
-    return CryptoResult<bool>{true, CryptoError::SUCCESS};
+    return bls_core_verify(std::span<const byte_t>(message, message_len), BLS_SIGNATURE_DST, signature, public_key);
 }
 
 } // namespace chainforge::crypto
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <sodium.h>
+
+namespace chainforge::crypto {
+
+// sodium_init is safe to repeat but enters a global critical section on
+// every call, which serialized concurrent verifiers; run it once instead
+inline bool sodium_ready() {
+    static const bool ready = sodium_init() >= 0;
+    return ready;
+}
+
+} // namespace chainforge::crypto
@@ -0,0 +1,148 @@
+#include "chainforge/mempool/mempool.hpp"
+#include "chainforge/core/address.hpp"
+#include "chainforge/core/amount.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Each transaction gets a distinct sender so hashes never collide
+core::Transaction make_transaction(uint64_t index, std::mt19937_64& rng) {
+    core::Address160 from{};
+    core::Address160 to{};
+    for (size_t i = 0; i < sizeof(index); ++i) {
+        from[i] = static_cast<uint8_t>((index >> ((sizeof(index) - 1 - i) * 8)) & 0xFF);
+    }
+    from[core::ADDRESS_SIZE - 1] = 0x01;
+    to[0] = 0xAA;
+
+    core::Transaction tx{core::Address(from), core::Address(to), core::Amount::from_wei(1)};
+    tx.set_gas_price(1 + rng() % 1000);
+    tx.set_nonce(0);
+    return tx;
+}
+
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t pool_size = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+    const size_t churn_ops = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : pool_size;
+
+    mempool::MempoolConfig config;
+    config.max_transactions = pool_size * 2;
+    config.max_size_bytes = SIZE_MAX;
+    auto pool = mempool::create_mempool(config);
+
+    std::mt19937_64 rng(42);
+    std::vector<core::Hash> live;
+    live.reserve(pool_size);
+
+    std::cout << "=== Mempool add/remove benchmark ===" << std::endl;
+    std::cout << "Pool size: " << pool_size << ", churn operations: " << churn_ops << std::endl;
+
+    auto start = Clock::now();
+    for (size_t i = 0; i < pool_size; ++i) {
+        auto tx = make_transaction(i, rng);
+        if (pool->add_transaction(tx) == mempool::MempoolError::SUCCESS) {
+            live.push_back(tx.calculate_hash());
+        }
+    }
+    double fill_seconds = seconds_since(start);
+    std::cout << "Fill:  " << live.size() << " txs in " << fill_seconds << " s ("
+              << static_cast<double>(live.size()) / fill_seconds << " adds/s)" << std::endl;
+
+    // Sustained churn: every step removes a random pooled transaction and admits a fresh one
+    size_t next_index = pool_size;
+    start = Clock::now();
+    for (size_t i = 0; i < churn_ops && !live.empty(); ++i) {
+        size_t victim = rng() % live.size();
+        pool->remove_transaction(live[victim]);
+
+        auto tx = make_transaction(next_index++, rng);
+        pool->add_transaction(tx);
+        live[victim] = tx.calculate_hash();
+    }
+    double churn_seconds = seconds_since(start);
+    std::cout << "Churn: " << churn_ops << " remove+add pairs in " << churn_seconds << " s ("
+              << static_cast<double>(churn_ops) * 2.0 / churn_seconds << " ops/s)" << std::endl;
+
+    // Batched admission into a fresh pool of the same size
+    constexpr size_t batch_size = 4096;
+    std::vector<core::Transaction> batch;
+    batch.reserve(batch_size);
+    auto batch_pool = mempool::create_mempool(config);
+    size_t batch_added = 0;
+
+    start = Clock::now();
+    for (size_t i = 0; i < pool_size; ++i) {
+        batch.push_back(make_transaction(next_index++, rng));
+        if (batch.size() == batch_size || i + 1 == pool_size) {
+            for (auto result : batch_pool->add_transactions(batch)) {
+                batch_added += result == mempool::MempoolError::SUCCESS ? 1 : 0;
+            }
+            batch.clear();
+        }
+    }
+    double batch_seconds = seconds_since(start);
+    std::cout << "Batch: " << batch_added << " txs in batches of " << batch_size << " in " << batch_seconds
+              << " s (" << static_cast<double>(batch_added) / batch_seconds << " adds/s)" << std::endl;
+
+    // Block template selection over the whole pool: deep copies vs shared handles
+    start = Clock::now();
+    auto selected = pool->get_transactions_for_block(pool_size, UINT64_MAX);
+    double select_seconds = seconds_since(start);
+    std::cout << "Select (copies):  " << selected.size() << " txs in " << select_seconds * 1000.0 << " ms" << std::endl;
+
+    start = Clock::now();
+    auto handles = pool->get_block_transaction_handles(pool_size, UINT64_MAX);
+    double handle_seconds = seconds_since(start);
+    std::cout << "Select (handles): " << handles.size() << " txs in " << handle_seconds * 1000.0 << " ms" << std::endl;
+
+    // Block acceptance: drop a template's worth of transactions, then rebuild the next template
+    constexpr size_t block_size = 5000;
+    std::vector<core::Transaction> included;
+    for (const auto& handle : pool->get_block_transaction_handles(block_size, UINT64_MAX)) {
+        included.push_back(*handle);
+    }
+
+    start = Clock::now();
+    size_t removed = pool->remove_included_transactions(included);
+    auto next_template = pool->get_block_transaction_handles(block_size, UINT64_MAX);
+    double accept_seconds = seconds_since(start);
+    std::cout << "Accept: removed " << removed << ", next template " << next_template.size() << " txs in "
+              << accept_seconds * 1000.0 << " ms" << std::endl;
+
+    // Maintenance pass with nothing to evict: the time index makes this independent of pool size
+    pool->run_maintenance();
+    auto metrics = pool->get_eviction_metrics();
+    std::cout << "Maintenance: " << pool->get_stats().transaction_count << " pooled, write lock held "
+              << metrics.last_pause_us << " us" << std::endl;
+
+    // Snapshot the pool and restore it into an empty one, as after a node restart
+    auto snapshot_path = std::filesystem::temp_directory_path() / "chainforge_mempool_benchmark.snapshot";
+    start = Clock::now();
+    pool->save_snapshot(snapshot_path);
+    double save_seconds = seconds_since(start);
+
+    auto restored = mempool::create_mempool(config);
+    start = Clock::now();
+    restored->load_snapshot(snapshot_path);
+    double load_seconds = seconds_since(start);
+    std::filesystem::remove(snapshot_path);
+    std::cout << "Snapshot: " << restored->get_stats().transaction_count << " txs saved in " << save_seconds * 1000.0
+              << " ms, restored in " << load_seconds * 1000.0 << " ms" << std::endl;
+
+    return 0;
+}
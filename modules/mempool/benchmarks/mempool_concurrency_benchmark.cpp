@@ -0,0 +1,86 @@
+#include "chainforge/mempool/mempool.hpp"
+#include "chainforge/core/address.hpp"
+#include "chainforge/core/amount.hpp"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace chainforge;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Each transaction gets a distinct sender so hashes never collide
+core::Transaction make_transaction(uint64_t index) {
+    core::Address160 from{};
+    core::Address160 to{};
+    for (size_t i = 0; i < sizeof(index); ++i) {
+        from[i] = static_cast<uint8_t>((index >> ((sizeof(index) - 1 - i) * 8)) & 0xFF);
+    }
+    from[core::ADDRESS_SIZE - 1] = 0x01;
+    to[0] = 0xAA;
+
+    core::Transaction tx{core::Address(from), core::Address(to), core::Amount::from_wei(1)};
+    tx.set_gas_price(1 + index % 1000);
+    tx.set_nonce(0);
+    return tx;
+}
+
+// Admits every transaction from `producers` threads and returns transactions/second
+double run_admission(size_t shard_count, size_t producers, const std::vector<core::Transaction>& txs) {
+    mempool::MempoolConfig config;
+    config.max_transactions = txs.size() * 2;
+    config.max_size_bytes = SIZE_MAX;
+    config.shard_count = shard_count;
+    auto pool = mempool::create_mempool(config);
+
+    std::vector<std::thread> threads;
+    threads.reserve(producers);
+
+    auto start = Clock::now();
+    for (size_t p = 0; p < producers; ++p) {
+        threads.emplace_back([&, p]() {
+            for (size_t i = p; i < txs.size(); i += producers) {
+                pool->add_transaction(txs[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    return static_cast<double>(pool->get_stats().transaction_count) / seconds;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    const size_t tx_count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const size_t shard_count = argc > 2 ? std::strtoull(argv[2], nullptr, 10)
+                                        : std::max<size_t>(2, std::thread::hardware_concurrency() * 2);
+
+    std::cout << "=== Mempool concurrent admission benchmark ===" << std::endl;
+    std::cout << "Transactions: " << tx_count << ", shards: " << shard_count << std::endl;
+
+    // Hash up front so both modes measure admission only
+    std::vector<core::Transaction> txs;
+    txs.reserve(tx_count);
+    for (size_t i = 0; i < tx_count; ++i) {
+        txs.push_back(make_transaction(i));
+        txs.back().calculate_hash();
+    }
+
+    const size_t producer_counts[] = {1, 4, 16, 64};
+    for (size_t producers : producer_counts) {
+        double single = run_admission(1, producers, txs);
+        double sharded = run_admission(shard_count, producers, txs);
+        std::cout << producers << " producers: single-lock " << single << " tx/s, sharded "
+                  << sharded << " tx/s (" << sharded / single << "x)" << std::endl;
+    }
+
+    return 0;
+}
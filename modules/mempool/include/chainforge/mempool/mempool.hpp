@@ -3,11 +3,15 @@
 #include "chainforge/core/transaction.hpp"
 #include "chainforge/core/hash.hpp"
 #include <vector>
+#include <algorithm>
+#include <cmath>
 #include <unordered_map>
 #include <memory>
 #include <functional>
 #include <optional>
 #include <mutex>
+#include <span>
+#include <filesystem>
 
 namespace chainforge::mempool {
 
@@ -23,22 +27,56 @@ enum class MempoolError {
     NONCE_TOO_LOW = 5,
     NONCE_TOO_HIGH = 6,
     REPLACE_UNDERPRICED = 7,
-    DEPENDENCY_MISSING = 8
+    DEPENDENCY_MISSING = 8,
+    SNAPSHOT_IO_ERROR = 9,
+    SNAPSHOT_CORRUPT = 10,
+    PACKAGE_TOO_LARGE = 11
 };
 
 /**
  * Transaction priority based on fee and age
+ *
+ * The age bonus grows exponentially, e^(age / 1h), which matches the former
+ * linear 1 + age / 1h to first order. Because every pooled score then grows by
+ * the same factor over time, relative order never changes as entries age and
+ * pools can index on ordering_key() instead of rescoring.
  */
 struct TransactionPriority {
     double fee_per_gas = 0.0;
     uint64_t age_seconds = 0;
     uint64_t size_bytes = 0;
 
+    static constexpr double AGE_BONUS_SECONDS = 3600.0;
+
     double calculate_score() const {
         // Score = (fee_per_gas * age_bonus) / size_penalty
-        double age_bonus = 1.0 + (static_cast<double>(age_seconds) / 3600.0); // 1 hour bonus
-        double size_penalty = static_cast<double>(size_bytes) / 1000.0; // Size in KB
-        return (fee_per_gas * age_bonus) / std::max(size_penalty, 1.0);
+        double age_bonus = std::exp(static_cast<double>(age_seconds) / AGE_BONUS_SECONDS);
+        return (fee_per_gas * age_bonus) / size_penalty();
+    }
+
+    // log(score) with the shared time term factored out; higher key means higher score at any instant
+    double ordering_key(uint64_t added_timestamp) const {
+        return std::log(fee_per_gas / size_penalty()) - static_cast<double>(added_timestamp) / AGE_BONUS_SECONDS;
+    }
+
+    // Score at `now` of an entry with the given ordering key
+    static double score_at(double ordering_key, uint64_t now) {
+        return std::exp(ordering_key + static_cast<double>(now) / AGE_BONUS_SECONDS);
+    }
+
+    // This transaction's share of a package fee; a one-transaction package keys exactly like ordering_key()
+    double modified_fee(uint64_t gas_limit) const {
+        return fee_per_gas * static_cast<double>(gas_limit) / size_penalty();
+    }
+
+    // Ordering key of a package: its gas-weighted modified fee rate, aged from its newest member
+    static double package_key(double modified_fee, uint64_t gas, uint64_t newest_added_timestamp) {
+        return std::log(modified_fee / static_cast<double>(gas)) -
+               static_cast<double>(newest_added_timestamp) / AGE_BONUS_SECONDS;
+    }
+
+    double size_penalty() const {
+        return std::max(static_cast<double>(size_bytes) / 1000.0, 1.0);  // Size in KB
     }
 
     bool operator<(const TransactionPriority& other) const {
@@ -56,17 +94,52 @@ struct MempoolConfig {
     uint64_t max_fee_per_gas = 1000000;         // Maximum fee per gas
     uint64_t eviction_interval_seconds = 60;    // Eviction check interval
     double eviction_threshold_ratio = 0.9;      // Evict when 90% full
+    uint64_t transaction_ttl_seconds = 3600;    // Age at which a pooled transaction expires
+    bool background_eviction = false;           // Run maintenance on a worker every eviction_interval_seconds
+    size_t shard_count = 1;                     // >1 selects the sharded, lock-striped pool
+    size_t max_package_size = 25;               // Max pooled transactions per sender (ancestor + descendant limit)
+};
+
+/**
+ * Shared, immutable handle to a pooled transaction; stays valid after the pool drops it
+ */
+using TransactionHandle = std::shared_ptr<const chainforge::core::Transaction>;
+
+/**
+ * Aggregate over a set of related pooled transactions (a package)
+ */
+struct PackageStats {
+    size_t count = 0;
+    double modified_fee = 0.0;          // Sum of TransactionPriority::modified_fee
+    uint64_t gas = 0;                   // Sum of gas limits
+    uint64_t newest_added_timestamp = 0;
+
+    void add(const TransactionPriority& priority, uint64_t gas_limit, uint64_t added_timestamp) {
+        ++count;
+        modified_fee += priority.modified_fee(gas_limit);
+        gas += gas_limit;
+        newest_added_timestamp = std::max(newest_added_timestamp, added_timestamp);
+    }
+
+    double ordering_key() const {
+        return TransactionPriority::package_key(modified_fee, gas, newest_added_timestamp);
+    }
 };
 
 /**
  * Transaction entry in the mempool
+ *
+ * A sender's lower pooled nonces are this entry's ancestors and its higher
+ * ones are descendants; both aggregates include the entry itself.
  */
 struct MempoolEntry {
-    chainforge::core::Transaction transaction;
+    TransactionHandle transaction;
     TransactionPriority priority;
     uint64_t added_timestamp;
     uint64_t last_seen_timestamp;
-    std::vector<chainforge::core::Hash> dependencies;  // Transaction hashes this depends on
+    std::vector<chainforge::core::Hash> dependencies;  // Transaction hashes this depends on (the parent nonce)
+    PackageStats ancestors;
+    PackageStats descendants;
 
     bool is_expired(uint64_t current_time, uint64_t max_age_seconds = 3600) const {
         return (current_time - added_timestamp) > max_age_seconds;
@@ -85,6 +158,18 @@ struct MempoolStats {
     uint64_t oldest_transaction_age = 0;
 };
 
+/**
+ * Eviction counters and the write-lock pauses eviction caused
+ */
+struct EvictionMetrics {
+    uint64_t expired_evicted = 0;   // Removed for exceeding transaction_ttl_seconds
+    uint64_t fee_evicted = 0;       // Removed by low-fee eviction, inline or periodic
+    uint64_t maintenance_runs = 0;  // Completed run_maintenance() passes
+    uint64_t last_pause_us = 0;     // Lock hold time of the latest eviction pass
+    uint64_t max_pause_us = 0;
+    uint64_t total_pause_us = 0;
+};
+
 /**
  * Transaction pool interface
  */
@@ -98,6 +183,9 @@ public:
 
     // Transaction management
     virtual MempoolError add_transaction(const chainforge::core::Transaction& transaction) = 0;
+    // Batch admission: one result per input, in input order. A sender's transactions are admitted in nonce
+    // order whatever their order in the batch.
+    virtual std::vector<MempoolError> add_transactions(std::span<const chainforge::core::Transaction> transactions) = 0;
     virtual MempoolError remove_transaction(const chainforge::core::Hash& tx_hash) = 0;
     virtual std::optional<chainforge::core::Transaction> get_transaction(const chainforge::core::Hash& tx_hash) const = 0;
     virtual bool has_transaction(const chainforge::core::Hash& tx_hash) const = 0;
@@ -106,17 +194,33 @@ public:
     virtual MempoolError replace_transaction(const chainforge::core::Transaction& new_transaction) = 0;
 
     // Batch operations
-    virtual std::vector<chainforge::core::Transaction> get_top_transactions(size_t count) = 0;
-    virtual std::vector<chainforge::core::Transaction> get_transactions_for_block(size_t max_count, uint64_t max_gas_limit) = 0;
+    virtual std::vector<chainforge::core::Transaction> get_top_transactions(size_t count) const = 0;
+    virtual std::vector<chainforge::core::Transaction> get_transactions_for_block(size_t max_count, uint64_t max_gas_limit) const = 0;
     virtual std::vector<chainforge::core::Hash> get_all_transaction_hashes() const = 0;
 
+    // Zero-copy selection: same ordering as above, returning handles instead of deep copies
+    virtual std::vector<TransactionHandle> get_top_transaction_handles(size_t count) const = 0;
+    virtual std::vector<TransactionHandle> get_block_transaction_handles(size_t max_count, uint64_t max_gas_limit) const = 0;
+
+    // Drops the given block's transactions and any pooled ones they made stale (same sender, nonce <= included).
+    // Returns how many pooled transactions were removed.
+    virtual size_t remove_included_transactions(std::span<const chainforge::core::Transaction> included) = 0;
+
     // Maintenance
     virtual void evict_expired_transactions() = 0;
     virtual void evict_low_fee_transactions() = 0;
+    // One expiry + low-fee pass; what the background worker runs each interval
+    virtual void run_maintenance() = 0;
     virtual void clear() = 0;
 
     // Statistics
     virtual MempoolStats get_stats() const = 0;
+    virtual EvictionMetrics get_eviction_metrics() const = 0;
+
+    // Persistence: pooled transactions with their admission times, in a compact binary format.
+    // Loading streams the file through batch admission; entries the pool rejects are skipped.
+    virtual MempoolError save_snapshot(const std::filesystem::path& path) const = 0;
+    virtual MempoolError load_snapshot(const std::filesystem::path& path) = 0;
 
     // Validation
     virtual bool validate_transaction(const chainforge::core::Transaction& transaction) const = 0;
@@ -126,9 +230,12 @@ public:
     // Callbacks
     using TransactionAddedCallback = std::function<void(const chainforge::core::Hash&)>;
     using TransactionRemovedCallback = std::function<void(const chainforge::core::Hash&)>;
+    using TransactionsAddedCallback = std::function<void(const std::vector<chainforge::core::Hash>&)>;
 
     virtual void set_transaction_added_callback(TransactionAddedCallback callback) = 0;
     virtual void set_transaction_removed_callback(TransactionRemovedCallback callback) = 0;
+    // Fired once per add_transactions() batch instead of per-transaction added callbacks
+    virtual void set_transactions_added_callback(TransactionsAddedCallback callback) = 0;
 };
 
 /**
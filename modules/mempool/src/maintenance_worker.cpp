@@ -0,0 +1,30 @@
+#include "maintenance_worker.hpp"
+#include <algorithm>
+
+namespace chainforge::mempool {
+
+MaintenanceWorker::MaintenanceWorker(std::chrono::seconds interval, std::function<void()> task)
+    : interval_(std::max(interval, std::chrono::seconds{1})),
+      task_(std::move(task)),
+      thread_([this]() { run(); }) {}
+
+MaintenanceWorker::~MaintenanceWorker() {
+    {
+        std::lock_guard lock(mutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    thread_.join();
+}
+
+void MaintenanceWorker::run() {
+    std::unique_lock lock(mutex_);
+
+    while (!wake_.wait_for(lock, interval_, [this]() { return stopping_; })) {
+        lock.unlock();
+        task_();
+        lock.lock();
+    }
+}
+
+} // namespace chainforge::mempool
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace chainforge::mempool {
+
+/**
+ * Background thread that runs a maintenance task on a fixed interval
+ *
+ * The task runs outside the worker's own lock, so it may take pool locks and
+ * fire callbacks. Destruction wakes the thread and joins it.
+ */
+class MaintenanceWorker {
+public:
+    MaintenanceWorker(std::chrono::seconds interval, std::function<void()> task);
+    ~MaintenanceWorker();
+
+    MaintenanceWorker(const MaintenanceWorker&) = delete;
+    MaintenanceWorker& operator=(const MaintenanceWorker&) = delete;
+
+private:
+    void run();
+
+    std::chrono::seconds interval_;
+    std::function<void()> task_;
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+    std::thread thread_;  // Last, so it starts after everything it reads is initialized
+};
+
+} // namespace chainforge::mempool
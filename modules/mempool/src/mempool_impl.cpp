@@ -1,15 +1,31 @@
 #include "mempool_impl.hpp"
+#include "sharded_mempool.hpp"
 #include "chainforge/core/address.hpp"
+#include "chainforge/core/worker_pool.hpp"
 #include <algorithm>
 #include <numeric>
+#include <queue>
+#include <unordered_set>
 
 namespace chainforge::mempool {
 
-MempoolImpl::MempoolImpl(const MempoolConfig& config) : config_(config) {}
+namespace {
+
+// Batches are only split across the shared pool once each slice gets this many transactions
+constexpr size_t PREPARE_ITEMS_PER_SLICE = 256;
+
+} // namespace
+
+MempoolImpl::MempoolImpl(const MempoolConfig& config) : config_(config) {
+    restart_maintenance_worker(config);
+}
 
 void MempoolImpl::set_config(const MempoolConfig& config) {
-    std::unique_lock lock(mutex_);
-    config_ = config;
+    {
+        std::unique_lock lock(mutex_);
+        config_ = config;
+    }
+    restart_maintenance_worker(config);
 }
 
 const MempoolConfig& MempoolImpl::get_config() const {
@@ -18,52 +34,32 @@ const MempoolConfig& MempoolImpl::get_config() const {
 }
 
 MempoolError MempoolImpl::add_transaction(const chainforge::core::Transaction& transaction) {
-    std::unique_lock lock(mutex_);
-
+    // Hashing needs no pool state, so keep it outside the lock
     auto tx_hash = transaction.calculate_hash();
 
-    // Check if transaction already exists
-    if (transactions_.find(tx_hash) != transactions_.end()) {
-        return MempoolError::TRANSACTION_EXISTS;
-    }
+    std::unique_lock lock(mutex_);
 
-    // Validate transaction
-    if (!validate_transaction(transaction)) {
+    if (!validate_stateless(transaction, config_)) {
         return MempoolError::INVALID_TRANSACTION;
     }
 
-    // Check pool capacity
-    if (is_pool_full()) {
-        evict_low_fee_transactions();
-        if (is_pool_full()) {
-            return MempoolError::POOL_FULL;
-        }
-    }
-
-    // Create mempool entry
-    uint64_t current_time = get_current_timestamp();
-    MempoolEntry entry{
-        transaction,
-        calculate_priority(transaction, current_time),
-        current_time,
-        current_time,
-        {}  // No dependencies for now
-    };
-
-    // Update account nonce tracking
-    update_account_nonce(transaction.from(), transaction.nonce(), tx_hash);
-
-    // Add to storage
-    transactions_[tx_hash] = std::move(entry);
-    priority_queue_.emplace(entry.priority.calculate_score(), tx_hash);
+    std::vector<chainforge::core::Hash> evicted;
+    auto result = admit_locked(transaction, tx_hash, get_current_timestamp(), evicted);
 
-    // Notify callback
-    if (on_transaction_added_) {
-        lock.unlock();  // Unlock before calling callback
+    // Notify callbacks
+    lock.unlock();  // Unlock before calling callbacks
+    notify_removed(evicted);
+    if (result == MempoolError::SUCCESS && on_transaction_added_) {
         on_transaction_added_(tx_hash);
     }
 
-    return MempoolError::SUCCESS;
+    return result;
+}
+
+std::vector<MempoolError> MempoolImpl::add_transactions(std::span<const chainforge::core::Transaction> transactions) {
+    std::vector<MempoolError> results(transactions.size(), MempoolError::SUCCESS);
+    admit_and_notify(transactions, {}, results);
+    return results;
 }
 
 MempoolError MempoolImpl::remove_transaction(const chainforge::core::Hash& tx_hash) {
@@ -74,16 +70,8 @@ MempoolError MempoolImpl::remove_transaction(const chainforge::core::Hash& tx_ha
         return MempoolError::INVALID_TRANSACTION;
     }
 
-    const auto& entry = it->second;
-
-    // Update account nonce tracking
-    remove_account_nonce(entry.transaction.from(), entry.transaction.nonce());
-
-    // Remove from storage
-    transactions_.erase(it);
-
-    // Rebuild priority queue (inefficient but correct)
-    rebuild_priority_queue();
+    // Remove from storage and indexes
+    erase_entry(it);
 
     // Notify callback
     if (on_transaction_removed_) {
@@ -102,7 +90,7 @@ std::optional<chainforge::core::Transaction> MempoolImpl::get_transaction(const
         return std::nullopt;
     }
 
-    return it->second.transaction;
+    return *it->second.transaction;
 }
 
 bool MempoolImpl::has_transaction(const chainforge::core::Hash& tx_hash) const {
@@ -111,10 +99,17 @@ bool MempoolImpl::has_transaction(const chainforge::core::Hash& tx_hash) const {
 }
 
 MempoolError MempoolImpl::replace_transaction(const chainforge::core::Transaction& new_transaction) {
+    auto new_hash = new_transaction.calculate_hash();
+
     std::unique_lock lock(mutex_);
 
-    auto new_hash = new_transaction.calculate_hash();
-    auto existing_hash = new_transaction.calculate_hash();  // Same hash for same tx
+    // Every check runs before the pooled transaction is touched, so a refused replacement leaves it in place
+    if (!validate_stateless(new_transaction, config_)) {
+        return MempoolError::INVALID_TRANSACTION;
+    }
+    if (transactions_.find(new_hash) != transactions_.end()) {
+        return MempoolError::TRANSACTION_EXISTS;
+    }
 
     // Find existing transaction by sender and nonce
     auto account_it = account_nonces_.find(new_transaction.from());
@@ -127,13 +122,8 @@ MempoolError MempoolImpl::replace_transaction(const chainforge::core::Transactio
         return MempoolError::INVALID_TRANSACTION;
     }
 
-    const auto& old_tx_hash = nonce_it->second;
-    auto old_tx_it = transactions_.find(old_tx_hash);
-    if (old_tx_it == transactions_.end()) {
-        return MempoolError::INVALID_TRANSACTION;
-    }
-
-    const auto& old_tx = old_tx_it->second.transaction;
+    auto old_tx_it = transactions_.find(nonce_it->second->first);
+    const auto& old_tx = *old_tx_it->second.transaction;
 
     // Check replacement policy
     auto replacement_error = check_replacement_policy(old_tx, new_transaction);
@@ -141,78 +131,178 @@ MempoolError MempoolImpl::replace_transaction(const chainforge::core::Transactio
         return replacement_error;
     }
 
-    // Remove old transaction
-    remove_account_nonce(old_tx.from(), old_tx.nonce());
-    transactions_.erase(old_tx_it);
-
-    // Validate and add new transaction
-    if (!validate_transaction(new_transaction)) {
-        return MempoolError::INVALID_TRANSACTION;
-    }
-
+    // The replacement takes over the old nonce slot, so the chain neither gains a nonce nor grows, and the
+    // nonce and package-size checks of admission do not apply
+    auto replaced_hash = old_tx_it->first;
     uint64_t current_time = get_current_timestamp();
     MempoolEntry entry{
-        new_transaction,
+        std::make_shared<const chainforge::core::Transaction>(new_transaction),
         calculate_priority(new_transaction, current_time),
         current_time,
         current_time,
+        {},
+        {},
         {}
     };
 
-    update_account_nonce(new_transaction.from(), new_transaction.nonce(), new_hash);
-    transactions_[new_hash] = std::move(entry);
-    rebuild_priority_queue();
+    replace_entry(old_tx_it, new_hash, std::move(entry));
+
+    // Notify callbacks
+    lock.unlock();  // Unlock before calling callbacks
+    if (on_transaction_removed_) {
+        on_transaction_removed_(replaced_hash);
+    }
+    if (on_transaction_added_) {
+        on_transaction_added_(new_hash);
+    }
 
     return MempoolError::SUCCESS;
 }
 
-std::vector<chainforge::core::Transaction> MempoolImpl::get_top_transactions(size_t count) {
+std::vector<chainforge::core::Transaction> MempoolImpl::get_top_transactions(size_t count) const {
+    return copy_transactions(get_top_transaction_handles(count));
+}
+
+std::vector<chainforge::core::Transaction> MempoolImpl::get_transactions_for_block(size_t max_count, uint64_t max_gas_limit) const {
+    return copy_transactions(get_block_transaction_handles(max_count, max_gas_limit));
+}
+
+std::vector<TransactionHandle> MempoolImpl::get_top_transaction_handles(size_t count) const {
     std::shared_lock lock(mutex_);
 
-    std::vector<chainforge::core::Transaction> result;
+    std::vector<TransactionHandle> result;
     result.reserve(std::min(count, transactions_.size()));
 
-    // Copy priority queue to avoid modifying the original
-    auto temp_queue = priority_queue_;
+    // Walk the priority index in order; no heap copy needed
+    for (auto key_it = priority_index_.begin(); key_it != priority_index_.end() && result.size() < count; ++key_it) {
+        result.push_back(key_it->second);
+    }
+
+    return result;
+}
+
+std::vector<TransactionHandle> MempoolImpl::get_block_transaction_handles(size_t max_count, uint64_t max_gas_limit) const {
+    auto packages = get_block_packages(max_count, max_gas_limit);
 
-    while (!temp_queue.empty() && result.size() < count) {
-        auto [score, tx_hash] = temp_queue.top();
-        temp_queue.pop();
+    // The lock is released by now, so size from the packages rather than the pool
+    size_t total = 0;
+    for (const auto& [score, package] : packages) {
+        total += package.transactions.size();
+    }
 
-        auto it = transactions_.find(tx_hash);
-        if (it != transactions_.end()) {
-            result.push_back(it->second.transaction);
+    std::vector<TransactionHandle> result;
+    result.reserve(total);
+
+    for (auto& [score, package] : packages) {
+        for (auto& tx : package.transactions) {
+            result.push_back(std::move(tx));
         }
     }
 
     return result;
 }
 
-std::vector<chainforge::core::Transaction> MempoolImpl::get_transactions_for_block(size_t max_count, uint64_t max_gas_limit) {
+std::vector<MempoolImpl::ScoredPackage> MempoolImpl::get_block_packages(size_t max_count,
+                                                                        uint64_t max_gas_limit) const {
     std::shared_lock lock(mutex_);
 
-    std::vector<chainforge::core::Transaction> result;
-    uint64_t total_gas = 0;
+    std::vector<ScoredPackage> result;
+    size_t taken = 0;
+    uint64_t remaining_gas = max_gas_limit;
+
+    // k-way merge over sender packages: the per-sender package index is already ordered, and once a
+    // package is taken the best package from the rest of that chain joins the successor heap. A package
+    // that does not fit blocks the rest of its chain, and packing continues with other senders.
+    using Candidate = std::pair<PriorityKey, SenderPackage>;
+    auto lower_score = [](const Candidate& a, const Candidate& b) { return a.first < b.first; };
+    std::priority_queue<Candidate, std::vector<Candidate>, decltype(lower_score)> successors(lower_score);
+    auto package_it = sender_packages_.begin();
+
+    while (taken < max_count && remaining_gas >= MIN_TRANSACTION_GAS) {
+        Candidate candidate;
+        if (package_it != sender_packages_.end() &&
+            (successors.empty() || !(package_it->first < successors.top().first))) {
+            candidate = *package_it++;
+        } else if (!successors.empty()) {
+            candidate = successors.top();
+            successors.pop();
+        } else {
+            break;
+        }
+
+        const auto& head = candidate.second.head;
+        const auto& chain = account_nonces_.find(head->from())->second;
+        auto start = chain.find(head->nonce());
+
+        uint64_t package_gas = 0;
+        auto end = start;
+        for (size_t i = 0; i < candidate.second.length; ++i, ++end) {
+            package_gas += end->second->second.transaction->gas_limit();
+        }
+        if (package_gas > remaining_gas || taken + candidate.second.length > max_count) {
+            continue;
+        }
+        remaining_gas -= package_gas;
+        taken += candidate.second.length;
 
-    // Copy priority queue to avoid modifying the original
-    auto temp_queue = priority_queue_;
+        auto& [score, package] = result.emplace_back(candidate.first.first, BlockPackage{package_gas, {}});
+        package.transactions.reserve(candidate.second.length);
+        for (auto it = start; it != end; ++it) {
+            package.transactions.push_back(it->second->second.transaction);
+        }
 
-    while (!temp_queue.empty() && result.size() < max_count) {
-        auto [score, tx_hash] = temp_queue.top();
-        temp_queue.pop();
+        if (end != chain.end() && end->first == std::prev(end)->first + 1) {
+            auto next = best_package(chain, end);
+            successors.emplace(PriorityKey{next->first, end->second->first},
+                               SenderPackage{end->second->second.transaction, next->second});
+        }
+    }
 
-        auto it = transactions_.find(tx_hash);
-        if (it != transactions_.end()) {
-            const auto& tx = it->second.transaction;
+    return result;
+}
 
-            // Check gas limit
-            if (total_gas + tx.gas_limit() <= max_gas_limit) {
-                result.push_back(tx);
-                total_gas += tx.gas_limit();
-            }
+size_t MempoolImpl::remove_included_transactions(std::span<const chainforge::core::Transaction> included) {
+    std::unique_lock lock(mutex_);
+    std::vector<chainforge::core::Hash> removed;
+
+    for (const auto& tx : included) {
+        // Everything at or below an included nonce is either that transaction or can no longer be mined
+        for (auto account_it = account_nonces_.find(tx.from());
+             account_it != account_nonces_.end() && account_it->second.begin()->first <= tx.nonce();
+             account_it = account_nonces_.find(tx.from())) {
+            auto tx_hash = account_it->second.begin()->second->first;
+            erase_entry(transactions_.find(tx_hash));
+            removed.push_back(tx_hash);
         }
     }
 
+    lock.unlock();  // Unlock before calling callbacks
+    notify_removed(removed);
+
+    return removed.size();
+}
+
+std::vector<chainforge::core::Transaction> MempoolImpl::copy_transactions(const std::vector<TransactionHandle>& handles) {
+    std::vector<chainforge::core::Transaction> result;
+    result.reserve(handles.size());
+
+    for (const auto& handle : handles) {
+        result.push_back(*handle);
+    }
+
+    return result;
+}
+
+std::vector<MempoolImpl::ScoredTransaction> MempoolImpl::get_top_scored_transactions(size_t count) const {
+    std::shared_lock lock(mutex_);
+
+    std::vector<ScoredTransaction> result;
+    result.reserve(std::min(count, transactions_.size()));
+
+    for (auto key_it = priority_index_.begin(); key_it != priority_index_.end() && result.size() < count; ++key_it) {
+        result.emplace_back(key_it->first.first, key_it->second);
+    }
+
     return result;
 }
 
@@ -231,18 +321,37 @@ std::vector<chainforge::core::Hash> MempoolImpl::get_all_transaction_hashes() co
 
 void MempoolImpl::evict_expired_transactions() {
     std::unique_lock lock(mutex_);
-    evict_transactions_by_age(3600);  // 1 hour
+    auto locked_at = std::chrono::steady_clock::now();
+    auto evicted = evict_transactions_by_age(config_.transaction_ttl_seconds);
+    record_eviction_pause(locked_at);
+
+    lock.unlock();  // Unlock before calling callbacks
+    notify_removed(evicted);
 }
 
 void MempoolImpl::evict_low_fee_transactions() {
     std::unique_lock lock(mutex_);
+    auto locked_at = std::chrono::steady_clock::now();
+    auto evicted = evict_low_fee_transactions_locked();
+    record_eviction_pause(locked_at);
 
-    if (transactions_.size() < config_.max_transactions * config_.eviction_threshold_ratio) {
-        return;  // Not full enough to evict
-    }
+    lock.unlock();  // Unlock before calling callbacks
+    notify_removed(evicted);
+}
 
-    size_t target_count = static_cast<size_t>(config_.max_transactions * 0.8);  // Target 80% capacity
-    evict_transactions_by_fee(transactions_.size() - target_count);
+void MempoolImpl::run_maintenance() {
+    std::unique_lock lock(mutex_);
+    auto locked_at = std::chrono::steady_clock::now();
+
+    auto evicted = evict_transactions_by_age(config_.transaction_ttl_seconds);
+    auto low_fee = evict_low_fee_transactions_locked();
+    evicted.insert(evicted.end(), low_fee.begin(), low_fee.end());
+
+    record_eviction_pause(locked_at);
+    ++eviction_metrics_.maintenance_runs;
+
+    lock.unlock();  // Unlock before calling callbacks
+    notify_removed(evicted);
 }
 
 void MempoolImpl::clear() {
@@ -250,10 +359,13 @@ void MempoolImpl::clear() {
 
     transactions_.clear();
     account_nonces_.clear();
-
-    while (!priority_queue_.empty()) {
-        priority_queue_.pop();
-    }
+    priority_index_.clear();
+    sender_packages_.clear();
+    eviction_index_.clear();
+    total_size_bytes_ = 0;
+    total_fee_per_gas_ = 0;
+    fee_index_.clear();
+    time_index_.clear();
 }
 
 MempoolStats MempoolImpl::get_stats() const {
@@ -266,29 +378,23 @@ MempoolStats MempoolImpl::get_stats() const {
         return stats;
     }
 
-    uint64_t current_time = get_current_timestamp();
-    uint64_t total_fee = 0;
-    uint64_t min_age = UINT64_MAX;
-
-    for (const auto& [hash, entry] : transactions_) {
-        stats.total_size_bytes += entry.transaction.size();
-        total_fee += entry.transaction.gas_price();
-        min_age = std::min(min_age, current_time - entry.added_timestamp);
-
-        if (stats.min_fee_per_gas == 0 || entry.transaction.gas_price() < stats.min_fee_per_gas) {
-            stats.min_fee_per_gas = entry.transaction.gas_price();
-        }
-        if (entry.transaction.gas_price() > stats.max_fee_per_gas) {
-            stats.max_fee_per_gas = entry.transaction.gas_price();
-        }
-    }
-
-    stats.avg_fee_per_gas = static_cast<double>(total_fee) / transactions_.size();
-    stats.oldest_transaction_age = min_age;
+    stats.total_size_bytes = total_size_bytes_;
+    stats.min_fee_per_gas = *fee_index_.begin();
+    stats.max_fee_per_gas = *fee_index_.rbegin();
+    stats.avg_fee_per_gas = static_cast<double>(total_fee_per_gas_) / static_cast<double>(transactions_.size());
+    // Entries admitted before the wall clock stepped back can be newer than now
+    uint64_t now = get_current_timestamp();
+    uint64_t oldest = time_index_.begin()->first;
+    stats.oldest_transaction_age = now > oldest ? now - oldest : 0;
 
     return stats;
 }
 
+EvictionMetrics MempoolImpl::get_eviction_metrics() const {
+    std::shared_lock lock(mutex_);
+    return eviction_metrics_;
+}
+
 bool MempoolImpl::validate_transaction(const chainforge::core::Transaction& transaction) const {
     return validate_basic_properties(transaction) &&
            validate_fee(transaction) &&
@@ -320,6 +426,126 @@ void MempoolImpl::set_transaction_removed_callback(TransactionRemovedCallback ca
     on_transaction_removed_ = std::move(callback);
 }
 
+void MempoolImpl::set_transactions_added_callback(TransactionsAddedCallback callback) {
+    std::unique_lock lock(mutex_);
+    on_transactions_added_ = std::move(callback);
+}
+
+void MempoolImpl::prepare_batch(std::span<const chainforge::core::Transaction> transactions, const MempoolConfig& config,
+                                std::span<chainforge::core::Hash> hashes, std::span<MempoolError> results) {
+    auto prepare = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            hashes[i] = transactions[i].calculate_hash();
+            if (!validate_stateless(transactions[i], config)) {
+                results[i] = MempoolError::INVALID_TRANSACTION;
+            }
+        }
+    };
+
+    // Contiguous slices on the shared pool, which the calling thread works on too; small batches run inline
+    chainforge::core::WorkerPool& pool = chainforge::core::WorkerPool::shared();
+    const size_t count = transactions.size();
+    const size_t slices = std::clamp<size_t>(count / PREPARE_ITEMS_PER_SLICE, 1, pool.size() + 1);
+    if (slices == 1) {
+        prepare(0, count);
+        return;
+    }
+    const size_t chunk = (count + slices - 1) / slices;
+    pool.run(slices, [&](size_t slice) {
+        prepare(std::min(count, slice * chunk), std::min(count, (slice + 1) * chunk));
+    });
+}
+
+std::vector<size_t> MempoolImpl::admission_order(std::span<const chainforge::core::Transaction> transactions) {
+    std::vector<size_t> order(transactions.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+
+    std::unordered_map<chainforge::core::Address, std::vector<size_t>, chainforge::core::AddressKeyHash,
+                       chainforge::core::AddressKeyEqual>
+        positions;
+    for (size_t i = 0; i < transactions.size(); ++i) {
+        positions[transactions[i].from()].push_back(i);
+    }
+
+    // Stable, so duplicates of one nonce keep their input order
+    std::vector<size_t> sorted;
+    for (const auto& [sender, slots] : positions) {
+        if (slots.size() < 2) {
+            continue;
+        }
+        sorted.assign(slots.begin(), slots.end());
+        std::stable_sort(sorted.begin(), sorted.end(), [&](size_t a, size_t b) {
+            return transactions[a].nonce() < transactions[b].nonce();
+        });
+        for (size_t k = 0; k < slots.size(); ++k) {
+            order[slots[k]] = sorted[k];
+        }
+    }
+
+    return order;
+}
+
+MempoolError MempoolImpl::save_snapshot(const std::filesystem::path& path) const {
+    // Entries are shared handles, so the file is written after the lock is released
+    return write_snapshot(path, snapshot_entries());
+}
+
+MempoolError MempoolImpl::load_snapshot(const std::filesystem::path& path) {
+    SnapshotReader reader(path);
+    std::vector<chainforge::core::Transaction> transactions;
+    std::vector<uint64_t> added_times;
+    std::vector<MempoolError> results;
+
+    while (reader.read_batch(SNAPSHOT_BATCH_SIZE, transactions, added_times)) {
+        results.assign(transactions.size(), MempoolError::SUCCESS);
+        admit_and_notify(transactions, added_times, results);
+    }
+
+    return reader.status();
+}
+
+std::vector<SnapshotEntry> MempoolImpl::snapshot_entries() const {
+    std::shared_lock lock(mutex_);
+
+    std::vector<SnapshotEntry> entries;
+    entries.reserve(transactions_.size());
+
+    for (const auto& [sender, nonces] : account_nonces_) {
+        for (const auto& [nonce, link] : nonces) {
+            entries.push_back({link->second.transaction, link->second.added_timestamp});
+        }
+    }
+
+    return entries;
+}
+
+MempoolImpl::BatchAdmission MempoolImpl::admit_batch(std::span<const chainforge::core::Transaction> transactions,
+                                                     std::span<const chainforge::core::Hash> hashes,
+                                                     std::span<const size_t> indices, std::span<MempoolError> results,
+                                                     std::span<const uint64_t> added_times) {
+    BatchAdmission admission;
+    admission.added.reserve(indices.size());
+
+    std::unique_lock lock(mutex_);
+    uint64_t current_time = get_current_timestamp();
+
+    // Sequential under the lock; callers pass indices from admission_order, so each sender's nonces ascend
+    for (size_t i : indices) {
+        if (results[i] != MempoolError::SUCCESS) {
+            continue;
+        }
+
+        // A snapshot taken before the wall clock stepped back may carry times from the future; those count as now
+        uint64_t added_time = added_times.empty() ? current_time : std::min(added_times[i], current_time);
+        results[i] = admit_locked(transactions[i], hashes[i], added_time, admission.evicted);
+        if (results[i] == MempoolError::SUCCESS) {
+            admission.added.push_back(hashes[i]);
+        }
+    }
+
+    return admission;
+}
+
 // Helper methods implementation
 uint64_t MempoolImpl::get_current_timestamp() const {
     return static_cast<uint64_t>(
@@ -333,18 +559,18 @@ TransactionPriority MempoolImpl::calculate_priority(const chainforge::core::Tran
     uint64_t current_time = get_current_timestamp();
     return TransactionPriority{
         static_cast<double>(tx.gas_price()),
-        current_time - added_time,
+        current_time > added_time ? current_time - added_time : 0,
         tx.size()
     };
 }
 
 bool MempoolImpl::is_pool_full() const {
     return transactions_.size() >= config_.max_transactions ||
-           get_stats().total_size_bytes >= config_.max_size_bytes;
+           total_size_bytes_ >= config_.max_size_bytes;
 }
 
-void MempoolImpl::update_account_nonce(const chainforge::core::Address& address, uint64_t nonce, const chainforge::core::Hash& tx_hash) {
-    account_nonces_[address][nonce] = tx_hash;
+void MempoolImpl::update_account_nonce(const chainforge::core::Address& address, uint64_t nonce, ChainLink link) {
+    account_nonces_[address][nonce] = link;
 }
 
 void MempoolImpl::remove_account_nonce(const chainforge::core::Address& address, uint64_t nonce) {
@@ -363,20 +589,273 @@ std::optional<uint64_t> MempoolImpl::get_account_nonce(const chainforge::core::A
         return std::nullopt;
     }
 
-    // Return the highest nonce
-    auto nonce_it = std::max_element(account_it->second.begin(), account_it->second.end(),
-        [](const auto& a, const auto& b) { return a.first < b.first; });
-    return nonce_it->first;
+    // Nonces are kept ordered, so the highest one is the last key
+    return account_it->second.rbegin()->first;
 }
 
-void MempoolImpl::rebuild_priority_queue() {
-    while (!priority_queue_.empty()) {
-        priority_queue_.pop();
+MempoolError MempoolImpl::admit_locked(const chainforge::core::Transaction& tx, const chainforge::core::Hash& tx_hash,
+                                       uint64_t added_time, std::vector<chainforge::core::Hash>& evicted) {
+    // Check if transaction already exists
+    if (transactions_.find(tx_hash) != transactions_.end()) {
+        return MempoolError::TRANSACTION_EXISTS;
+    }
+
+    // Checks that depend on what is already pooled
+    if (!validate_nonce(tx)) {
+        return MempoolError::INVALID_TRANSACTION;
+    }
+    if (!validate_dependencies(tx)) {
+        return MempoolError::PACKAGE_TOO_LARGE;
     }
 
-    for (const auto& [hash, entry] : transactions_) {
-        priority_queue_.emplace(entry.priority.calculate_score(), hash);
+    // Check pool capacity
+    if (is_pool_full()) {
+        auto freed = evict_low_fee_transactions_locked();
+        evicted.insert(evicted.end(), freed.begin(), freed.end());
+        if (is_pool_full()) {
+            return MempoolError::POOL_FULL;
+        }
     }
+
+    // The entry shares one immutable copy; readers only ever see it through const
+    MempoolEntry entry{
+        std::make_shared<const chainforge::core::Transaction>(tx),
+        calculate_priority(tx, added_time),
+        added_time,
+        added_time,
+        {},  // Parent and package aggregates are filled in by insert_entry
+        {},
+        {}
+    };
+
+    // Add to storage and indexes
+    insert_entry(tx_hash, std::move(entry));
+    return MempoolError::SUCCESS;
+}
+
+void MempoolImpl::admit_and_notify(std::span<const chainforge::core::Transaction> transactions,
+                                   std::span<const uint64_t> added_times, std::span<MempoolError> results) {
+    std::vector<chainforge::core::Hash> hashes(transactions.size());
+
+    MempoolConfig config;
+    {
+        std::shared_lock lock(mutex_);
+        config = config_;
+    }
+    prepare_batch(transactions, config, hashes, results);
+
+    auto order = admission_order(transactions);
+    auto admission = admit_batch(transactions, hashes, order, results, added_times);
+
+    // Adds first, so an entry evicted later in the same batch ends up reported as removed
+    notify_added(admission.added);
+    notify_removed(admission.evicted);
+}
+
+void MempoolImpl::notify_added(const std::vector<chainforge::core::Hash>& hashes) const {
+    if (hashes.empty()) {
+        return;
+    }
+
+    if (on_transactions_added_) {
+        on_transactions_added_(hashes);
+        return;
+    }
+
+    if (on_transaction_added_) {
+        for (const auto& hash : hashes) {
+            on_transaction_added_(hash);
+        }
+    }
+}
+
+MempoolImpl::PriorityKey MempoolImpl::make_priority_key(const chainforge::core::Hash& tx_hash, const MempoolEntry& entry) {
+    return PriorityKey{entry.priority.ordering_key(entry.added_timestamp), tx_hash};
+}
+
+void MempoolImpl::index_entry(const chainforge::core::Hash& tx_hash, const MempoolEntry& entry) {
+    priority_index_.emplace(make_priority_key(tx_hash, entry), entry.transaction);
+
+    total_size_bytes_ += entry.transaction->size();
+    total_fee_per_gas_ += entry.transaction->gas_price();
+    fee_index_.insert(entry.transaction->gas_price());
+    time_index_.emplace(entry.added_timestamp, tx_hash);
+}
+
+void MempoolImpl::unindex_entry(const chainforge::core::Hash& tx_hash, const MempoolEntry& entry) {
+    eviction_index_.erase({eviction_key(entry), tx_hash});
+    priority_index_.erase(make_priority_key(tx_hash, entry));
+
+    total_size_bytes_ -= entry.transaction->size();
+    total_fee_per_gas_ -= entry.transaction->gas_price();
+    fee_index_.erase(fee_index_.find(entry.transaction->gas_price()));
+    time_index_.erase({entry.added_timestamp, tx_hash});
+}
+
+void MempoolImpl::insert_entry(const chainforge::core::Hash& tx_hash, MempoolEntry entry) {
+    const auto sender = entry.transaction->from();
+    unindex_sender_package(sender);
+
+    index_entry(tx_hash, entry);
+
+    auto nonce = entry.transaction->nonce();
+    auto [it, inserted] = transactions_.insert_or_assign(tx_hash, std::move(entry));
+    update_account_nonce(sender, nonce, &*it);
+    relink_sender_chain(sender, nonce);
+    index_sender_package(sender);
+}
+
+void MempoolImpl::erase_entry(EntryMap::iterator it) {
+    const auto& entry = it->second;
+    const auto sender = entry.transaction->from();
+    const auto nonce = entry.transaction->nonce();
+    unindex_sender_package(sender);
+
+    unindex_entry(it->first, entry);
+    remove_account_nonce(sender, nonce);
+
+    transactions_.erase(it);
+    relink_sender_chain(sender, nonce);
+    index_sender_package(sender);
+}
+
+void MempoolImpl::replace_entry(EntryMap::iterator it, const chainforge::core::Hash& tx_hash, MempoolEntry entry) {
+    const auto sender = entry.transaction->from();
+    const auto nonce = entry.transaction->nonce();
+    unindex_sender_package(sender);
+
+    // The nonce slot is repointed rather than emptied, so the chain never shows a gap
+    unindex_entry(it->first, it->second);
+    transactions_.erase(it);
+
+    index_entry(tx_hash, entry);
+    auto [new_it, inserted] = transactions_.insert_or_assign(tx_hash, std::move(entry));
+    update_account_nonce(sender, nonce, &*new_it);
+    relink_sender_chain(sender, nonce);
+    index_sender_package(sender);
+}
+
+void MempoolImpl::relink_sender_chain(const chainforge::core::Address& sender, uint64_t nonce) {
+    auto account_it = account_nonces_.find(sender);
+    if (account_it == account_nonces_.end()) {
+        return;
+    }
+    const auto& chain = account_it->second;
+    const auto upper = chain.lower_bound(nonce);
+
+    // Entries from the changed nonce up: ancestors are the lower neighbour's sum plus the entry itself
+    for (auto it = upper; it != chain.end(); ++it) {
+        auto& entry = it->second->second;
+        if (it == chain.begin()) {
+            entry.ancestors = {};
+            entry.dependencies.clear();
+        } else {
+            const auto& parent = *std::prev(it)->second;
+            entry.ancestors = parent.second.ancestors;
+            if (entry.dependencies.size() != 1 || entry.dependencies.front() != parent.first) {
+                entry.dependencies.assign(1, parent.first);
+            }
+        }
+        entry.ancestors.add(entry.priority, entry.transaction->gas_limit(), entry.added_timestamp);
+    }
+
+    // Entries at or below it: descendants are the upper neighbour's sum plus the entry itself. Only these
+    // descendant sums change, so only their eviction keys move.
+    auto below = (upper != chain.end() && upper->first == nonce) ? std::next(upper) : upper;
+    for (auto it = std::make_reverse_iterator(below); it != chain.rend(); ++it) {
+        auto& entry = it->second->second;
+        if (entry.descendants.count != 0) {  // Zero only for the entry being inserted, which is not indexed yet
+            eviction_index_.erase({eviction_key(entry), it->second->first});
+        }
+        entry.descendants = it == chain.rbegin() ? PackageStats{} : std::prev(it)->second->second.descendants;
+        entry.descendants.add(entry.priority, entry.transaction->gas_limit(), entry.added_timestamp);
+        eviction_index_.emplace(eviction_key(entry), it->second->first);
+    }
+}
+
+void MempoolImpl::unindex_sender_package(const chainforge::core::Address& sender) {
+    auto account_it = account_nonces_.find(sender);
+    if (account_it == account_nonces_.end()) {
+        return;
+    }
+
+    // The stored sums are unchanged since the package was indexed, so the key reads back the same
+    const auto& chain = account_it->second;
+    if (auto package = head_package(chain)) {
+        sender_packages_.erase(PriorityKey{package->first, chain.begin()->second->first});
+    }
+}
+
+void MempoolImpl::index_sender_package(const chainforge::core::Address& sender) {
+    auto account_it = account_nonces_.find(sender);
+    if (account_it == account_nonces_.end()) {
+        return;
+    }
+
+    const auto& chain = account_it->second;
+    if (auto package = head_package(chain)) {
+        const auto& head = *chain.begin()->second;
+        sender_packages_.emplace(PriorityKey{package->first, head.first}, SenderPackage{head.second.transaction, package->second});
+    }
+}
+
+std::optional<std::pair<double, size_t>> MempoolImpl::head_package(const NonceChain& chain) {
+    if (chain.empty()) {
+        return std::nullopt;
+    }
+
+    // Each entry's ancestor sum is the prefix from the head ending at it, accumulated in the same order
+    // best_package uses, so the best contiguous prefix is read off without re-summing
+    double best_key = 0.0;
+    size_t best_length = 0;
+    uint64_t expected_nonce = chain.begin()->first;
+    for (auto it = chain.begin(); it != chain.end() && it->first == expected_nonce; ++it, ++expected_nonce) {
+        const auto& ancestors = it->second->second.ancestors;
+        double key = ancestors.ordering_key();
+        if (best_length == 0 || key > best_key) {
+            best_key = key;
+            best_length = ancestors.count;
+        }
+    }
+
+    return std::make_pair(best_key, best_length);
+}
+
+double MempoolImpl::eviction_key(const MempoolEntry& entry) {
+    return std::max(entry.priority.ordering_key(entry.added_timestamp), entry.descendants.ordering_key());
+}
+
+std::optional<std::pair<double, size_t>> MempoolImpl::best_package(const NonceChain& chain,
+                                                                   NonceChain::const_iterator start) {
+    if (start == chain.end()) {
+        return std::nullopt;
+    }
+
+    // Every contiguous prefix from start is a valid package; keep the one with the best key
+    PackageStats package;
+    double best_key = 0.0;
+    size_t best_length = 0;
+    uint64_t expected_nonce = start->first;
+
+    for (auto it = start; it != chain.end() && it->first == expected_nonce; ++it, ++expected_nonce) {
+        const auto& entry = it->second->second;
+        package.add(entry.priority, entry.transaction->gas_limit(), entry.added_timestamp);
+
+        double key = package.ordering_key();
+        if (best_length == 0 || key > best_key) {
+            best_key = key;
+            best_length = package.count;
+        }
+    }
+
+    return std::make_pair(best_key, best_length);
+}
+
+bool MempoolImpl::validate_stateless(const chainforge::core::Transaction& tx, const MempoolConfig& config) {
+    return tx.is_valid() &&
+           tx.gas_price() >= config.min_fee_per_gas &&
+           tx.gas_price() <= config.max_fee_per_gas &&
+           !tx.is_too_large();
 }
 
 bool MempoolImpl::validate_basic_properties(const chainforge::core::Transaction& tx) const {
@@ -398,59 +877,122 @@ bool MempoolImpl::validate_nonce(const chainforge::core::Transaction& tx) const
 }
 
 bool MempoolImpl::validate_dependencies(const chainforge::core::Transaction& tx) const {
-    // For now, no dependency validation
-    return true;
+    // Admission appends to the sender's chain, so the new entry's ancestors are the whole pooled chain
+    auto account_it = account_nonces_.find(tx.from());
+    return account_it == account_nonces_.end() || account_it->second.size() < config_.max_package_size;
 }
 
 bool MempoolImpl::validate_size(const chainforge::core::Transaction& tx) const {
     return !tx.is_too_large();
 }
 
-void MempoolImpl::evict_transactions_by_age(uint64_t max_age_seconds) {
+std::vector<chainforge::core::Hash> MempoolImpl::evict_transactions_by_age(uint64_t max_age_seconds) {
     uint64_t current_time = get_current_timestamp();
     std::vector<chainforge::core::Hash> to_remove;
-
-    for (const auto& [hash, entry] : transactions_) {
-        if (entry.is_expired(current_time, max_age_seconds)) {
-            to_remove.push_back(hash);
+    std::unordered_set<chainforge::core::Hash> chosen;
+
+    // Oldest first, so stop at the first entry that has not expired. An expired parent takes its
+    // descendants along, as fee eviction does, rather than leaving them behind a nonce gap.
+    for (auto time_it = time_index_.begin(); time_it != time_index_.end(); ++time_it) {
+        const auto& [added_time, hash] = *time_it;
+        if (current_time <= added_time || current_time - added_time <= max_age_seconds) {
+            break;
         }
+        take_with_descendants(hash, chosen, to_remove);
     }
 
     for (const auto& hash : to_remove) {
-        remove_transaction(hash);
+        erase_entry(transactions_.find(hash));
     }
+
+    eviction_metrics_.expired_evicted += to_remove.size();
+    return to_remove;
 }
 
-void MempoolImpl::evict_transactions_by_fee(size_t count) {
+std::vector<chainforge::core::Hash> MempoolImpl::evict_low_fee_transactions_locked() {
+    if (transactions_.size() < config_.max_transactions * config_.eviction_threshold_ratio) {
+        return {};  // Not full enough to evict
+    }
+
+    size_t target_count = static_cast<size_t>(config_.max_transactions * 0.8);  // Target 80% capacity
+    return evict_transactions_by_fee(transactions_.size() - target_count);
+}
+
+std::vector<chainforge::core::Hash> MempoolImpl::evict_transactions_by_fee(size_t count) {
     auto to_evict = select_transactions_to_evict(count);
 
     for (const auto& hash : to_evict) {
-        remove_transaction(hash);
+        erase_entry(transactions_.find(hash));
     }
-}
 
-std::vector<chainforge::core::Hash> MempoolImpl::select_transactions_to_evict(size_t count) const {
-    std::vector<std::pair<double, chainforge::core::Hash>> candidates;
+    eviction_metrics_.fee_evicted += to_evict.size();
+    return to_evict;
+}
 
-    for (const auto& [hash, entry] : transactions_) {
-        candidates.emplace_back(entry.priority.calculate_score(), hash);
+void MempoolImpl::notify_removed(const std::vector<chainforge::core::Hash>& hashes) const {
+    if (!on_transaction_removed_) {
+        return;
     }
 
-    // Sort by score (ascending - lowest priority first)
-    std::sort(candidates.begin(), candidates.end());
+    for (const auto& hash : hashes) {
+        on_transaction_removed_(hash);
+    }
+}
 
+std::vector<chainforge::core::Hash> MempoolImpl::select_transactions_to_evict(size_t count) const {
     std::vector<chainforge::core::Hash> to_evict;
-    to_evict.reserve(std::min(count, candidates.size()));
+    to_evict.reserve(std::min(count, eviction_index_.size()));
+    std::unordered_set<chainforge::core::Hash> chosen;
 
-    for (size_t i = 0; i < std::min(count, candidates.size()); ++i) {
-        to_evict.push_back(candidates[i].second);
+    // Lowest eviction keys first; each pick takes its descendants along
+    for (auto key_it = eviction_index_.begin(); key_it != eviction_index_.end() && to_evict.size() < count; ++key_it) {
+        if (chosen.count(key_it->second) != 0) {
+            continue;
+        }
+
+        take_with_descendants(key_it->second, chosen, to_evict);
     }
 
     return to_evict;
 }
 
+void MempoolImpl::take_with_descendants(const chainforge::core::Hash& tx_hash,
+                                        std::unordered_set<chainforge::core::Hash>& chosen,
+                                        std::vector<chainforge::core::Hash>& to_evict) const {
+    // Highest nonce first, so erasing in this order never strands a transaction behind a missing parent
+    const auto& tx = *transactions_.find(tx_hash)->second.transaction;
+    const auto& chain = account_nonces_.find(tx.from())->second;
+    for (auto it = chain.rbegin(); it != chain.rend() && it->first >= tx.nonce(); ++it) {
+        if (chosen.insert(it->second->first).second) {
+            to_evict.push_back(it->second->first);
+        }
+    }
+}
+
+void MempoolImpl::record_eviction_pause(std::chrono::steady_clock::time_point locked_at) {
+    auto pause = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - locked_at);
+    auto pause_us = static_cast<uint64_t>(pause.count());
+
+    eviction_metrics_.last_pause_us = pause_us;
+    eviction_metrics_.max_pause_us = std::max(eviction_metrics_.max_pause_us, pause_us);
+    eviction_metrics_.total_pause_us += pause_us;
+}
+
+void MempoolImpl::restart_maintenance_worker(const MempoolConfig& config) {
+    // Joins any running worker; it only takes mutex_ inside run_maintenance, which is not held here
+    maintenance_worker_.reset();
+
+    if (config.background_eviction) {
+        maintenance_worker_ = std::make_unique<MaintenanceWorker>(
+            std::chrono::seconds(static_cast<std::chrono::seconds::rep>(config.eviction_interval_seconds)), [this]() { run_maintenance(); });
+    }
+}
+
 // Factory function
 std::unique_ptr<Mempool> create_mempool(const MempoolConfig& config) {
+    if (config.shard_count > 1) {
+        return std::make_unique<ShardedMempool>(config);
+    }
     return std::make_unique<MempoolImpl>(config);
 }
 
@@ -466,6 +1008,9 @@ std::string mempool_error_to_string(MempoolError error) {
         case MempoolError::NONCE_TOO_HIGH: return "Nonce too high";
         case MempoolError::REPLACE_UNDERPRICED: return "Replacement underpriced";
         case MempoolError::DEPENDENCY_MISSING: return "Dependency missing";
+        case MempoolError::SNAPSHOT_IO_ERROR: return "Snapshot I/O error";
+        case MempoolError::SNAPSHOT_CORRUPT: return "Snapshot corrupt";
+        case MempoolError::PACKAGE_TOO_LARGE: return "Package too large";
         default: return "Unknown error";
     }
 }
@@ -1,8 +1,13 @@
 #pragma once
 
 #include "chainforge/mempool/mempool.hpp"
+#include "maintenance_worker.hpp"
+#include "snapshot.hpp"
 #include <unordered_map>
-#include <queue>
+#include <unordered_set>
+#include <map>
+#include <set>
+#include <functional>
 #include <shared_mutex>
 #include <chrono>
 
@@ -22,6 +27,7 @@ public:
 
     // Transaction management
     MempoolError add_transaction(const chainforge::core::Transaction& transaction) override;
+    std::vector<MempoolError> add_transactions(std::span<const chainforge::core::Transaction> transactions) override;
     MempoolError remove_transaction(const chainforge::core::Hash& tx_hash) override;
     std::optional<chainforge::core::Transaction> get_transaction(const chainforge::core::Hash& tx_hash) const override;
     bool has_transaction(const chainforge::core::Hash& tx_hash) const override;
@@ -30,17 +36,26 @@ public:
     MempoolError replace_transaction(const chainforge::core::Transaction& new_transaction) override;
 
     // Batch operations
-    std::vector<chainforge::core::Transaction> get_top_transactions(size_t count) override;
-    std::vector<chainforge::core::Transaction> get_transactions_for_block(size_t max_count, uint64_t max_gas_limit) override;
+    std::vector<chainforge::core::Transaction> get_top_transactions(size_t count) const override;
+    std::vector<chainforge::core::Transaction> get_transactions_for_block(size_t max_count, uint64_t max_gas_limit) const override;
     std::vector<chainforge::core::Hash> get_all_transaction_hashes() const override;
+    std::vector<TransactionHandle> get_top_transaction_handles(size_t count) const override;
+    std::vector<TransactionHandle> get_block_transaction_handles(size_t max_count, uint64_t max_gas_limit) const override;
+    size_t remove_included_transactions(std::span<const chainforge::core::Transaction> included) override;
 
     // Maintenance
     void evict_expired_transactions() override;
     void evict_low_fee_transactions() override;
+    void run_maintenance() override;
     void clear() override;
 
     // Statistics
     MempoolStats get_stats() const override;
+    EvictionMetrics get_eviction_metrics() const override;
+
+    // Persistence
+    MempoolError save_snapshot(const std::filesystem::path& path) const override;
+    MempoolError load_snapshot(const std::filesystem::path& path) override;
 
     // Validation
     bool validate_transaction(const chainforge::core::Transaction& transaction) const override;
@@ -50,8 +65,49 @@ public:
     // Callbacks
     void set_transaction_added_callback(TransactionAddedCallback callback) override;
     void set_transaction_removed_callback(TransactionRemovedCallback callback) override;
+    void set_transactions_added_callback(TransactionsAddedCallback callback) override;
+
+    // Priority-ordered (ordering key, handle) pairs for callers that merge several pools; keys compare across pools
+    using ScoredTransaction = std::pair<double, TransactionHandle>;
+    std::vector<ScoredTransaction> get_top_scored_transactions(size_t count) const;
+    // A sender package of a block template: consecutive nonces that are taken or skipped as a unit
+    struct BlockPackage {
+        uint64_t gas = 0;
+        std::vector<TransactionHandle> transactions;
+    };
+    using ScoredPackage = std::pair<double, BlockPackage>;
+    // Block template in inclusion order: per-sender packages merged by score, packed against max_gas_limit
+    std::vector<ScoredPackage> get_block_packages(size_t max_count, uint64_t max_gas_limit) const;
+
+    // Deep copies for the value-returning interface methods
+    static std::vector<chainforge::core::Transaction> copy_transactions(const std::vector<TransactionHandle>& handles);
+
+    // Batch admission stages, shared with the sharded pool.
+    // prepare_batch hashes and runs the state-free checks in parallel without any lock;
+    // admit_batch admits the listed indices under one write lock and fires no callbacks.
+    // added_times, when not empty, carries each transaction's original admission time (snapshot restore).
+    struct BatchAdmission {
+        std::vector<chainforge::core::Hash> added;
+        std::vector<chainforge::core::Hash> evicted;
+    };
+    static void prepare_batch(std::span<const chainforge::core::Transaction> transactions, const MempoolConfig& config,
+                              std::span<chainforge::core::Hash> hashes, std::span<MempoolError> results);
+    // Admission order for the batch: input order, except that each sender's transactions are put in nonce
+    // order within the positions they already hold, so relayed batches need not arrive sorted
+    static std::vector<size_t> admission_order(std::span<const chainforge::core::Transaction> transactions);
+    BatchAdmission admit_batch(std::span<const chainforge::core::Transaction> transactions,
+                               std::span<const chainforge::core::Hash> hashes,
+                               std::span<const size_t> indices, std::span<MempoolError> results,
+                               std::span<const uint64_t> added_times = {});
+
+    // Pooled entries sender by sender in nonce order, ready for write_snapshot
+    std::vector<SnapshotEntry> snapshot_entries() const;
+    static constexpr size_t SNAPSHOT_BATCH_SIZE = 4096;
 
 private:
+    // Floor enforced by Transaction::validate_gas; once less gas remains no pooled transaction can fit
+    static constexpr uint64_t MIN_TRANSACTION_GAS = 21000;
+
     // Thread safety
     mutable std::shared_mutex mutex_;
 
@@ -59,37 +115,109 @@ private:
     MempoolConfig config_;
 
     // Storage
-    std::unordered_map<chainforge::core::Hash, MempoolEntry> transactions_;
-    std::unordered_map<chainforge::core::Address, std::unordered_map<uint64_t, chainforge::core::Hash>> account_nonces_;
-
-    // Priority queue for efficient selection (max-heap by priority score)
-    using PriorityQueueEntry = std::pair<double, chainforge::core::Hash>;  // (score, hash)
-    std::priority_queue<PriorityQueueEntry> priority_queue_;
+    using EntryMap = std::unordered_map<chainforge::core::Hash, MempoolEntry, chainforge::core::HashKeyHash,
+                                        chainforge::core::HashKeyEqual>;
+    EntryMap transactions_;
+
+    // Per-sender chains in nonce order. Links point at transactions_ nodes, which stay put across rehashing,
+    // so chain walks reach hash and entry without a lookup.
+    using ChainLink = EntryMap::value_type*;
+    using NonceChain = std::map<uint64_t, ChainLink>;
+    std::unordered_map<chainforge::core::Address, NonceChain, chainforge::core::AddressKeyHash,
+                       chainforge::core::AddressKeyEqual>
+        account_nonces_;
+
+    // Ordered priority index (highest score first); O(log n) insert/erase, in-order top-k walks.
+    // Keyed on TransactionPriority::ordering_key, which stays valid as entries age, so nothing is ever rescored.
+    // Values are the entries' handles so ordered walks never go back through transactions_.
+    using PriorityKey = std::pair<double, chainforge::core::Hash>;  // (ordering key, hash)
+    std::map<PriorityKey, TransactionHandle, std::greater<PriorityKey>> priority_index_;
+
+    // Best-paying package per sender: the contiguous run from its lowest pooled nonce with the highest
+    // ancestor fee rate (child pays for parent). Keyed (package key, head hash); the block template merges from here.
+    struct SenderPackage {
+        TransactionHandle head;
+        size_t length = 0;
+    };
+    std::map<PriorityKey, SenderPackage, std::greater<PriorityKey>> sender_packages_;
+
+    // Eviction order, lowest first: max(own key, descendant package key), so a well-paying child protects
+    // its parents. Evicting an entry takes its descendants with it.
+    std::set<PriorityKey> eviction_index_;
+
+    // Running totals kept by insert_entry/erase_entry so stats and capacity checks are O(1)
+    size_t total_size_bytes_ = 0;
+    uint64_t total_fee_per_gas_ = 0;
+    std::multiset<uint64_t> fee_index_;         // Gas prices, ordered for min/max
+
+    // (added time, hash), oldest first: expiry walks only what has expired, and stats read the oldest age
+    std::set<std::pair<uint64_t, chainforge::core::Hash>> time_index_;
 
     // Callbacks
     TransactionAddedCallback on_transaction_added_;
     TransactionRemovedCallback on_transaction_removed_;
+    TransactionsAddedCallback on_transactions_added_;
+
+    // Eviction metrics (guarded by mutex_)
+    EvictionMetrics eviction_metrics_;
+
+    // Background maintenance; declared last so it stops before the state it touches is destroyed
+    std::unique_ptr<MaintenanceWorker> maintenance_worker_;
 
     // Helper methods
     uint64_t get_current_timestamp() const;
     TransactionPriority calculate_priority(const chainforge::core::Transaction& tx, uint64_t added_time) const;
     bool is_pool_full() const;
-    void update_account_nonce(const chainforge::core::Address& address, uint64_t nonce, const chainforge::core::Hash& tx_hash);
+    void update_account_nonce(const chainforge::core::Address& address, uint64_t nonce, ChainLink link);
     void remove_account_nonce(const chainforge::core::Address& address, uint64_t nonce);
     std::optional<uint64_t> get_account_nonce(const chainforge::core::Address& address) const;
-    void rebuild_priority_queue();
+
+    // Index maintenance (caller holds the write lock)
+    static PriorityKey make_priority_key(const chainforge::core::Hash& tx_hash, const MempoolEntry& entry);
+    void insert_entry(const chainforge::core::Hash& tx_hash, MempoolEntry entry);
+    void erase_entry(EntryMap::iterator it);
+    // Swaps the entry at it for one with the same sender and nonce (replace-by-fee)
+    void replace_entry(EntryMap::iterator it, const chainforge::core::Hash& tx_hash, MempoolEntry entry);
+    // The per-entry indexes and running totals, without the sender chain
+    void index_entry(const chainforge::core::Hash& tx_hash, const MempoolEntry& entry);
+    void unindex_entry(const chainforge::core::Hash& tx_hash, const MempoolEntry& entry);
+
+    // Sender chain maintenance (caller holds the write lock). relink_sender_chain updates aggregates around a
+    // nonce that was just inserted or erased: ancestor sums of the entries above it and descendant sums (and
+    // eviction keys) of the entries at or below it, each folded from its unchanged neighbour, so the work is
+    // O(depth) of the changed entry. The head package is read off the stored ancestor sums.
+    void relink_sender_chain(const chainforge::core::Address& sender, uint64_t nonce);
+    void unindex_sender_package(const chainforge::core::Address& sender);
+    void index_sender_package(const chainforge::core::Address& sender);
+    static double eviction_key(const MempoolEntry& entry);
+    static std::optional<std::pair<double, size_t>> head_package(const NonceChain& chain);
+    static std::optional<std::pair<double, size_t>> best_package(const NonceChain& chain, NonceChain::const_iterator start);
+
+    // Admission (caller holds the write lock; tx_hash and stateless checks already done)
+    MempoolError admit_locked(const chainforge::core::Transaction& tx, const chainforge::core::Hash& tx_hash,
+                              uint64_t added_time, std::vector<chainforge::core::Hash>& evicted);
+    void notify_added(const std::vector<chainforge::core::Hash>& hashes) const;
+    void admit_and_notify(std::span<const chainforge::core::Transaction> transactions,
+                          std::span<const uint64_t> added_times, std::span<MempoolError> results);
 
     // Validation helpers
+    static bool validate_stateless(const chainforge::core::Transaction& tx, const MempoolConfig& config);
     bool validate_basic_properties(const chainforge::core::Transaction& tx) const;
     bool validate_fee(const chainforge::core::Transaction& tx) const;
     bool validate_nonce(const chainforge::core::Transaction& tx) const;
     bool validate_dependencies(const chainforge::core::Transaction& tx) const;
     bool validate_size(const chainforge::core::Transaction& tx) const;
 
-    // Eviction helpers
-    void evict_transactions_by_age(uint64_t max_age_seconds);
-    void evict_transactions_by_fee(size_t target_count);
+    // Eviction helpers (caller holds the write lock; return the evicted hashes)
+    std::vector<chainforge::core::Hash> evict_transactions_by_age(uint64_t max_age_seconds);
+    std::vector<chainforge::core::Hash> evict_low_fee_transactions_locked();
+    std::vector<chainforge::core::Hash> evict_transactions_by_fee(size_t target_count);
+    void notify_removed(const std::vector<chainforge::core::Hash>& hashes) const;
     std::vector<chainforge::core::Hash> select_transactions_to_evict(size_t count) const;
+    void take_with_descendants(const chainforge::core::Hash& tx_hash, std::unordered_set<chainforge::core::Hash>& chosen,
+                               std::vector<chainforge::core::Hash>& to_evict) const;
+    void record_eviction_pause(std::chrono::steady_clock::time_point locked_at);
+    void restart_maintenance_worker(const MempoolConfig& config);
 };
 
 } // namespace chainforge::mempool
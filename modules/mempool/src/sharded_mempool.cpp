@@ -0,0 +1,482 @@
+#include "sharded_mempool.hpp"
+#include "chainforge/core/address.hpp"
+#include <algorithm>
+#include <queue>
+#include <tuple>
+#include <unordered_set>
+
+namespace chainforge::mempool {
+
+ShardedMempool::ShardedMempool(const MempoolConfig& config) : config_(config) {
+    size_t count = std::max<size_t>(1, config.shard_count);
+    config_.shard_count = count;
+    auto shard_config = make_shard_config(config_);
+
+    shards_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        auto shard = std::make_unique<MempoolImpl>(shard_config);
+        shard->set_transaction_added_callback([this, i](const chainforge::core::Hash& tx_hash) {
+            on_shard_added(i, tx_hash);
+        });
+        shard->set_transaction_removed_callback([this](const chainforge::core::Hash& tx_hash) {
+            on_shard_removed(tx_hash);
+        });
+        shards_.push_back(std::move(shard));
+    }
+
+    restart_maintenance_worker(config_);
+}
+
+void ShardedMempool::set_config(const MempoolConfig& config) {
+    std::lock_guard reconfigure(reconfigure_mutex_);
+
+    // The shard count is fixed at construction; only limits are re-split
+    MempoolConfig updated = config;
+    updated.shard_count = shards_.size();
+    {
+        std::unique_lock lock(config_mutex_);
+        config_ = updated;
+    }
+
+    auto shard_config = make_shard_config(updated);
+    for (auto& shard : shards_) {
+        shard->set_config(shard_config);
+    }
+
+    restart_maintenance_worker(updated);
+}
+
+const MempoolConfig& ShardedMempool::get_config() const {
+    std::shared_lock lock(config_mutex_);
+    return config_;
+}
+
+MempoolError ShardedMempool::add_transaction(const chainforge::core::Transaction& transaction) {
+    return shards_[shard_for_sender(transaction.from())]->add_transaction(transaction);
+}
+
+std::vector<MempoolError> ShardedMempool::add_transactions(std::span<const chainforge::core::Transaction> transactions) {
+    std::vector<MempoolError> results(transactions.size(), MempoolError::SUCCESS);
+    admit_and_notify(transactions, {}, results);
+    return results;
+}
+
+void ShardedMempool::admit_and_notify(std::span<const chainforge::core::Transaction> transactions,
+                                      std::span<const uint64_t> added_times, std::span<MempoolError> results) {
+    std::vector<chainforge::core::Hash> hashes(transactions.size());
+
+    MempoolConfig config;
+    {
+        std::shared_lock lock(config_mutex_);
+        config = config_;
+    }
+    MempoolImpl::prepare_batch(transactions, config, hashes, results);
+
+    // Group by shard in admission order, which a sender's shard-local nonce checks rely on
+    std::vector<std::vector<size_t>> per_shard(shards_.size());
+    for (size_t i : MempoolImpl::admission_order(transactions)) {
+        if (results[i] == MempoolError::SUCCESS) {
+            per_shard[shard_for_sender(transactions[i].from())].push_back(i);
+        }
+    }
+
+    std::vector<chainforge::core::Hash> added;
+    std::vector<chainforge::core::Hash> evicted;
+    added.reserve(transactions.size());
+
+    for (size_t shard = 0; shard < shards_.size(); ++shard) {
+        if (per_shard[shard].empty()) {
+            continue;
+        }
+
+        auto admission = shards_[shard]->admit_batch(transactions, hashes, per_shard[shard], results, added_times);
+        for (const auto& hash : admission.added) {
+            record_shard(shard, hash);
+        }
+        added.insert(added.end(), admission.added.begin(), admission.added.end());
+        evicted.insert(evicted.end(), admission.evicted.begin(), admission.evicted.end());
+    }
+
+    {
+        std::shared_lock lock(callback_mutex_);
+        if (!added.empty() && on_transactions_added_) {
+            on_transactions_added_(added);
+        } else if (on_transaction_added_) {
+            for (const auto& hash : added) {
+                on_transaction_added_(hash);
+            }
+        }
+    }
+
+    for (const auto& hash : evicted) {
+        on_shard_removed(hash);
+    }
+}
+
+MempoolError ShardedMempool::remove_transaction(const chainforge::core::Hash& tx_hash) {
+    auto shard = find_shard(tx_hash);
+    if (!shard) {
+        return MempoolError::INVALID_TRANSACTION;
+    }
+    return shards_[*shard]->remove_transaction(tx_hash);
+}
+
+std::optional<chainforge::core::Transaction> ShardedMempool::get_transaction(const chainforge::core::Hash& tx_hash) const {
+    auto shard = find_shard(tx_hash);
+    if (!shard) {
+        return std::nullopt;
+    }
+    return shards_[*shard]->get_transaction(tx_hash);
+}
+
+bool ShardedMempool::has_transaction(const chainforge::core::Hash& tx_hash) const {
+    auto shard = find_shard(tx_hash);
+    return shard && shards_[*shard]->has_transaction(tx_hash);
+}
+
+MempoolError ShardedMempool::replace_transaction(const chainforge::core::Transaction& new_transaction) {
+    return shards_[shard_for_sender(new_transaction.from())]->replace_transaction(new_transaction);
+}
+
+std::vector<chainforge::core::Transaction> ShardedMempool::get_top_transactions(size_t count) const {
+    return MempoolImpl::copy_transactions(get_top_transaction_handles(count));
+}
+
+std::vector<chainforge::core::Transaction> ShardedMempool::get_transactions_for_block(size_t max_count, uint64_t max_gas_limit) const {
+    return MempoolImpl::copy_transactions(get_block_transaction_handles(max_count, max_gas_limit));
+}
+
+std::vector<TransactionHandle> ShardedMempool::get_top_transaction_handles(size_t count) const {
+    auto merged = merge_top_scored(count);
+
+    std::vector<TransactionHandle> result;
+    result.reserve(std::min(count, merged.size()));
+
+    for (auto& [score, tx] : merged) {
+        if (result.size() >= count) {
+            break;
+        }
+        result.push_back(std::move(tx));
+    }
+
+    return result;
+}
+
+std::vector<TransactionHandle> ShardedMempool::get_block_transaction_handles(size_t max_count, uint64_t max_gas_limit) const {
+    // Senders never span shards, so each shard's packages already hold every chain in nonce order;
+    // merging by head keeps that order as long as a sender stops at its first package that does not fit.
+    // Packages are taken whole, so a CPFP parent never lands in the block without the child paying for it.
+    std::vector<std::vector<MempoolImpl::ScoredPackage>> per_shard;
+    per_shard.reserve(shards_.size());
+    for (const auto& shard : shards_) {
+        per_shard.push_back(shard->get_block_packages(max_count, max_gas_limit));
+    }
+    auto merged = merge_scored(std::move(per_shard));
+
+    size_t candidates = 0;
+    for (const auto& [score, package] : merged) {
+        candidates += package.transactions.size();
+    }
+
+    std::vector<TransactionHandle> result;
+    result.reserve(std::min(max_count, candidates));
+    std::unordered_set<chainforge::core::Address, chainforge::core::AddressKeyHash, chainforge::core::AddressKeyEqual>
+        blocked_senders;
+    uint64_t remaining_gas = max_gas_limit;
+
+    for (auto& [score, package] : merged) {
+        if (result.size() >= max_count) {
+            break;
+        }
+        const auto& sender = package.transactions.front()->from();
+        if (blocked_senders.count(sender) != 0) {
+            continue;
+        }
+
+        if (package.gas > remaining_gas || result.size() + package.transactions.size() > max_count) {
+            blocked_senders.insert(sender);
+            continue;
+        }
+        remaining_gas -= package.gas;
+        for (auto& tx : package.transactions) {
+            result.push_back(std::move(tx));
+        }
+    }
+
+    return result;
+}
+
+size_t ShardedMempool::remove_included_transactions(std::span<const chainforge::core::Transaction> included) {
+    std::vector<std::vector<chainforge::core::Transaction>> per_shard(shards_.size());
+    for (const auto& tx : included) {
+        per_shard[shard_for_sender(tx.from())].push_back(tx);
+    }
+
+    // Shards report each removal through on_shard_removed, which keeps the lookup in step
+    size_t removed = 0;
+    for (size_t shard = 0; shard < shards_.size(); ++shard) {
+        if (!per_shard[shard].empty()) {
+            removed += shards_[shard]->remove_included_transactions(per_shard[shard]);
+        }
+    }
+
+    return removed;
+}
+
+std::vector<chainforge::core::Hash> ShardedMempool::get_all_transaction_hashes() const {
+    std::vector<chainforge::core::Hash> hashes;
+
+    for (const auto& shard : shards_) {
+        auto shard_hashes = shard->get_all_transaction_hashes();
+        hashes.insert(hashes.end(), shard_hashes.begin(), shard_hashes.end());
+    }
+
+    return hashes;
+}
+
+void ShardedMempool::evict_expired_transactions() {
+    for (auto& shard : shards_) {
+        shard->evict_expired_transactions();
+    }
+}
+
+void ShardedMempool::evict_low_fee_transactions() {
+    for (auto& shard : shards_) {
+        shard->evict_low_fee_transactions();
+    }
+}
+
+void ShardedMempool::run_maintenance() {
+    // Shard by shard, so each pause only blocks one shard's writers
+    for (auto& shard : shards_) {
+        shard->run_maintenance();
+    }
+}
+
+void ShardedMempool::clear() {
+    for (auto& shard : shards_) {
+        shard->clear();
+    }
+
+    for (auto& stripe : lookup_) {
+        std::unique_lock lock(stripe.mutex);
+        stripe.shard_of.clear();
+    }
+}
+
+MempoolStats ShardedMempool::get_stats() const {
+    MempoolStats stats;
+    double total_fee = 0.0;
+
+    for (const auto& shard : shards_) {
+        auto shard_stats = shard->get_stats();
+        if (shard_stats.transaction_count == 0) {
+            continue;
+        }
+
+        if (stats.transaction_count == 0 || shard_stats.min_fee_per_gas < stats.min_fee_per_gas) {
+            stats.min_fee_per_gas = shard_stats.min_fee_per_gas;
+        }
+        stats.max_fee_per_gas = std::max(stats.max_fee_per_gas, shard_stats.max_fee_per_gas);
+        stats.oldest_transaction_age = std::max(stats.oldest_transaction_age, shard_stats.oldest_transaction_age);
+
+        stats.transaction_count += shard_stats.transaction_count;
+        stats.total_size_bytes += shard_stats.total_size_bytes;
+        total_fee += shard_stats.avg_fee_per_gas * static_cast<double>(shard_stats.transaction_count);
+    }
+
+    if (stats.transaction_count > 0) {
+        stats.avg_fee_per_gas = total_fee / static_cast<double>(stats.transaction_count);
+    }
+
+    return stats;
+}
+
+MempoolError ShardedMempool::save_snapshot(const std::filesystem::path& path) const {
+    // Senders never span shards, so concatenating per-shard entries keeps every nonce chain in order
+    std::vector<SnapshotEntry> entries;
+    for (const auto& shard : shards_) {
+        auto shard_entries = shard->snapshot_entries();
+        entries.insert(entries.end(), std::make_move_iterator(shard_entries.begin()),
+                       std::make_move_iterator(shard_entries.end()));
+    }
+
+    return write_snapshot(path, entries);
+}
+
+MempoolError ShardedMempool::load_snapshot(const std::filesystem::path& path) {
+    SnapshotReader reader(path);
+    std::vector<chainforge::core::Transaction> transactions;
+    std::vector<uint64_t> added_times;
+    std::vector<MempoolError> results;
+
+    while (reader.read_batch(MempoolImpl::SNAPSHOT_BATCH_SIZE, transactions, added_times)) {
+        results.assign(transactions.size(), MempoolError::SUCCESS);
+        admit_and_notify(transactions, added_times, results);
+    }
+
+    return reader.status();
+}
+
+EvictionMetrics ShardedMempool::get_eviction_metrics() const {
+    EvictionMetrics metrics;
+
+    for (size_t i = 0; i < shards_.size(); ++i) {
+        auto shard_metrics = shards_[i]->get_eviction_metrics();
+        // Every pass visits each shard once; a pass still in progress has not completed everywhere
+        metrics.maintenance_runs = i == 0 ? shard_metrics.maintenance_runs
+                                          : std::min(metrics.maintenance_runs, shard_metrics.maintenance_runs);
+        metrics.expired_evicted += shard_metrics.expired_evicted;
+        metrics.fee_evicted += shard_metrics.fee_evicted;
+        metrics.max_pause_us = std::max(metrics.max_pause_us, shard_metrics.max_pause_us);
+        metrics.total_pause_us += shard_metrics.total_pause_us;
+        metrics.last_pause_us = std::max(metrics.last_pause_us, shard_metrics.last_pause_us);
+    }
+
+    return metrics;
+}
+
+bool ShardedMempool::validate_transaction(const chainforge::core::Transaction& transaction) const {
+    return shards_[shard_for_sender(transaction.from())]->validate_transaction(transaction);
+}
+
+MempoolError ShardedMempool::check_replacement_policy(const chainforge::core::Transaction& old_tx,
+                                                      const chainforge::core::Transaction& new_tx) const {
+    return shards_[shard_for_sender(old_tx.from())]->check_replacement_policy(old_tx, new_tx);
+}
+
+void ShardedMempool::set_transaction_added_callback(TransactionAddedCallback callback) {
+    std::unique_lock lock(callback_mutex_);
+    on_transaction_added_ = std::move(callback);
+}
+
+void ShardedMempool::set_transaction_removed_callback(TransactionRemovedCallback callback) {
+    std::unique_lock lock(callback_mutex_);
+    on_transaction_removed_ = std::move(callback);
+}
+
+void ShardedMempool::set_transactions_added_callback(TransactionsAddedCallback callback) {
+    std::unique_lock lock(callback_mutex_);
+    on_transactions_added_ = std::move(callback);
+}
+
+// Helper methods implementation
+MempoolConfig ShardedMempool::make_shard_config(const MempoolConfig& config) {
+    size_t count = std::max<size_t>(1, config.shard_count);
+
+    auto split = [count](size_t limit) { return limit / count + (limit % count != 0 ? 1 : 0); };
+
+    MempoolConfig shard_config = config;
+    shard_config.shard_count = 1;
+    shard_config.background_eviction = false;  // The sharded pool runs one worker for all shards
+    shard_config.max_transactions = split(config.max_transactions);
+    shard_config.max_size_bytes = split(config.max_size_bytes);
+    return shard_config;
+}
+
+size_t ShardedMempool::shard_for_sender(const chainforge::core::Address& sender) const {
+    return std::hash<chainforge::core::Address>{}(sender) % shards_.size();
+}
+
+ShardedMempool::LookupStripe& ShardedMempool::stripe_for(const chainforge::core::Hash& tx_hash) {
+    return lookup_[std::hash<chainforge::core::Hash>{}(tx_hash) % LOOKUP_STRIPES];
+}
+
+const ShardedMempool::LookupStripe& ShardedMempool::stripe_for(const chainforge::core::Hash& tx_hash) const {
+    return lookup_[std::hash<chainforge::core::Hash>{}(tx_hash) % LOOKUP_STRIPES];
+}
+
+std::optional<size_t> ShardedMempool::find_shard(const chainforge::core::Hash& tx_hash) const {
+    const auto& stripe = stripe_for(tx_hash);
+    std::shared_lock lock(stripe.mutex);
+
+    auto it = stripe.shard_of.find(tx_hash);
+    if (it == stripe.shard_of.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void ShardedMempool::record_shard(size_t shard, const chainforge::core::Hash& tx_hash) {
+    auto& stripe = stripe_for(tx_hash);
+    std::unique_lock lock(stripe.mutex);
+    stripe.shard_of[tx_hash] = shard;
+}
+
+void ShardedMempool::restart_maintenance_worker(const MempoolConfig& config) {
+    // Joins any running worker; it only takes shard locks inside run_maintenance, none of which is held here
+    maintenance_worker_.reset();
+
+    if (config.background_eviction) {
+        maintenance_worker_ = std::make_unique<MaintenanceWorker>(
+            std::chrono::seconds(static_cast<std::chrono::seconds::rep>(config.eviction_interval_seconds)),
+            [this]() { run_maintenance(); });
+    }
+}
+
+void ShardedMempool::on_shard_added(size_t shard, const chainforge::core::Hash& tx_hash) {
+    record_shard(shard, tx_hash);
+
+    std::shared_lock lock(callback_mutex_);
+    if (on_transaction_added_) {
+        on_transaction_added_(tx_hash);
+    }
+}
+
+void ShardedMempool::on_shard_removed(const chainforge::core::Hash& tx_hash) {
+    {
+        auto& stripe = stripe_for(tx_hash);
+        std::unique_lock lock(stripe.mutex);
+        stripe.shard_of.erase(tx_hash);
+    }
+
+    std::shared_lock lock(callback_mutex_);
+    if (on_transaction_removed_) {
+        on_transaction_removed_(tx_hash);
+    }
+}
+
+std::vector<MempoolImpl::ScoredTransaction> ShardedMempool::merge_top_scored(size_t per_shard_count) const {
+    std::vector<std::vector<MempoolImpl::ScoredTransaction>> per_shard;
+    per_shard.reserve(shards_.size());
+
+    for (const auto& shard : shards_) {
+        per_shard.push_back(shard->get_top_scored_transactions(per_shard_count));
+    }
+
+    return merge_scored(std::move(per_shard));
+}
+
+template <typename Scored>
+std::vector<Scored> ShardedMempool::merge_scored(std::vector<std::vector<Scored>> per_shard) {
+    size_t total = 0;
+    for (const auto& sequence : per_shard) {
+        total += sequence.size();
+    }
+
+    // Max-heap of shard cursors keyed by the score at each cursor
+    using Cursor = std::tuple<double, size_t, size_t>;  // (score, shard, position)
+    std::priority_queue<Cursor> heads;
+    for (size_t i = 0; i < per_shard.size(); ++i) {
+        if (!per_shard[i].empty()) {
+            heads.emplace(per_shard[i][0].first, i, 0);
+        }
+    }
+
+    std::vector<Scored> merged;
+    merged.reserve(total);
+
+    while (!heads.empty()) {
+        auto [score, shard, position] = heads.top();
+        heads.pop();
+
+        merged.push_back(std::move(per_shard[shard][position]));
+        if (position + 1 < per_shard[shard].size()) {
+            heads.emplace(per_shard[shard][position + 1].first, shard, position + 1);
+        }
+    }
+
+    return merged;
+}
+
+} // namespace chainforge::mempool
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "mempool_impl.hpp"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace chainforge::mempool {
+
+/**
+ * Sharded transaction mempool for concurrent admission
+ *
+ * Transactions are routed to a MempoolImpl shard by sender, so nonce
+ * checks stay shard-local and senders on different shards never contend.
+ * A lock-striped hash -> shard table serves lookups and removals by hash,
+ * and selection merges the per-shard priority orders.
+ */
+class ShardedMempool : public Mempool {
+public:
+    explicit ShardedMempool(const MempoolConfig& config = {});
+    ~ShardedMempool() override = default;
+
+    // Configuration
+    void set_config(const MempoolConfig& config) override;
+    const MempoolConfig& get_config() const override;
+
+    // Transaction management
+    MempoolError add_transaction(const chainforge::core::Transaction& transaction) override;
+    std::vector<MempoolError> add_transactions(std::span<const chainforge::core::Transaction> transactions) override;
+    MempoolError remove_transaction(const chainforge::core::Hash& tx_hash) override;
+    std::optional<chainforge::core::Transaction> get_transaction(const chainforge::core::Hash& tx_hash) const override;
+    bool has_transaction(const chainforge::core::Hash& tx_hash) const override;
+
+    // RBF support
+    MempoolError replace_transaction(const chainforge::core::Transaction& new_transaction) override;
+
+    // Batch operations
+    std::vector<chainforge::core::Transaction> get_top_transactions(size_t count) const override;
+    std::vector<chainforge::core::Transaction> get_transactions_for_block(size_t max_count, uint64_t max_gas_limit) const override;
+    std::vector<chainforge::core::Hash> get_all_transaction_hashes() const override;
+    std::vector<TransactionHandle> get_top_transaction_handles(size_t count) const override;
+    std::vector<TransactionHandle> get_block_transaction_handles(size_t max_count, uint64_t max_gas_limit) const override;
+    size_t remove_included_transactions(std::span<const chainforge::core::Transaction> included) override;
+
+    // Maintenance
+    void evict_expired_transactions() override;
+    void evict_low_fee_transactions() override;
+    void run_maintenance() override;
+    void clear() override;
+
+    // Statistics
+    MempoolStats get_stats() const override;
+    EvictionMetrics get_eviction_metrics() const override;
+
+    // Persistence
+    MempoolError save_snapshot(const std::filesystem::path& path) const override;
+    MempoolError load_snapshot(const std::filesystem::path& path) override;
+
+    // Validation
+    bool validate_transaction(const chainforge::core::Transaction& transaction) const override;
+    MempoolError check_replacement_policy(const chainforge::core::Transaction& old_tx,
+                                         const chainforge::core::Transaction& new_tx) const override;
+
+    // Callbacks
+    void set_transaction_added_callback(TransactionAddedCallback callback) override;
+    void set_transaction_removed_callback(TransactionRemovedCallback callback) override;
+    void set_transactions_added_callback(TransactionsAddedCallback callback) override;
+
+    size_t shard_count() const noexcept { return shards_.size(); }
+
+private:
+    static constexpr size_t LOOKUP_STRIPES = 64;
+
+    struct LookupStripe {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<chainforge::core::Hash, size_t, chainforge::core::HashKeyHash, chainforge::core::HashKeyEqual>
+            shard_of;
+    };
+
+    // config_ is read by concurrent admissions; set_config calls are serialized by reconfigure_mutex_,
+    // which also covers the shard updates and the maintenance worker restart
+    mutable std::shared_mutex config_mutex_;
+    std::mutex reconfigure_mutex_;
+    MempoolConfig config_;
+    std::vector<std::unique_ptr<MempoolImpl>> shards_;
+    std::array<LookupStripe, LOOKUP_STRIPES> lookup_;
+
+    // Callbacks (shards report into these after their own locks are released)
+    mutable std::shared_mutex callback_mutex_;
+    TransactionAddedCallback on_transaction_added_;
+    TransactionRemovedCallback on_transaction_removed_;
+    TransactionsAddedCallback on_transactions_added_;
+
+    // One worker maintains every shard; declared last so it stops before the shards go away
+    std::unique_ptr<MaintenanceWorker> maintenance_worker_;
+
+    // Helper methods
+    static MempoolConfig make_shard_config(const MempoolConfig& config);
+    size_t shard_for_sender(const chainforge::core::Address& sender) const;
+    LookupStripe& stripe_for(const chainforge::core::Hash& tx_hash);
+    const LookupStripe& stripe_for(const chainforge::core::Hash& tx_hash) const;
+    std::optional<size_t> find_shard(const chainforge::core::Hash& tx_hash) const;
+    void on_shard_added(size_t shard, const chainforge::core::Hash& tx_hash);
+    void on_shard_removed(const chainforge::core::Hash& tx_hash);
+    void record_shard(size_t shard, const chainforge::core::Hash& tx_hash);
+    void restart_maintenance_worker(const MempoolConfig& config);
+    void admit_and_notify(std::span<const chainforge::core::Transaction> transactions,
+                          std::span<const uint64_t> added_times, std::span<MempoolError> results);
+
+    // k-way merge of per-shard (score, item) sequences, always taking the best-scored head
+    template <typename Scored>
+    static std::vector<Scored> merge_scored(std::vector<std::vector<Scored>> per_shard);
+    std::vector<MempoolImpl::ScoredTransaction> merge_top_scored(size_t per_shard_count) const;
+};
+
+} // namespace chainforge::mempool
@@ -0,0 +1,166 @@
+#include "snapshot.hpp"
+#include <array>
+#include <cstring>
+
+namespace chainforge::mempool {
+
+namespace {
+
+constexpr std::array<char, 4> SNAPSHOT_MAGIC = {'C', 'F', 'M', 'P'};
+constexpr uint32_t SNAPSHOT_VERSION = 1;
+constexpr size_t HEADER_SIZE = SNAPSHOT_MAGIC.size() + sizeof(uint32_t) + sizeof(uint64_t);
+
+// from, to, value, gas limit, gas price, nonce, admission time, payload length
+constexpr size_t FIXED_RECORD_SIZE = 2 * chainforge::core::ADDRESS_SIZE + 5 * sizeof(uint64_t) + sizeof(uint32_t);
+constexpr size_t MAX_RECORD_SIZE = FIXED_RECORD_SIZE + chainforge::core::MAX_TRANSACTION_SIZE;
+constexpr size_t WRITE_FLUSH_SIZE = 1 << 20;
+
+template<typename T>
+void put_le(std::vector<uint8_t>& out, T value) {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        out.push_back(static_cast<uint8_t>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+template<typename T>
+T get_le(const uint8_t* in) {
+    T value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        value |= static_cast<T>(static_cast<T>(in[i]) << (i * 8));
+    }
+    return value;
+}
+
+void encode_entry(std::vector<uint8_t>& out, const SnapshotEntry& entry) {
+    const auto& data = entry.transaction->data();
+    put_le<uint32_t>(out, static_cast<uint32_t>(FIXED_RECORD_SIZE + data.data.size()));
+    out.insert(out.end(), data.from.begin(), data.from.end());
+    out.insert(out.end(), data.to.begin(), data.to.end());
+    put_le<uint64_t>(out, data.value);
+    put_le<uint64_t>(out, data.gas_limit);
+    put_le<uint64_t>(out, data.gas_price);
+    put_le<uint64_t>(out, data.nonce);
+    put_le<uint64_t>(out, entry.added_timestamp);
+    put_le<uint32_t>(out, static_cast<uint32_t>(data.data.size()));
+    out.insert(out.end(), data.data.begin(), data.data.end());
+}
+
+} // namespace
+
+MempoolError write_snapshot(const std::filesystem::path& path, const std::vector<SnapshotEntry>& entries) {
+    // Write to a sibling file and rename, so a crash mid-write never leaves a truncated snapshot behind
+    auto temp_path = path;
+    temp_path += ".tmp";
+
+    std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return MempoolError::SNAPSHOT_IO_ERROR;
+    }
+
+    std::vector<uint8_t> buffer;
+    buffer.reserve(WRITE_FLUSH_SIZE + sizeof(uint32_t) + MAX_RECORD_SIZE);
+    buffer.insert(buffer.end(), SNAPSHOT_MAGIC.begin(), SNAPSHOT_MAGIC.end());
+    put_le<uint32_t>(buffer, SNAPSHOT_VERSION);
+    put_le<uint64_t>(buffer, entries.size());
+
+    for (const auto& entry : entries) {
+        encode_entry(buffer, entry);
+        if (buffer.size() >= WRITE_FLUSH_SIZE) {
+            file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+    file.write(reinterpret_cast<const char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+    file.close();
+
+    std::error_code error;
+    if (file) {
+        std::filesystem::rename(temp_path, path, error);
+    }
+    if (!file || error) {
+        std::filesystem::remove(temp_path, error);
+        return MempoolError::SNAPSHOT_IO_ERROR;
+    }
+
+    return MempoolError::SUCCESS;
+}
+
+SnapshotReader::SnapshotReader(const std::filesystem::path& path) : read_buffer_(READ_BUFFER_SIZE) {
+    file_.rdbuf()->pubsetbuf(read_buffer_.data(), static_cast<std::streamsize>(read_buffer_.size()));
+    file_.open(path, std::ios::binary);
+    if (!file_) {
+        status_ = MempoolError::SNAPSHOT_IO_ERROR;
+        return;
+    }
+
+    std::array<uint8_t, HEADER_SIZE> header{};
+    if (!file_.read(reinterpret_cast<char*>(header.data()), header.size()) ||
+        std::memcmp(header.data(), SNAPSHOT_MAGIC.data(), SNAPSHOT_MAGIC.size()) != 0 ||
+        get_le<uint32_t>(header.data() + SNAPSHOT_MAGIC.size()) != SNAPSHOT_VERSION) {
+        status_ = MempoolError::SNAPSHOT_CORRUPT;
+        return;
+    }
+
+    remaining_ = get_le<uint64_t>(header.data() + SNAPSHOT_MAGIC.size() + sizeof(uint32_t));
+    record_.reserve(FIXED_RECORD_SIZE);
+}
+
+bool SnapshotReader::read_batch(size_t max_count, std::vector<chainforge::core::Transaction>& transactions,
+                                std::vector<uint64_t>& added_times) {
+    transactions.clear();
+    added_times.clear();
+
+    while (status_ == MempoolError::SUCCESS && remaining_ > 0 && transactions.size() < max_count) {
+        uint64_t added_time = 0;
+        if (!read_record(transactions.emplace_back(), added_time)) {
+            transactions.pop_back();
+            status_ = MempoolError::SNAPSHOT_CORRUPT;
+            break;
+        }
+        added_times.push_back(added_time);
+        --remaining_;
+    }
+
+    return !transactions.empty();
+}
+
+bool SnapshotReader::read_record(chainforge::core::Transaction& transaction, uint64_t& added_time) {
+    std::array<uint8_t, sizeof(uint32_t)> length_bytes{};
+    if (!file_.read(reinterpret_cast<char*>(length_bytes.data()), length_bytes.size())) {
+        return false;
+    }
+
+    auto length = get_le<uint32_t>(length_bytes.data());
+    if (length < FIXED_RECORD_SIZE || length > MAX_RECORD_SIZE) {
+        return false;
+    }
+
+    record_.resize(length);
+    if (!file_.read(reinterpret_cast<char*>(record_.data()), static_cast<std::streamsize>(length))) {
+        return false;
+    }
+
+    chainforge::core::TransactionData data{};
+    const uint8_t* cursor = record_.data();
+    std::memcpy(data.from.data(), cursor, data.from.size());
+    cursor += data.from.size();
+    std::memcpy(data.to.data(), cursor, data.to.size());
+    cursor += data.to.size();
+    data.value = get_le<uint64_t>(cursor);
+    data.gas_limit = get_le<uint64_t>(cursor + 8);
+    data.gas_price = get_le<uint64_t>(cursor + 16);
+    data.nonce = get_le<uint64_t>(cursor + 24);
+    added_time = get_le<uint64_t>(cursor + 32);
+    auto payload_size = get_le<uint32_t>(cursor + 40);
+    cursor += 44;
+
+    if (FIXED_RECORD_SIZE + payload_size != length) {
+        return false;
+    }
+    data.data.assign(cursor, cursor + payload_size);
+
+    transaction = chainforge::core::Transaction(data);
+    return true;
+}
+
+} // namespace chainforge::mempool
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "chainforge/mempool/mempool.hpp"
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace chainforge::mempool {
+
+/**
+ * Binary mempool snapshot
+ *
+ * Header: "CFMP" magic, u32 version, u64 entry count.
+ * Entry:  u32 length, then from, to, value, gas limit, gas price, nonce,
+ *         admission timestamp, u32 payload length and the payload bytes.
+ * Integers are little-endian. Entries are written sender by sender in nonce
+ * order, so batch admission accepts them without reordering.
+ */
+struct SnapshotEntry {
+    TransactionHandle transaction;
+    uint64_t added_timestamp = 0;
+};
+
+MempoolError write_snapshot(const std::filesystem::path& path, const std::vector<SnapshotEntry>& entries);
+
+/**
+ * Streaming snapshot reader: decodes entries in caller-sized batches through one reused record buffer
+ */
+class SnapshotReader {
+public:
+    explicit SnapshotReader(const std::filesystem::path& path);
+
+    // SUCCESS until opening, the header or a record fails
+    MempoolError status() const noexcept { return status_; }
+
+    // Replaces the outputs with up to max_count entries; false once nothing is left or on error
+    bool read_batch(size_t max_count, std::vector<chainforge::core::Transaction>& transactions,
+                    std::vector<uint64_t>& added_times);
+
+private:
+    static constexpr size_t READ_BUFFER_SIZE = 1 << 20;
+
+    std::vector<char> read_buffer_;
+    std::ifstream file_;
+    std::vector<uint8_t> record_;
+    uint64_t remaining_ = 0;
+    MempoolError status_ = MempoolError::SUCCESS;
+
+    bool read_record(chainforge::core::Transaction& transaction, uint64_t& added_time);
+};
+
+} // namespace chainforge::mempool
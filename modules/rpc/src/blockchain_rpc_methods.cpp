@@ -1,6 +1,5 @@
 #include "blockchain_rpc_methods.hpp"
-#include <sstream>
-#include <iomanip>
+#include "chainforge/core/hex.hpp"
 #include <algorithm>
 
 namespace chainforge::rpc {
@@ -246,21 +245,17 @@ nlohmann::json BlockchainRpcMethodsImpl::create_mock_transaction(const std::stri
 }
 
 std::string BlockchainRpcMethodsImpl::number_to_hex(uint64_t number) const {
-    std::stringstream ss;
-    ss << "0x" << std::hex << number;
-    return ss.str();
+    char buffer[2 + core::HEX_UINT64_MAX_DIGITS] = {'0', 'x'};
+    return std::string(buffer, core::hex_encode_uint_into(number, buffer + 2));
 }
 
 uint64_t BlockchainRpcMethodsImpl::hex_to_number(const std::string& hex) const {
-    if (hex.size() < 3 || hex.substr(0, 2) != "0x") {
+    if (hex.size() < 3 || hex.compare(0, 2, "0x") != 0) {
         return 0;
     }
 
-    try {
-        return std::stoull(hex.substr(2), nullptr, 16);
-    } catch (const std::exception&) {
-        return 0;
-    }
+    uint64_t number = 0;
+    return core::hex_decode_uint(std::string_view(hex).substr(2), number) ? number : 0;
 }
 
 bool BlockchainRpcMethodsImpl::is_valid_hex(const std::string& hex, size_t expected_length) const {
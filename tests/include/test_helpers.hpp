@@ -7,7 +7,7 @@
 #include "chainforge/core/amount.hpp"
 #include "chainforge/core/timestamp.hpp"
 #include "chainforge/core/hash.hpp"
-#include <random>
+#include "chainforge/core/random.hpp"
 #include <string>
 #include <vector>
 
@@ -28,9 +28,10 @@ public:
             core::Address::random(),
             core::Amount::from_wei(RandomAmount())
         );
-        tx.set_gas_limit(21000 + (rand() % 100000));
-        tx.set_gas_price(1000000000 + (rand() % 1000000000));
-        tx.set_nonce(rand() % 1000);
+        auto& rng = core::FastRandom::thread_instance();
+        tx.set_gas_limit(21000 + rng.next_below(100000));
+        tx.set_gas_price(1000000000 + rng.next_below(1000000000));
+        tx.set_nonce(rng.next_below(1000));
         return tx;
     }
 
@@ -77,7 +78,7 @@ public:
             core::Hash::random(),
             core::Timestamp::now()
         );
-        block.set_nonce(rand() % 1000000);
+        block.set_nonce(core::FastRandom::thread_instance().next_below(1000000));
         block.set_gas_limit(8000000);
         block.set_gas_price(1000000000);
         block.set_chain_id(1);
@@ -160,7 +161,7 @@ public:
      * @brief Generate random amount (in wei)
      */
     static uint64_t RandomAmount() {
-        return 1000000 + (rand() % 1000000000);
+        return 1000000 + core::FastRandom::thread_instance().next_below(1000000000);
     }
 
     /**
@@ -168,9 +169,7 @@ public:
      */
     static std::vector<uint8_t> RandomData(size_t size) {
         std::vector<uint8_t> data(size);
-        for (size_t i = 0; i < size; ++i) {
-            data[i] = static_cast<uint8_t>(rand() % 256);
-        }
+        core::FastRandom::thread_instance().fill(data);
         return data;
     }
 
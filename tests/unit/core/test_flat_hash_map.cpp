@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "chainforge/core/flat_hash_map.hpp"
+#include "chainforge/core/hash.hpp"
+#include "chainforge/core/address.hpp"
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace chainforge::core::test {
+
+class FlatHashMapTest : public ::testing::Test {
+protected:
+    // Keys that differ only in their last bytes, the worst case for a raw fingerprint
+    static Hash structured_hash(uint32_t i) {
+        Hash256 data{};
+        for (size_t b = 0; b < 4; ++b) {
+            data[data.size() - 1 - b] = static_cast<uint8_t>(i >> (8 * b));
+        }
+        return Hash(data);
+    }
+};
+
+TEST_F(FlatHashMapTest, FingerprintsLoadTheLeadingBytes) {
+    Hash256 data{};
+    data[0] = 0x01;
+    data[7] = 0x80;
+    data[8] = 0xFF;  // outside the fingerprint
+    EXPECT_EQ(std::hash<Hash>{}(Hash(data)), 0x8000000000000001ULL);
+
+    Address160 address{};
+    address[1] = 0x02;
+    EXPECT_EQ(std::hash<Address>{}(Address(address)), 0x0200ULL);
+    EXPECT_EQ(AddressKeyHash{}(address), 0x0200ULL);
+}
+
+TEST_F(FlatHashMapTest, TransparentLookupInStandardContainers) {
+    std::unordered_map<Hash, int, HashKeyHash, HashKeyEqual> map;
+    Hash key = Hash::random();
+    map.emplace(key, 7);
+    EXPECT_EQ(map.find(key.data())->second, 7);
+    EXPECT_EQ(map.count(Hash::random().data()), 0u);
+}
+
+TEST_F(FlatHashMapTest, MatchesUnorderedMapUnderChurn) {
+    FlatHashMap<Hash, uint64_t> flat;
+    std::unordered_map<Hash, uint64_t> reference;
+    std::mt19937 rng(42);
+
+    for (uint32_t step = 0; step < 20000; ++step) {
+        Hash key = structured_hash(static_cast<uint32_t>(rng() % 3000));
+        switch (rng() % 3) {
+        case 0:
+            EXPECT_EQ(flat.try_emplace(key, step).second, reference.try_emplace(key, step).second);
+            break;
+        case 1:
+            EXPECT_EQ(flat.erase(key), reference.erase(key));
+            break;
+        default: {
+            auto it = flat.find(key);
+            auto expected = reference.find(key);
+            ASSERT_EQ(it == flat.end(), expected == reference.end());
+            if (it != flat.end()) {
+                EXPECT_EQ(it->second, expected->second);
+            }
+        }
+        }
+        ASSERT_EQ(flat.size(), reference.size());
+    }
+
+    // Every surviving entry is reachable and iteration visits each exactly once
+    size_t visited = 0;
+    for (const auto& [key, value] : flat) {
+        ASSERT_TRUE(reference.count(key));
+        EXPECT_EQ(reference.at(key), value);
+        ++visited;
+    }
+    EXPECT_EQ(visited, reference.size());
+}
+
+TEST_F(FlatHashMapTest, GrowsAndClears) {
+    FlatHashMap<Address, int, AddressKeyHash, AddressKeyEqual> map(10);
+    size_t initial_capacity = map.capacity();
+    std::vector<Address> keys;
+    for (int i = 0; i < 1000; ++i) {
+        keys.push_back(Address::random());
+        map[keys.back()] = i;
+    }
+    EXPECT_GT(map.capacity(), initial_capacity);
+    EXPECT_EQ(map.size(), 1000u);
+    for (int i = 0; i < 1000; ++i) {
+        // Heterogeneous lookup by the raw bytes
+        EXPECT_EQ(map.find(keys[static_cast<size_t>(i)].data())->second, i);
+    }
+
+    map.insert_or_assign(keys[0], -1);
+    EXPECT_EQ(map[keys[0]], -1);
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    EXPECT_FALSE(map.contains(keys[0]));
+    EXPECT_TRUE(map.begin() == map.end());
+}
+
+} // namespace chainforge::core::test
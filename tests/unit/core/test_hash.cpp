@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "chainforge/core/hash.hpp"
+#include "chainforge/core/transaction.hpp"
 #include <vector>
 
 namespace chainforge::core::test {
@@ -89,4 +90,36 @@ TEST_F(HashTest, BytesConversion) {
     EXPECT_EQ(bytes[1], 0xBB);
 }
 
+TEST_F(HashTest, Sha256KnownValue) {
+    std::vector<uint8_t> abc = {'a', 'b', 'c'};
+    EXPECT_EQ(hash_sha256(abc).to_hex(), "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST_F(HashTest, TransactionHashUsesCanonicalEncoding) {
+    TransactionData data{};
+    for (size_t i = 0; i < ADDRESS_SIZE; ++i) {
+        data.from[i] = static_cast<uint8_t>(i + 1);
+        data.to[i] = static_cast<uint8_t>(0xF0 - i);
+    }
+    data.value = 0x0102030405060708ULL;
+    data.gas_limit = 21000;
+    data.gas_price = 7;
+    data.nonce = 42;
+    data.data = std::vector<uint8_t>(100, 0xAB);
+
+    // from | to | value | gas_limit | gas_price | nonce, integers big-endian, then the payload
+    std::vector<uint8_t> encoded;
+    encoded.reserve(2 * ADDRESS_SIZE + 4 * sizeof(uint64_t) + data.data.size());
+    encoded.insert(encoded.end(), data.from.begin(), data.from.end());
+    encoded.insert(encoded.end(), data.to.begin(), data.to.end());
+    for (uint64_t field : {data.value, data.gas_limit, data.gas_price, data.nonce}) {
+        for (int shift = 56; shift >= 0; shift -= 8) {
+            encoded.push_back(static_cast<uint8_t>(field >> shift));
+        }
+    }
+    encoded.insert(encoded.end(), data.data.begin(), data.data.end());
+
+    EXPECT_EQ(Transaction(data).calculate_hash(), hash_sha256(encoded));
+}
+
 } // namespace chainforge::core::test
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "chainforge/core/hex.hpp"
+#include "chainforge/core/hash.hpp"
+#include "chainforge/core/address.hpp"
+#include "chainforge/core/amount.hpp"
+#include <string>
+#include <vector>
+
+namespace chainforge::core::test {
+
+class HexTest : public ::testing::Test {
+protected:
+    // Simple reference encoder to check both the vector blocks and the table tail against
+    static std::string reference_hex(const std::vector<uint8_t>& bytes) {
+        static const char digits[] = "0123456789abcdef";
+        std::string result;
+        for (uint8_t byte : bytes) {
+            result += digits[byte >> 4];
+            result += digits[byte & 0x0F];
+        }
+        return result;
+    }
+};
+
+TEST_F(HexTest, EncodeDecodeRoundTripsEveryLength) {
+    for (size_t size = 0; size <= 70; ++size) {
+        std::vector<uint8_t> bytes(size);
+        for (size_t i = 0; i < size; ++i) {
+            bytes[i] = static_cast<uint8_t>(i * 37 + 250);
+        }
+        std::string hex = hex_encode(bytes);
+        EXPECT_EQ(hex, reference_hex(bytes)) << size;
+
+        std::vector<uint8_t> decoded(size);
+        EXPECT_TRUE(hex_decode_into(hex, decoded.data())) << size;
+        EXPECT_EQ(decoded, bytes) << size;
+    }
+}
+
+TEST_F(HexTest, DecodeAcceptsBothCases) {
+    std::vector<uint8_t> expected(40);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        expected[i] = static_cast<uint8_t>(0xA0 + i);
+    }
+    std::string upper = reference_hex(expected);
+    for (auto& c : upper) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
+
+    std::vector<uint8_t> decoded(expected.size());
+    EXPECT_TRUE(hex_decode_into(upper, decoded.data()));
+    EXPECT_EQ(decoded, expected);
+}
+
+TEST_F(HexTest, DecodeRejectsInvalidInput) {
+    std::vector<uint8_t> out(32);
+    EXPECT_FALSE(hex_decode_into("abc", out.data()));
+
+    // Place a bad character in both the vector block and the tail
+    for (char bad : {'g', 'G', '/', ':', '@', '`', ' ', '\x80', '\xff'}) {
+        for (size_t position : {size_t{0}, size_t{17}, size_t{31}, size_t{33}}) {
+            std::string hex(34, 'a');
+            hex[position] = bad;
+            EXPECT_FALSE(hex_decode_into(hex, out.data())) << position << " " << static_cast<int>(bad);
+        }
+    }
+}
+
+TEST_F(HexTest, UnsignedIntegers) {
+    char buffer[HEX_UINT64_MAX_DIGITS];
+    EXPECT_EQ(std::string(buffer, hex_encode_uint_into(0, buffer)), "0");
+    EXPECT_EQ(std::string(buffer, hex_encode_uint_into(0x15f90, buffer)), "15f90");
+    EXPECT_EQ(std::string(buffer, hex_encode_uint_into(UINT64_MAX, buffer)), "ffffffffffffffff");
+
+    uint64_t value = 1;
+    EXPECT_TRUE(hex_decode_uint("15F90", value));
+    EXPECT_EQ(value, 0x15f90u);
+    EXPECT_TRUE(hex_decode_uint("ffffffffffffffff", value));
+    EXPECT_EQ(value, UINT64_MAX);
+    EXPECT_FALSE(hex_decode_uint("", value));
+    EXPECT_FALSE(hex_decode_uint("1ffffffffffffffff", value));
+    EXPECT_FALSE(hex_decode_uint("12x", value));
+}
+
+TEST_F(HexTest, TypesUseTheSharedCodec) {
+    Hash hash = Hash::random();
+    std::string hex = hash.to_hex();
+    EXPECT_EQ(hex, reference_hex(hash.to_bytes()));
+    EXPECT_EQ(Hash(hex), hash);
+    char hash_buffer[Hash::HEX_LENGTH];
+    EXPECT_EQ(std::string(hash_buffer, hash.to_hex_into(hash_buffer)), hex);
+    EXPECT_THROW(Hash(std::string(64, 'z')), std::invalid_argument);
+
+    Address address = Address::random();
+    EXPECT_EQ(Address(address.to_hex()), address);
+    char address_buffer[Address::HEX_LENGTH];
+    EXPECT_EQ(std::string(address_buffer, address.to_hex_into(address_buffer)), address.to_hex());
+
+    EXPECT_EQ(Amount::from_wei(0).to_hex(), "0x0");
+    EXPECT_EQ(Amount::from_wei(255).to_hex(), "0xff");
+    EXPECT_EQ(Amount::from_wei(UINT64_MAX).to_hex(), "0xffffffffffffffff");
+}
+
+} // namespace chainforge::core::test
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "chainforge/core/json_writer.hpp"
+#include "chainforge/core/block.hpp"
+#include "chainforge/core/transaction.hpp"
+#include <nlohmann/json.hpp>
+#include <string>
+
+namespace chainforge::core::test {
+
+TEST(JsonWriterTest, CompactAndPrettyLayouts) {
+    auto write = [](JsonStyle style) {
+        std::string out;
+        JsonWriter writer(out, style);
+        writer.begin_object();
+        writer.field("a", 1);
+        writer.key("list").begin_array().value(true).value(-2).null_value().begin_object().end_object().end_array();
+        writer.key("empty").begin_array().end_array();
+        writer.field("s", "x");
+        writer.end_object();
+        return out;
+    };
+
+    EXPECT_EQ(write(JsonStyle::Compact), R"({"a":1,"list":[true,-2,null,{}],"empty":[],"s":"x"})");
+
+    nlohmann::json expected = nlohmann::json::parse(write(JsonStyle::Compact));
+    EXPECT_EQ(write(JsonStyle::Pretty), nlohmann::ordered_json::parse(write(JsonStyle::Compact)).dump(2));
+    EXPECT_EQ(nlohmann::json::parse(write(JsonStyle::Pretty)), expected);
+}
+
+TEST(JsonWriterTest, EscapesStrings) {
+    std::string text = "quote\" back\\slash\nnew\ttab\x01 ctl \xc3\xa9";
+    std::string out;
+    JsonWriter(out).value(text);
+    EXPECT_EQ(out, nlohmann::json(text).dump());
+    EXPECT_EQ(nlohmann::json::parse(out).get<std::string>(), text);
+}
+
+TEST(JsonWriterTest, NumbersAndHex) {
+    std::string out;
+    const uint8_t bytes[] = {0x00, 0xAB, 0xFF};
+    JsonWriter writer(out);
+    writer.begin_array()
+        .value(UINT64_MAX)
+        .value(INT64_MIN)
+        .value(uint8_t{7})
+        .hex_value(bytes)
+        .hex_value(bytes, true)
+        .end_array();
+    EXPECT_EQ(out, R"([18446744073709551615,-9223372036854775808,7,"00abff","0x00abff"])");
+}
+
+TEST(JsonWriterTest, BlockJsonKeepsItsFormat) {
+    Block block(3, Hash::random(), Timestamp::from_seconds(1700000000));
+    for (uint64_t i = 0; i < 3; ++i) {
+        Transaction tx(Address::random(), Address::random(), Amount::from_wei(1000 + i));
+        tx.set_nonce(i);
+        block.add_transaction(tx);
+    }
+
+    // The layout the DOM-based serializer produced: sorted keys, two-space indentation
+    nlohmann::json j;
+    j["height"] = block.height();
+    j["hash"] = block.calculate_hash().to_hex();
+    j["parentHash"] = block.parent_hash().to_hex();
+    j["merkleRoot"] = block.merkle_root().to_hex();
+    j["timestamp"] = block.timestamp().seconds();
+    j["nonce"] = block.nonce();
+    j["gasLimit"] = block.gas_limit();
+    j["gasPrice"] = block.gas_price();
+    j["chainId"] = block.chain_id();
+    j["transactions"] = nlohmann::json::array();
+    for (const auto& tx : block.transactions()) {
+        nlohmann::json t;
+        t["from"] = tx.from().to_hex();
+        t["to"] = tx.to().to_hex();
+        t["value"] = tx.value().to_string();
+        t["gasLimit"] = tx.gas_limit();
+        t["gasPrice"] = tx.gas_price();
+        t["nonce"] = tx.nonce();
+        t["data"] = "0x" + std::string(64, '0');
+        t["hash"] = tx.calculate_hash().to_hex();
+        j["transactions"].push_back(t);
+    }
+
+    EXPECT_EQ(block.to_json(), j.dump(2));
+    EXPECT_EQ(block.to_json(JsonStyle::Compact), j.dump());
+    EXPECT_EQ(block.transactions()[0].to_json(), j["transactions"][0].dump(2));
+}
+
+} // namespace chainforge::core::test
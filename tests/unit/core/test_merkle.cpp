@@ -0,0 +1,351 @@
+#include <gtest/gtest.h>
+#include "chainforge/core/merkle.hpp"
+#include "chainforge/core/block.hpp"
+#include "chainforge/crypto/hash.hpp"
+#include <memory_resource>
+#include <numeric>
+#include <atomic>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace chainforge::core::test {
+
+class MerkleTest : public ::testing::Test {
+protected:
+    static std::vector<Transaction> make_transactions(size_t count) {
+        std::vector<Transaction> txs;
+        txs.reserve(count);
+        for (size_t i = 0; i < count; ++i) {
+            TransactionData data{};
+            for (size_t b = 0; b < sizeof(uint64_t); ++b) {
+                data.from[b] = static_cast<uint8_t>(i >> (b * 8));
+            }
+            data.gas_limit = 21000;
+            data.gas_price = 1;
+            data.nonce = i;
+            txs.emplace_back(data);
+        }
+        return txs;
+    }
+
+    // Level-by-level construction the optimized engine has to reproduce exactly
+    static Hash reference_root(const std::vector<Transaction>& txs) {
+        if (txs.empty()) {
+            return Hash::zero();
+        }
+        std::vector<Hash> level;
+        for (const auto& tx : txs) {
+            level.push_back(tx.calculate_hash());
+        }
+        while (level.size() > 1) {
+            std::vector<Hash> next;
+            for (size_t i = 0; i < level.size(); i += 2) {
+                next.push_back(combine_hashes(level[i], i + 1 < level.size() ? level[i + 1] : level[i]));
+            }
+            level = std::move(next);
+        }
+        return level[0];
+    }
+};
+
+TEST_F(MerkleTest, EmptyAndSingleLeaf) {
+    EXPECT_TRUE(compute_merkle_root(std::vector<Hash>{}).is_zero());
+
+    auto txs = make_transactions(1);
+    EXPECT_EQ(compute_merkle_root(txs), txs[0].calculate_hash());
+}
+
+TEST_F(MerkleTest, MatchesReferenceForEveryShape) {
+    // Covers odd widths at every level, including the duplicated last node
+    for (size_t count = 0; count <= 70; ++count) {
+        auto txs = make_transactions(count);
+        EXPECT_EQ(compute_merkle_root(txs), reference_root(txs)) << count << " leaves";
+    }
+}
+
+TEST_F(MerkleTest, ParallelLeafHashingMatchesReference) {
+    auto txs = make_transactions(MERKLE_PARALLEL_LEAF_THRESHOLD * 4 + 3);
+    Hash expected = reference_root(make_transactions(txs.size()));
+
+    EXPECT_EQ(compute_merkle_root(txs, 4), expected);
+    EXPECT_EQ(compute_merkle_root(txs, 1), expected);
+}
+
+TEST_F(MerkleTest, EveryPairBackendMatchesSerialCombine) {
+    auto saved = crypto::Hash::pair_backend();
+    std::mt19937_64 rng(2459);
+    std::vector<Hash> leaves(300);
+    for (auto& leaf : leaves) {
+        for (auto& byte : leaf.data()) {
+            byte = static_cast<uint8_t>(rng());
+        }
+    }
+
+    for (auto backend : {crypto::Hash::PairBackend::Scalar, crypto::Hash::PairBackend::Avx2,
+                         crypto::Hash::PairBackend::ShaNi}) {
+        if (!crypto::Hash::set_pair_backend(backend)) {
+            continue;
+        }
+        for (size_t count : {size_t{2}, size_t{3}, size_t{9}, size_t{17}, size_t{130}, leaves.size()}) {
+            std::vector<Hash> level(leaves.begin(), leaves.begin() + static_cast<std::ptrdiff_t>(count));
+            Hash root = compute_merkle_root(level);
+            while (level.size() > 1) {
+                std::vector<Hash> next;
+                for (size_t i = 0; i < level.size(); i += 2) {
+                    next.push_back(combine_hashes(level[i], i + 1 < level.size() ? level[i + 1] : level[i]));
+                }
+                level = std::move(next);
+            }
+            EXPECT_EQ(root, level[0]) << static_cast<int>(backend) << ", " << count << " leaves";
+
+            MerkleAccumulator accumulator;
+            accumulator.assign(std::span(leaves).first(count));
+            EXPECT_EQ(accumulator.root(), root);
+        }
+    }
+    crypto::Hash::set_pair_backend(saved);
+}
+
+TEST_F(MerkleTest, BlockUsesMerkleEngine) {
+    auto txs = make_transactions(37);
+    Block block(1, Hash::zero(), Timestamp(1));
+    for (const auto& tx : txs) {
+        block.add_transaction(tx);
+    }
+    EXPECT_EQ(block.calculate_merkle_root(), reference_root(txs));
+    EXPECT_EQ(block.merkle_root(), reference_root(txs));
+}
+
+TEST_F(MerkleTest, AccumulatorTracksAppendsAndErasures) {
+    auto txs = make_transactions(300);
+    std::vector<Hash> leaves;
+    MerkleAccumulator accumulator;
+    std::mt19937 rng(7);
+
+    for (size_t i = 0; i < txs.size(); ++i) {
+        leaves.push_back(txs[i].calculate_hash());
+        accumulator.append(leaves.back());
+        if (i % 7 == 6) {
+            size_t victim = rng() % leaves.size();
+            leaves.erase(leaves.begin() + static_cast<std::ptrdiff_t>(victim));
+            accumulator.erase(victim);
+            EXPECT_TRUE(accumulator.dirty());
+        }
+        if (i % 3 == 0) {
+            ASSERT_EQ(accumulator.root(), compute_merkle_root(leaves)) << "after " << i << " appends";
+            EXPECT_FALSE(accumulator.dirty());
+        }
+    }
+
+    // Erasing down to nothing has to shrink the tree again
+    while (!leaves.empty()) {
+        leaves.pop_back();
+        accumulator.erase(leaves.size());
+        ASSERT_EQ(accumulator.root(), compute_merkle_root(leaves)) << leaves.size() << " leaves";
+    }
+}
+
+TEST_F(MerkleTest, BlockRootFollowsRemovals) {
+    auto txs = make_transactions(50);
+    Block block(1, Hash::zero(), Timestamp(1));
+    for (const auto& tx : txs) {
+        block.add_transaction(tx);
+    }
+    Hash full_hash = block.calculate_hash();
+
+    block.remove_transaction(10);
+    block.remove_transaction(0);
+    txs.erase(txs.begin() + 10);
+    txs.erase(txs.begin());
+
+    EXPECT_EQ(block.merkle_root(), reference_root(txs));
+    EXPECT_EQ(block.header().merkle_root, reference_root(txs).data());
+    EXPECT_NE(block.calculate_hash(), full_hash);
+
+    block.add_transaction(make_transactions(60).back());
+    txs.push_back(make_transactions(60).back());
+    EXPECT_EQ(block.merkle_root(), reference_root(txs));
+    EXPECT_EQ(block.merkle_root(), block.calculate_merkle_root());
+}
+
+TEST_F(MerkleTest, SharedConstBlockIsReadOnly) {
+    auto txs = make_transactions(300);
+    Block block(1, Hash::zero(), Timestamp(1));
+    for (const auto& tx : txs) {
+        block.add_transaction(tx);
+    }
+    block.remove_transaction(3);
+    txs.erase(txs.begin() + 3);
+
+    // The removal already brought the root up to date, so concurrent readers have nothing to flush
+    const Block& shared = block;
+    const Hash root = reference_root(txs);
+    const Hash hash = shared.calculate_hash();
+    std::vector<std::thread> readers;
+    std::atomic<int> mismatches{0};
+    for (int reader = 0; reader < 4; ++reader) {
+        readers.emplace_back([&] {
+            for (int i = 0; i < 50; ++i) {
+                auto proof = shared.merkle_proof(static_cast<size_t>(i));
+                mismatches += shared.merkle_root() != root || shared.calculate_hash() != hash ||
+                              !proof || !verify_merkle_proof(root, txs[static_cast<size_t>(i)].calculate_hash(), *proof);
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0);
+}
+
+TEST_F(MerkleTest, BlockBuildsInsideAnArena) {
+    auto txs = make_transactions(40);
+    for (size_t i = 0; i < txs.size(); i += 3) {
+        txs[i].set_data(std::vector<uint8_t>(200, static_cast<uint8_t>(i)));
+    }
+
+    // Any allocation outside the arena's buffer would throw
+    std::vector<std::byte> buffer(256 * 1024);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    Block block(1, Hash::zero(), Timestamp::from_seconds(1700000000), &arena);
+    for (const auto& tx : txs) {
+        block.add_transaction(tx);
+    }
+    block.remove_transaction(5);
+    txs.erase(txs.begin() + 5);
+
+    EXPECT_EQ(block.resource(), &arena);
+    EXPECT_EQ(block.transactions()[0].payload().resource(), &arena);
+    EXPECT_EQ(block.merkle_root(), reference_root(txs));
+    EXPECT_EQ(block.calculate_merkle_root(), block.merkle_root());
+    EXPECT_TRUE(block.merkle_proof(7).has_value());
+
+    // A copy lives on the default resource and outlives the arena's contents
+    Block copy = block;
+    EXPECT_EQ(copy.resource(), std::pmr::get_default_resource());
+    EXPECT_NE(copy.transactions()[0].payload().resource(), &arena);
+    EXPECT_EQ(copy.calculate_hash(), block.calculate_hash());
+
+    Block assigned;
+    assigned = std::move(block);
+    EXPECT_EQ(assigned.merkle_root(), reference_root(txs));
+    EXPECT_NE(assigned.transactions()[0].payload().resource(), &arena);
+}
+
+TEST_F(MerkleTest, SingleProofsVerifyForEveryLeaf) {
+    for (size_t count = 1; count <= 40; ++count) {
+        auto txs = make_transactions(count);
+        Block block(1, Hash::zero(), Timestamp(1));
+        for (const auto& tx : txs) {
+            block.add_transaction(tx);
+        }
+        Hash root = block.merkle_root();
+
+        for (size_t i = 0; i < count; ++i) {
+            auto proof = block.merkle_proof(i);
+            ASSERT_TRUE(proof.has_value());
+            EXPECT_TRUE(verify_merkle_proof(root, txs[i].calculate_hash(), *proof)) << i << " of " << count;
+            EXPECT_FALSE(verify_merkle_proof(root, txs[(i + 1) % count].calculate_hash(), *proof) && count > 1);
+        }
+        EXPECT_FALSE(block.merkle_proof(count).has_value());
+    }
+}
+
+TEST_F(MerkleTest, TamperedProofIsRejected) {
+    auto txs = make_transactions(13);
+    Block block(1, Hash::zero(), Timestamp(1));
+    for (const auto& tx : txs) {
+        block.add_transaction(tx);
+    }
+    auto proof = *block.merkle_proof(5);
+    Hash leaf = txs[5].calculate_hash();
+
+    auto wrong_sibling = proof;
+    wrong_sibling.siblings[1] = Hash::random();
+    EXPECT_FALSE(verify_merkle_proof(block.merkle_root(), leaf, wrong_sibling));
+
+    auto extra_sibling = proof;
+    extra_sibling.siblings.push_back(Hash::zero());
+    EXPECT_FALSE(verify_merkle_proof(block.merkle_root(), leaf, extra_sibling));
+
+    auto wrong_index = proof;
+    wrong_index.index = 4;
+    EXPECT_FALSE(verify_merkle_proof(block.merkle_root(), leaf, wrong_index));
+}
+
+TEST_F(MerkleTest, DuplicatedTrailingLeafIsRejected) {
+    // [a, b, c] pads to [a, b, c, c], so [a, b, c, c] has the same root
+    auto txs = make_transactions(4);
+    txs.erase(txs.begin());  // Zero sender
+    for (auto& tx : txs) {
+        tx.set_to(Address::random());
+        tx.set_value(Amount::from_wei(1));
+    }
+    Block block(1, Hash::zero(), Timestamp(1));
+    for (const auto& tx : txs) {
+        block.add_transaction(tx);
+    }
+    Hash root = block.merkle_root();
+    Hash a = txs[0].calculate_hash();
+    Hash b = txs[1].calculate_hash();
+    Hash c = txs[2].calculate_hash();
+
+    MerkleProof forged{3, 4, {c, combine_hashes(a, b)}};
+    EXPECT_FALSE(verify_merkle_proof(root, c, forged));
+    forged.index = 2;
+    EXPECT_FALSE(verify_merkle_proof(root, c, forged));
+    EXPECT_FALSE(verify_merkle_multiproof(root, std::vector<Hash>{c, c}, MerkleMultiProof{{2, 3}, 4, {combine_hashes(a, b)}}));
+    EXPECT_TRUE(verify_merkle_proof(root, c, *block.merkle_proof(2)));
+
+    Block padded = block;
+    padded.add_transaction(txs[2]);
+    EXPECT_EQ(padded.merkle_root(), root);
+    EXPECT_TRUE(block.validate_transactions());
+    EXPECT_FALSE(padded.validate_transactions());
+}
+
+TEST_F(MerkleTest, MultiProofSharesSiblings) {
+    auto txs = make_transactions(100);
+    Block block(1, Hash::zero(), Timestamp(1));
+    for (const auto& tx : txs) {
+        block.add_transaction(tx);
+    }
+    block.remove_transaction(3); // proofs must see the refreshed tree
+    txs.erase(txs.begin() + 3);
+    Hash root = block.merkle_root();
+
+    std::mt19937 rng(11);
+    for (size_t round = 0; round < 50; ++round) {
+        std::vector<size_t> indices;
+        for (size_t i = 0; i < 1 + rng() % 20; ++i) {
+            indices.push_back(rng() % txs.size());
+        }
+        auto proof = block.merkle_multi_proof(indices);
+        ASSERT_TRUE(proof.has_value());
+
+        std::vector<Hash> leaves;
+        size_t single_siblings = 0;
+        for (size_t index : proof->indices) {
+            leaves.push_back(txs[index].calculate_hash());
+            single_siblings += block.merkle_proof(index)->siblings.size();
+        }
+        EXPECT_TRUE(verify_merkle_multiproof(root, leaves, *proof));
+        EXPECT_LE(proof->siblings.size(), single_siblings);
+
+        leaves.back() = Hash::random();
+        EXPECT_FALSE(verify_merkle_multiproof(root, leaves, *proof));
+    }
+
+    // Proving every leaf needs no siblings at all
+    std::vector<size_t> all(txs.size());
+    std::iota(all.begin(), all.end(), size_t{0});
+    auto everything = block.merkle_multi_proof(all);
+    ASSERT_TRUE(everything.has_value());
+    EXPECT_TRUE(everything->siblings.empty());
+
+    EXPECT_FALSE(block.merkle_multi_proof({txs.size()}).has_value());
+    EXPECT_FALSE(block.merkle_multi_proof({}).has_value());
+}
+
+} // namespace chainforge::core::test
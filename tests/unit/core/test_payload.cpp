@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include "chainforge/core/payload.hpp"
+#include "chainforge/core/transaction.hpp"
+#include <array>
+#include <memory_resource>
+#include <vector>
+
+namespace chainforge::core::test {
+
+class PayloadTest : public ::testing::Test {
+protected:
+    static std::vector<uint8_t> bytes(size_t size) {
+        std::vector<uint8_t> result(size);
+        for (size_t i = 0; i < size; ++i) {
+            result[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+        return result;
+    }
+};
+
+TEST_F(PayloadTest, EmptyByDefault) {
+    Payload payload;
+    EXPECT_TRUE(payload.empty());
+    EXPECT_EQ(payload.size(), 0u);
+    EXPECT_TRUE(payload.is_inline());
+    EXPECT_EQ(payload.heap_bytes(), 0u);
+    EXPECT_EQ(payload, std::vector<uint8_t>{});
+}
+
+TEST_F(PayloadTest, InlineUpToCapacity) {
+    for (size_t size : {size_t{1}, size_t{36}, Payload::INLINE_CAPACITY, Payload::INLINE_CAPACITY + 1, size_t{4096}}) {
+        auto expected = bytes(size);
+        Payload payload(expected);
+        EXPECT_EQ(payload.is_inline(), size <= Payload::INLINE_CAPACITY) << size;
+        EXPECT_EQ(payload.heap_bytes() == 0, payload.is_inline()) << size;
+        EXPECT_EQ(payload, expected) << size;
+        EXPECT_EQ(payload.to_vector(), expected) << size;
+        EXPECT_EQ(payload[size - 1], expected[size - 1]) << size;
+    }
+}
+
+TEST_F(PayloadTest, CopiesShareLargePayloads) {
+    auto expected = bytes(1000);
+    Payload original(expected);
+    Payload copy = original;
+    EXPECT_EQ(copy.data(), original.data());
+    EXPECT_EQ(copy, original);
+
+    // Replacing one copy leaves the other intact
+    original = Payload{0x01, 0x02};
+    EXPECT_EQ(copy, expected);
+    EXPECT_EQ(original, (std::vector<uint8_t>{0x01, 0x02}));
+
+    Payload moved = std::move(copy);
+    EXPECT_EQ(moved, expected);
+    EXPECT_TRUE(copy.empty());  // NOLINT(bugprone-use-after-move)
+
+    moved.assign(expected.data(), expected.data() + 10);
+    EXPECT_EQ(moved, bytes(10));
+}
+
+TEST_F(PayloadTest, TransactionSizeIsLogical) {
+    // A plain transfer is no larger than with the old vector payload
+    EXPECT_EQ(sizeof(Payload), 64u);
+    EXPECT_LE(sizeof(Transaction), 136u);
+
+    Transaction small;
+    small.set_data(bytes(Payload::INLINE_CAPACITY));
+    EXPECT_EQ(small.size(), sizeof(TransactionData) + Payload::INLINE_CAPACITY);
+
+    Transaction large;
+    large.set_data(bytes(1000));
+    EXPECT_EQ(large.size(), sizeof(TransactionData) + 1000);
+
+    Transaction copy = large;
+    EXPECT_EQ(copy.payload().data(), large.payload().data());
+    EXPECT_EQ(copy.calculate_hash(), large.calculate_hash());
+}
+
+TEST_F(PayloadTest, LargePayloadsFollowTheirResource) {
+    auto expected = bytes(300);
+    std::array<std::byte, 4096> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+    Payload in_arena(expected.data(), expected.size(), &arena);
+    EXPECT_EQ(in_arena.resource(), &arena);
+    EXPECT_EQ(in_arena, expected);
+
+    // Copies into the same resource share the block; plain copies leave the arena
+    Payload shared(in_arena, &arena);
+    EXPECT_EQ(shared.data(), in_arena.data());
+    Payload escaped = in_arena;
+    EXPECT_NE(escaped.data(), in_arena.data());
+    EXPECT_EQ(escaped.resource(), std::pmr::get_default_resource());
+    EXPECT_EQ(escaped, expected);
+
+    // Moving into another resource copies the bytes there
+    Payload moved(std::move(escaped), &arena);
+    EXPECT_EQ(moved.resource(), &arena);
+    EXPECT_EQ(moved, expected);
+
+    Payload small(expected.data(), Payload::INLINE_CAPACITY, &arena);
+    EXPECT_EQ(small.resource(), nullptr);
+}
+
+TEST_F(PayloadTest, PmrContainersRehomeTransactionPayloads) {
+    Transaction large;
+    large.set_data(bytes(1000));
+    auto hash = large.calculate_hash();
+
+    std::vector<std::byte> buffer(64 * 1024);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+    std::pmr::vector<Transaction> txs(&arena);
+    txs.push_back(large);
+    txs.emplace_back();
+    EXPECT_EQ(txs[0].payload().resource(), &arena);
+    EXPECT_EQ(txs[0].calculate_hash(), hash);
+    EXPECT_TRUE(txs[1].payload().empty());
+}
+
+} // namespace chainforge::core::test
@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include "chainforge/core/random.hpp"
+#include "chainforge/core/hash.hpp"
+#include "chainforge/core/address.hpp"
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace chainforge::core::test {
+
+TEST(FastRandomTest, MatchesXoshiroReferenceSequence) {
+    // First outputs for seed 0: splitmix64 expansion followed by xoshiro256**
+    FastRandom rng(0);
+    EXPECT_EQ(rng(), 0x99EC5F36CB75F2B4ULL);
+    EXPECT_EQ(rng(), 0xBF6E1F784956452AULL);
+    EXPECT_EQ(rng(), 0x1A5F849D4933E6E0ULL);
+}
+
+TEST(FastRandomTest, SeedingIsReproducible) {
+    FastRandom first(1234);
+    FastRandom second(1234);
+    FastRandom other(1235);
+    bool differs = false;
+    for (int i = 0; i < 100; ++i) {
+        uint64_t value = first();
+        EXPECT_EQ(value, second());
+        differs |= value != other();
+    }
+    EXPECT_TRUE(differs);
+
+    // Reseeding the thread's generator reproduces Hash::random
+    FastRandom::thread_instance().seed(77);
+    Hash a = Hash::random();
+    Address b = Address::random();
+    FastRandom::thread_instance().seed(77);
+    EXPECT_EQ(Hash::random(), a);
+    EXPECT_EQ(Address::random(), b);
+}
+
+TEST(FastRandomTest, NextBelowStaysInRange) {
+    FastRandom rng(9);
+    std::vector<size_t> counts(6);
+    for (int i = 0; i < 60000; ++i) {
+        uint64_t value = rng.next_below(6);
+        ASSERT_LT(value, 6u);
+        ++counts[value];
+    }
+    for (size_t count : counts) {
+        EXPECT_NEAR(static_cast<double>(count), 10000.0, 500.0);
+    }
+    EXPECT_EQ(rng.next_below(1), 0u);
+
+    // Works with the standard distributions
+    std::uniform_int_distribution<int> dice(1, 6);
+    int roll = dice(rng);
+    EXPECT_GE(roll, 1);
+    EXPECT_LE(roll, 6);
+}
+
+TEST(FastRandomTest, FillCoversEveryLength) {
+    for (size_t size = 0; size <= 33; ++size) {
+        FastRandom rng(5);
+        std::vector<uint8_t> buffer(size + 1, 0xEE);
+        rng.fill(buffer.data(), size);
+        EXPECT_EQ(buffer[size], 0xEE) << size;  // nothing written past the end
+
+        // Whole words come out in generator order
+        FastRandom expected(5);
+        for (size_t offset = 0; offset + 8 <= size; offset += 8) {
+            uint64_t word = expected();
+            EXPECT_EQ(std::memcmp(buffer.data() + offset, &word, 8), 0) << size;
+        }
+    }
+}
+
+TEST(FastRandomTest, ThreadsGetIndependentGenerators) {
+    FastRandom* main_instance = &FastRandom::thread_instance();
+    FastRandom* worker_instance = nullptr;
+    Hash worker_hash;
+    std::thread worker([&] {
+        worker_instance = &FastRandom::thread_instance();
+        worker_hash = Hash::random();
+    });
+    worker.join();
+    EXPECT_NE(main_instance, worker_instance);
+    EXPECT_NE(Hash::random(), worker_hash);
+}
+
+} // namespace chainforge::core::test
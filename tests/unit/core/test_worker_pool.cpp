@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "chainforge/core/worker_pool.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace chainforge::core::test {
+
+TEST(WorkerPoolTest, RunsEverySliceOnce) {
+    WorkerPool pool(3);
+    EXPECT_EQ(pool.size(), 3u);
+
+    for (size_t slices : {size_t{0}, size_t{1}, size_t{2}, size_t{7}, size_t{100}}) {
+        std::vector<std::atomic<int>> hits(slices);
+        pool.run(slices, [&](size_t slice) { hits[slice].fetch_add(1); });
+        for (size_t i = 0; i < slices; ++i) {
+            EXPECT_EQ(hits[i].load(), 1) << slices << " slices, slice " << i;
+        }
+    }
+}
+
+TEST(WorkerPoolTest, NestedAndConcurrentRuns) {
+    WorkerPool pool(2);
+    std::atomic<size_t> total{0};
+
+    // Slices that run() again must not deadlock, even with every worker busy
+    std::vector<std::thread> callers;
+    for (int caller = 0; caller < 3; ++caller) {
+        callers.emplace_back([&] {
+            pool.run(4, [&](size_t) {
+                pool.run(5, [&](size_t) { total.fetch_add(1); });
+            });
+        });
+    }
+    for (auto& caller : callers) {
+        caller.join();
+    }
+    EXPECT_EQ(total.load(), 3u * 4u * 5u);
+}
+
+TEST(WorkerPoolTest, SharedPoolWorksWithoutWorkers) {
+    // A single-core machine gets no background threads; the caller does everything
+    std::atomic<size_t> total{0};
+    WorkerPool::shared().run(16, [&](size_t slice) { total.fetch_add(slice); });
+    EXPECT_EQ(total.load(), 120u);
+
+    WorkerPool empty(0);
+    size_t count = 0;
+    empty.run(3, [&](size_t) { ++count; });
+    EXPECT_EQ(count, 3u);
+}
+
+} // namespace chainforge::core::test
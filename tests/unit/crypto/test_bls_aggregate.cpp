@@ -0,0 +1,290 @@
+#include <gtest/gtest.h>
+#include "chainforge/crypto/curve.hpp"
+#include "chainforge/crypto/keypair.hpp"
+#include "chainforge/crypto/random.hpp"
+#include "chainforge/crypto/signature.hpp"
+#include <string>
+#include <vector>
+
+namespace chainforge::crypto::test {
+
+namespace {
+
+// Small scalars are always below the group order r
+BlsPrivateKey secret_key(size_t signer) {
+    BlsPrivateKey key{};
+    key[29] = static_cast<byte_t>(signer >> 16);
+    key[30] = static_cast<byte_t>(signer >> 8);
+    key[31] = static_cast<byte_t>(signer + 1);
+    return key;
+}
+
+BlsPublicKey public_key(size_t signer) {
+    return KeyPair::derive_bls_public_key(secret_key(signer)).value;
+}
+
+Message text(const std::string& value) {
+    return Message(value.begin(), value.end());
+}
+
+struct Committee {
+    std::vector<BlsPublicKey> public_keys;
+    std::vector<BlsSignature> signatures;
+};
+
+Committee sign_attestation(const Message& attestation, size_t size) {
+    Committee committee;
+    for (size_t i = 0; i < size; ++i) {
+        committee.public_keys.push_back(public_key(i));
+        committee.signatures.push_back(Signature::bls_sign(attestation, secret_key(i)).value);
+    }
+    return committee;
+}
+
+bool verified(const CryptoResult<bool>& result) {
+    return result.success() && result.value;
+}
+
+// False when the library was built without blst
+bool bls_available() {
+    return KeyPair::derive_bls_public_key(secret_key(0)).error != CryptoError::UNSUPPORTED_ALGORITHM;
+}
+
+} // namespace
+
+class BlsAggregateTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!bls_available()) {
+            GTEST_SKIP() << "built without blst";
+        }
+    }
+};
+
+TEST(BlsUnsupportedTest, EveryOperationReportsUnsupportedWithoutBlst) {
+    if (bls_available()) {
+        GTEST_SKIP() << "built with blst";
+    }
+
+    const Message message = text("block 42");
+    const std::vector<BlsPublicKey> public_keys(2);
+    const std::vector<BlsSignature> signatures(2);
+    EXPECT_EQ(Random::generate_bls_private_key().error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(KeyPair::generate_bls().error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_FALSE(KeyPair::is_valid_bls_private_key(secret_key(0)));
+    EXPECT_FALSE(KeyPair::is_valid_bls_public_key(BlsPublicKey{}));
+
+    EXPECT_EQ(Signature::bls_sign(message, secret_key(0)).error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Signature::bls_verify(message, BlsSignature{}, BlsPublicKey{}).error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Signature::bls_aggregate_signatures(signatures).error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Signature::bls_aggregate_public_keys(public_keys).error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Signature::bls_verify_aggregate({message, message}, BlsSignature{}, public_keys).error,
+              CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Signature::bls_fast_aggregate_verify(message, BlsSignature{}, public_keys).error,
+              CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Signature::bls_prove_possession(secret_key(0)).error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Signature::bls_verify_possession(BlsPublicKey{}, BlsSignature{}).error,
+              CryptoError::UNSUPPORTED_ALGORITHM);
+
+    EXPECT_EQ(Curve::Bls12_381::g1_multiply_base(secret_key(0)).error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Curve::Bls12_381::g2_add(BlsSignature{}, BlsSignature{}).error, CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_EQ(Curve::Bls12_381::pairing_check(BlsPublicKey{}, BlsSignature{}).error,
+              CryptoError::UNSUPPORTED_ALGORITHM);
+    EXPECT_FALSE(Curve::Bls12_381::is_valid_g1_point(BlsPublicKey{}));
+    EXPECT_FALSE(Curve::Bls12_381::is_valid_g2_point(BlsSignature{}));
+}
+
+TEST_F(BlsAggregateTest, SecretKeyOneGivesTheG1Generator) {
+    BlsPrivateKey one{};
+    one[31] = 1;
+    auto derived = KeyPair::derive_bls_public_key(one);
+    ASSERT_TRUE(derived.success());
+    EXPECT_EQ(derived.value, Curve::Bls12_381::g1_generator());
+    EXPECT_EQ(KeyPair::bls_public_key_to_hex(derived.value),
+              "97f1d3a73197d7942695638c4fa9ac0fc3688c4f9774b905a14e3a3f171bac586c55e83ff97a1aeffb3af00adb22c6bb");
+
+    // Zero and r itself are not secret keys
+    EXPECT_EQ(KeyPair::derive_bls_public_key(BlsPrivateKey{}).error, CryptoError::INVALID_KEY);
+    auto order = KeyPair::bls_private_key_from_hex("73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001");
+    ASSERT_TRUE(order.success());
+    EXPECT_FALSE(KeyPair::is_valid_bls_private_key(order.value));
+
+    auto generated = KeyPair::generate_bls();
+    ASSERT_TRUE(generated.success());
+    EXPECT_TRUE(KeyPair::is_valid_bls_public_key(generated.value.public_key));
+}
+
+TEST_F(BlsAggregateTest, SignAndVerify) {
+    Message block = text("block 42");
+    auto signature = Signature::bls_sign(block, secret_key(0));
+    ASSERT_TRUE(signature.success());
+    EXPECT_TRUE(Curve::Bls12_381::is_valid_g2_point(signature.value));
+
+    EXPECT_TRUE(verified(Signature::bls_verify(block, signature.value, public_key(0))));
+    EXPECT_FALSE(verified(Signature::bls_verify(text("block 43"), signature.value, public_key(0))));
+    EXPECT_FALSE(verified(Signature::bls_verify(block, signature.value, public_key(1))));
+
+    auto tampered = signature.value;
+    tampered[50] ^= 0x01;
+    EXPECT_FALSE(verified(Signature::bls_verify(block, tampered, public_key(0))));
+
+    // The identity is not a valid public key
+    BlsPublicKey identity{};
+    identity[0] = 0xc0;
+    EXPECT_FALSE(KeyPair::is_valid_bls_public_key(identity));
+    EXPECT_EQ(Signature::bls_verify(block, signature.value, identity).error, CryptoError::INVALID_KEY);
+}
+
+TEST_F(BlsAggregateTest, AggregateOverDistinctMessages) {
+    const size_t signers = 8;
+    std::vector<Message> messages;
+    std::vector<BlsPublicKey> public_keys;
+    std::vector<BlsSignature> signatures;
+    for (size_t i = 0; i < signers; ++i) {
+        messages.push_back(text("shard " + std::to_string(i) + " header"));
+        public_keys.push_back(public_key(i));
+        signatures.push_back(Signature::bls_sign(messages[i], secret_key(i)).value);
+    }
+
+    auto aggregate = Signature::bls_aggregate_signatures(signatures);
+    ASSERT_TRUE(aggregate.success());
+    EXPECT_TRUE(verified(Signature::bls_verify_aggregate(messages, aggregate.value, public_keys)));
+
+    // Signers swapped between messages
+    auto swapped = public_keys;
+    std::swap(swapped[2], swapped[5]);
+    EXPECT_FALSE(verified(Signature::bls_verify_aggregate(messages, aggregate.value, swapped)));
+
+    // One signature missing from the aggregate
+    auto partial = Signature::bls_aggregate_signatures({signatures.begin(), signatures.end() - 1});
+    ASSERT_TRUE(partial.success());
+    EXPECT_FALSE(verified(Signature::bls_verify_aggregate(messages, partial.value, public_keys)));
+
+    auto short_keys = public_keys;
+    short_keys.pop_back();
+    EXPECT_EQ(Signature::bls_verify_aggregate(messages, aggregate.value, short_keys).error,
+              CryptoError::INVALID_LENGTH);
+    EXPECT_EQ(Signature::bls_aggregate_signatures({}).error, CryptoError::INVALID_SIGNATURE);
+}
+
+TEST_F(BlsAggregateTest, FastAggregateVerifiesACommittee) {
+    Message attestation = text("slot 1024, head 0xabcd");
+    Committee committee = sign_attestation(attestation, 128);
+
+    auto aggregate = Signature::bls_aggregate_signatures(committee.signatures);
+    ASSERT_TRUE(aggregate.success());
+    EXPECT_TRUE(verified(Signature::bls_fast_aggregate_verify(attestation, aggregate.value, committee.public_keys)));
+
+    // The same check against the pre-summed committee key
+    auto aggregate_key = Signature::bls_aggregate_public_keys(committee.public_keys);
+    ASSERT_TRUE(aggregate_key.success());
+    EXPECT_TRUE(verified(Signature::bls_verify(attestation, aggregate.value, aggregate_key.value)));
+
+    // A key claimed but not signed with, and a signer left out
+    auto extra = committee.public_keys;
+    extra.push_back(public_key(128));
+    EXPECT_FALSE(verified(Signature::bls_fast_aggregate_verify(attestation, aggregate.value, extra)));
+    auto missing = committee.public_keys;
+    missing.pop_back();
+    EXPECT_FALSE(verified(Signature::bls_fast_aggregate_verify(attestation, aggregate.value, missing)));
+    EXPECT_FALSE(verified(Signature::bls_fast_aggregate_verify(text("slot 1025"), aggregate.value,
+                                                               committee.public_keys)));
+
+    EXPECT_EQ(Signature::bls_fast_aggregate_verify(attestation, aggregate.value, {}).error,
+              CryptoError::INVALID_LENGTH);
+    auto invalid = committee.public_keys;
+    invalid[3] = BlsPublicKey{};
+    EXPECT_EQ(Signature::bls_fast_aggregate_verify(attestation, aggregate.value, invalid).error,
+              CryptoError::INVALID_KEY);
+}
+
+TEST_F(BlsAggregateTest, Eth2SignKnownAnswers) {
+    // consensus-spec-tests bls/sign: three keys signing 32 zero bytes under the POP ciphersuite
+    struct Vector {
+        const char* secret_key;
+        const char* public_key;
+        const char* signature;
+    };
+    const Vector vectors[] = {
+        {"263dbd792f5b1be47ed85f8938c0f29586af0d3ac7b977f21c278fe1462040e3",
+         "a491d1b0ecd9bb917989f0e74f0dea0422eac4a873e5e2644f368dffb9a6e20fd6e10c1b77654d067c0618f6e5a7f79a",
+         "b6ed936746e01f8ecf281f020953fbf1f01debd5657c4a383940b020b26507f6076334f91e2366c96e9ab279fb5158090352ea1c5b0c9274504f4f0e7053af24802e51e4568d164fe986834f41e55c8e850ce1f98458c0cfc9ab380b55285a55"},
+        {"47b8192d77bf871b62e87859d653922725724a5c031afeabc60bcef5ff665138",
+         "b301803f8b5ac4a1133581fc676dfedc60d891dd5fa99028805e5ea5b08d3491af75d0707adab3b70c6a6a580217bf81",
+         "b23c46be3a001c63ca711f87a005c200cc550b9429d5f4eb38d74322144f1b63926da3388979e5321012fb1a0526bcd100b5ef5fe72628ce4cd5e904aeaa3279527843fae5ca9ca675f4f51ed8f83bbf7155da9ecc9663100a885d5dc6df96d9"},
+        {"328388aff0d4a5b7dc9205abd374e7e98f3cd9f3418edb4eafda5fb16473d216",
+         "b53d21a4cfd562c469cc81514d4ce5a6b577d8403d32a394dc265dd190b47fa9f829fdd7963afdf972e5e77854051f6f",
+         "948a7cb99f76d616c2c564ce9bf4a519f1bea6b0a624a02276443c245854219fabb8d4ce061d255af5330b078d5380681751aa7053da2c98bae898edc218c75f07e24d8802a17cd1f6833b71e58f5eb5b94208b4d0bb3848cecb075ea21be115"},
+    };
+    const Message message(32, 0x00);
+
+    std::vector<BlsPublicKey> public_keys;
+    std::vector<BlsSignature> signatures;
+    for (const auto& vector : vectors) {
+        auto key = KeyPair::bls_private_key_from_hex(vector.secret_key);
+        ASSERT_TRUE(key.success());
+        auto derived = KeyPair::derive_bls_public_key(key.value);
+        ASSERT_TRUE(derived.success());
+        EXPECT_EQ(KeyPair::bls_public_key_to_hex(derived.value), vector.public_key);
+
+        auto signature = Signature::bls_sign(message, key.value);
+        ASSERT_TRUE(signature.success());
+        EXPECT_EQ(Signature::bls_signature_to_hex(signature.value), vector.signature);
+        EXPECT_TRUE(verified(Signature::bls_verify(message, signature.value, derived.value)));
+
+        public_keys.push_back(derived.value);
+        signatures.push_back(signature.value);
+    }
+
+    // Sums of the points above, worked out independently of blst
+    auto aggregate = Signature::bls_aggregate_signatures(signatures);
+    ASSERT_TRUE(aggregate.success());
+    EXPECT_EQ(Signature::bls_signature_to_hex(aggregate.value),
+              "9683b3e6701f9a4b706709577963110043af78a5b41991b998475a3d3fd62abf35ce03b33908418efc95a058494a8ae5"
+              "04354b9f626231f6b3f3c849dfdeaf5017c4780e2aee1850ceaf4b4d9ce70971a3d2cfcd97b7e5ecf6759f8da5f76d31");
+    auto aggregate_key = Signature::bls_aggregate_public_keys(public_keys);
+    ASSERT_TRUE(aggregate_key.success());
+    EXPECT_EQ(KeyPair::bls_public_key_to_hex(aggregate_key.value),
+              "a095608b35495ca05002b7b5966729dd1ed096568cf2ff24f3318468e0f3495361414a78ebc09574489bc79e48fca969");
+    EXPECT_TRUE(verified(Signature::bls_fast_aggregate_verify(message, aggregate.value, public_keys)));
+}
+
+TEST_F(BlsAggregateTest, ProofOfPossession) {
+    auto proof = Signature::bls_prove_possession(secret_key(7));
+    ASSERT_TRUE(proof.success());
+    EXPECT_TRUE(verified(Signature::bls_verify_possession(public_key(7), proof.value)));
+    EXPECT_FALSE(verified(Signature::bls_verify_possession(public_key(8), proof.value)));
+
+    // A proof is not a signature on the key bytes under the message tag
+    BlsPublicKey key = public_key(7);
+    Message key_bytes(key.begin(), key.end());
+    EXPECT_FALSE(verified(Signature::bls_verify(key_bytes, proof.value, key)));
+}
+
+TEST_F(BlsAggregateTest, MultiPairingCheck) {
+    // e(k * G1, G2) * e(-G1, k * G2) == 1, with -G1 = (r - 1) * G1
+    BlsPrivateKey k = secret_key(1234);
+    auto order_minus_one = KeyPair::bls_private_key_from_hex(
+        "73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000000").value;
+    auto negated_g1 = Curve::Bls12_381::g1_multiply(Curve::Bls12_381::g1_generator(), order_minus_one);
+    ASSERT_TRUE(negated_g1.success());
+
+    std::vector<BlsPublicKey> g1_points = {Curve::Bls12_381::g1_multiply_base(k).value, negated_g1.value};
+    std::vector<BlsSignature> g2_points = {Curve::Bls12_381::g2_generator(), Curve::Bls12_381::g2_multiply_base(k).value};
+    EXPECT_TRUE(verified(Curve::Bls12_381::multi_pairing_check(g1_points, g2_points)));
+
+    g2_points[1] = Curve::Bls12_381::g2_multiply_base(secret_key(1235)).value;
+    EXPECT_FALSE(verified(Curve::Bls12_381::multi_pairing_check(g1_points, g2_points)));
+
+    // G1 + (-G1) is the identity, which pairs to one with anything
+    auto identity = Curve::Bls12_381::g1_add(Curve::Bls12_381::g1_generator(), negated_g1.value);
+    ASSERT_TRUE(identity.success());
+    EXPECT_TRUE(verified(Curve::Bls12_381::pairing_check(identity.value, Curve::Bls12_381::g2_generator())));
+    EXPECT_FALSE(verified(Curve::Bls12_381::pairing_check(Curve::Bls12_381::g1_generator(),
+                                                          Curve::Bls12_381::g2_generator())));
+
+    EXPECT_EQ(Curve::Bls12_381::multi_pairing_check(g1_points, std::span(g2_points).first(1)).error,
+              CryptoError::INVALID_LENGTH);
+}
+
+} // namespace chainforge::crypto::test
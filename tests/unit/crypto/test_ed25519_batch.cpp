@@ -0,0 +1,327 @@
+#include <gtest/gtest.h>
+#include "chainforge/crypto/signature.hpp"
+#include "chainforge/crypto/keypair.hpp"
+#include <sodium.h>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <vector>
+
+namespace chainforge::crypto::test {
+
+namespace {
+
+Ed25519PrivateKey seed_from(size_t signer) {
+    Ed25519PrivateKey seed{};
+    for (size_t i = 0; i < seed.size(); ++i) {
+        seed[i] = static_cast<byte_t>(signer * 17 + i);
+    }
+    return seed;
+}
+
+Message vote(size_t index) {
+    std::string text = "vote #" + std::to_string(index);
+    return Message(text.begin(), text.end());
+}
+
+template <size_t N>
+std::array<byte_t, N> from_hex(const std::string& hex) {
+    std::array<byte_t, N> bytes{};
+    for (size_t i = 0; i < N; ++i) {
+        bytes[i] = static_cast<byte_t>(std::stoi(hex.substr(2 * i, 2), nullptr, 16));
+    }
+    return bytes;
+}
+
+// s + L encodes the same scalar, but only s < L is accepted
+void add_group_order_to_s(Ed25519Signature& signature) {
+    const auto order = from_hex<32>("edd3f55c1a631258d69cf7a2def9de1400000000000000000000000000000010");
+    unsigned carry = 0;
+    for (size_t i = 0; i < 32; ++i) {
+        unsigned sum = signature[32 + i] + order[i] + carry;
+        signature[32 + i] = static_cast<byte_t>(sum);
+        carry = sum >> 8;
+    }
+}
+
+using Scalar = std::array<byte_t, 32>;
+using Point = std::array<byte_t, 32>;
+
+// A point of order 8
+const Point TORSION = from_hex<32>("c7176a703d4dd84fba3c0b760d10670f2a2053fa2c39ccc64ec7fd7792ac037a");
+
+Scalar reduce(const byte_t* digest) {
+    Scalar scalar;
+    crypto_core_ed25519_scalar_reduce(scalar.data(), digest);
+    return scalar;
+}
+
+Point add(const Point& p, const Point& q) {
+    Point sum;
+    EXPECT_EQ(crypto_core_ed25519_add(sum.data(), p.data(), q.data()), 0);
+    return sum;
+}
+
+/**
+ * Signs with nonce point R and key encoding A chosen by the caller, so either
+ * can carry a small-order component: s = r + H(R || A || M) a with R = [r]B
+ * plus whatever torsion the caller added
+ */
+Ed25519Signature sign_with(const Scalar& r, const Point& nonce_point, const Ed25519PrivateKey& seed,
+                           const Point& key_encoding, const Message& message) {
+    byte_t expanded[crypto_hash_sha512_BYTES];
+    crypto_hash_sha512(expanded, seed.data(), seed.size());
+    expanded[0] &= 248;
+    expanded[31] &= 127;
+    expanded[31] |= 64;
+    byte_t wide[64] = {};
+    std::copy_n(expanded, 32, wide);
+    Scalar a = reduce(wide);
+
+    std::vector<byte_t> transcript(nonce_point.begin(), nonce_point.end());
+    transcript.insert(transcript.end(), key_encoding.begin(), key_encoding.end());
+    transcript.insert(transcript.end(), message.begin(), message.end());
+    byte_t digest[crypto_hash_sha512_BYTES];
+    crypto_hash_sha512(digest, transcript.data(), transcript.size());
+    Scalar h = reduce(digest);
+
+    Scalar s;
+    crypto_core_ed25519_scalar_mul(s.data(), h.data(), a.data());
+    crypto_core_ed25519_scalar_add(s.data(), s.data(), r.data());
+
+    Ed25519Signature signature;
+    std::copy(nonce_point.begin(), nonce_point.end(), signature.begin());
+    std::copy(s.begin(), s.end(), signature.begin() + 32);
+    return signature;
+}
+
+} // namespace
+
+TEST(Ed25519BatchTest, PrivateKeyIsTheRfc8032Seed) {
+    // RFC 8032, section 7.1, test 1
+    auto seed = from_hex<32>("9d61b19deffd5a60ba844af492ec2cc44449c5697b326919703bac031cae7f60");
+    auto public_key = KeyPair::derive_ed25519_public_key(seed);
+    ASSERT_TRUE(public_key.success());
+    EXPECT_EQ(KeyPair::ed25519_public_key_to_hex(public_key.value),
+              "d75a980182b10ab7d54bfed3c964073a0ee172f3daa62325af021a68f707511a");
+
+    Message empty;
+    auto signature = Signature::ed25519_sign(empty, seed);
+    ASSERT_TRUE(signature.success());
+    EXPECT_EQ(Signature::ed25519_signature_to_hex(signature.value),
+              "e5564300c360ac729086e2cc806e828a84877f1eb8e5d974d873e065224901555fb8821590a33bacc61e39701cf9b46bd25bf5f0595bbe24655141438e7a100b");
+    EXPECT_TRUE(Signature::ed25519_verify(empty, signature.value, public_key.value).value);
+}
+
+TEST(Ed25519BatchTest, BatchMatchesSingleVerification) {
+    // Ten validators voting sixteen times each; enough for two workers' slices
+    const size_t signers = 10;
+    const size_t count = 160;
+    std::vector<Ed25519PublicKey> public_keys;
+    for (size_t i = 0; i < signers; ++i) {
+        public_keys.push_back(KeyPair::derive_ed25519_public_key(seed_from(i)).value);
+    }
+    std::vector<Message> messages;
+    std::vector<Signature::Ed25519VerifyItem> items(count);
+    for (size_t i = 0; i < count; ++i) {
+        messages.push_back(vote(i));
+    }
+    for (size_t i = 0; i < count; ++i) {
+        items[i].message = messages[i];
+        items[i].signature = Signature::ed25519_sign(messages[i], seed_from(i % signers)).value;
+        items[i].public_key = public_keys[i % signers];
+    }
+
+    // Wrong signer, corrupted R, corrupted s, non-canonical s, small-order key, wrong message
+    items[7].public_key = public_keys[(7 + 1) % signers];
+    items[20].signature[5] ^= 0x01;
+    items[33].signature[40] ^= 0x01;
+    add_group_order_to_s(items[50].signature);
+    items[61].public_key = from_hex<32>("0100000000000000000000000000000000000000000000000000000000000000");
+    items[80].message = messages[81];
+    const std::vector<size_t> broken = {7, 20, 33, 50, 61, 80};
+
+    for (size_t workers : {size_t{1}, size_t{2}}) {
+        auto batch = items;
+        auto result = Signature::ed25519_verify_batch(batch, workers);
+        ASSERT_TRUE(result.success());
+        EXPECT_FALSE(result.value);
+
+        for (size_t i = 0; i < count; ++i) {
+            Message message(batch[i].message.begin(), batch[i].message.end());
+            auto single = Signature::ed25519_verify(message, batch[i].signature, batch[i].public_key);
+            EXPECT_EQ(batch[i].result.error, single.error) << i;
+            EXPECT_EQ(batch[i].result.value, single.value) << i;
+            bool is_broken = std::find(broken.begin(), broken.end(), i) != broken.end();
+            EXPECT_EQ(batch[i].result.value, !is_broken) << i;
+        }
+    }
+
+    // With the bad votes dropped the whole batch verifies
+    std::vector<Signature::Ed25519VerifyItem> valid;
+    for (size_t i = 0; i < count; ++i) {
+        if (std::find(broken.begin(), broken.end(), i) == broken.end()) {
+            valid.push_back(items[i]);
+        }
+    }
+    auto result = Signature::ed25519_verify_batch(valid);
+    ASSERT_TRUE(result.success());
+    EXPECT_TRUE(result.value);
+    for (const auto& item : valid) {
+        EXPECT_TRUE(item.result.success() && item.result.value);
+    }
+}
+
+TEST(Ed25519BatchTest, MixedOrderSignaturesGetTheSameAnswer) {
+    ASSERT_GE(sodium_init(), 0);
+    const Ed25519PrivateKey seed = seed_from(3);
+    const Point key = KeyPair::derive_ed25519_public_key(seed).value;
+    const Point mixed_key = add(key, TORSION);
+
+    std::vector<Message> messages;
+    for (size_t i = 0; i < 12; ++i) {
+        messages.push_back(vote(i));
+    }
+    auto nonce = [](Scalar& r) {
+        crypto_core_ed25519_scalar_random(r.data());
+        Point nonce_point;
+        EXPECT_EQ(crypto_scalarmult_ed25519_base_noclamp(nonce_point.data(), r.data()), 0);
+        return nonce_point;
+    };
+
+    // Honest votes around three crafted ones and a forgery
+    std::vector<Signature::Ed25519VerifyItem> items(messages.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+        items[i].message = messages[i];
+        items[i].signature = Signature::ed25519_sign(messages[i], seed).value;
+        items[i].public_key = key;
+    }
+    Scalar r;
+    Point nonce_point = nonce(r);
+
+    // R carries an order-8 component: the cofactorless check always rejects this
+    items[2].signature = sign_with(r, add(nonce_point, TORSION), seed, key, messages[2]);
+    EXPECT_NE(crypto_sign_ed25519_verify_detached(items[2].signature.data(), messages[2].data(), messages[2].size(),
+                                                  key.data()), 0);
+
+    // A carries one: [s]B - R - [h]A is -[h]T, zero only after clearing the cofactor
+    nonce_point = nonce(r);
+    items[5].signature = sign_with(r, nonce_point, seed, mixed_key, messages[5]);
+    items[5].public_key = mixed_key;
+
+    // A small-order key with s = r
+    nonce_point = nonce(r);
+    items[8].signature = Ed25519Signature{};
+    std::copy(nonce_point.begin(), nonce_point.end(), items[8].signature.begin());
+    std::copy(r.begin(), r.end(), items[8].signature.begin() + 32);
+    items[8].public_key = TORSION;
+
+    // Torsion added to R after signing changes h, so the equation fails
+    nonce_point = nonce(r);
+    items[10].signature = sign_with(r, nonce_point, seed, key, messages[10]);
+    auto shifted = add(nonce_point, TORSION);
+    std::copy(shifted.begin(), shifted.end(), items[10].signature.begin());
+
+    for (size_t workers : {size_t{1}, size_t{2}}) {
+        auto batch = items;
+        auto result = Signature::ed25519_verify_batch(batch, workers);
+        ASSERT_TRUE(result.success());
+        EXPECT_FALSE(result.value);
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            Message message(batch[i].message.begin(), batch[i].message.end());
+            auto single = Signature::ed25519_verify(message, batch[i].signature, batch[i].public_key);
+            EXPECT_EQ(batch[i].result.error, single.error) << i;
+            EXPECT_EQ(batch[i].result.value, single.value) << i;
+            EXPECT_EQ(single.value, i != 10) << i;
+        }
+    }
+
+    // Without the forgery the batch equation holds, and agrees item by item
+    items.erase(items.begin() + 10);
+    auto result = Signature::ed25519_verify_batch(items);
+    ASSERT_TRUE(result.success());
+    EXPECT_TRUE(result.value);
+    for (size_t i = 0; i < items.size(); ++i) {
+        Message message(items[i].message.begin(), items[i].message.end());
+        auto single = Signature::ed25519_verify(message, items[i].signature, items[i].public_key);
+        EXPECT_EQ(items[i].result.value, single.value) << i;
+    }
+}
+
+TEST(Ed25519BatchTest, Zip215SmallOrderVectors) {
+    // ZIP-215's small-order test set: the eight torsion points, then the
+    // non-canonical encodings that still decode to them under ZIP-215 rules,
+    // i.e. a set sign bit with x = 0, and y = p or y = p + 1
+    const char* const encodings[] = {
+        "0100000000000000000000000000000000000000000000000000000000000000",
+        "c7176a703d4dd84fba3c0b760d10670f2a2053fa2c39ccc64ec7fd7792ac037a",
+        "0000000000000000000000000000000000000000000000000000000000000080",
+        "26e8958fc2b227b045c3f489f2ef98f0d5dfac05d3c63339b13802886d53fc05",
+        "ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+        "26e8958fc2b227b045c3f489f2ef98f0d5dfac05d3c63339b13802886d53fc85",
+        "0000000000000000000000000000000000000000000000000000000000000000",
+        "c7176a703d4dd84fba3c0b760d10670f2a2053fa2c39ccc64ec7fd7792ac03fa",
+        "0100000000000000000000000000000000000000000000000000000000000080",
+        "ecffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+        "eeffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+        "eeffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+        "edffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f",
+        "edffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff",
+    };
+    const std::string text = "Zcash";
+    const Message message(text.begin(), text.end());
+
+    // Every (A, R) pair with s = 0 is valid: [8]([0]B - R - [h]A) vanishes whatever h is
+    std::vector<Signature::Ed25519VerifyItem> items;
+    for (const char* key : encodings) {
+        for (const char* nonce_point : encodings) {
+            Signature::Ed25519VerifyItem item;
+            item.message = message;
+            item.signature = Ed25519Signature{};
+            auto point = from_hex<32>(nonce_point);
+            std::copy(point.begin(), point.end(), item.signature.begin());
+            item.public_key = from_hex<32>(key);
+            EXPECT_TRUE(Signature::ed25519_verify(message, item.signature, item.public_key).value)
+                << key << " " << nonce_point;
+            items.push_back(item);
+        }
+    }
+
+    for (size_t workers : {size_t{1}, size_t{2}}) {
+        auto batch = items;
+        auto result = Signature::ed25519_verify_batch(batch, workers);
+        ASSERT_TRUE(result.success());
+        EXPECT_TRUE(result.value);
+        for (const auto& item : batch) {
+            EXPECT_TRUE(item.result.success() && item.result.value);
+        }
+    }
+
+    // y = p + 2 reduces to 2, which is not the y of any curve point
+    const auto off_curve = from_hex<32>("efffffffffffffffffffffffffffffffffffffffffffffffffffffffffffff7f");
+    EXPECT_FALSE(Signature::ed25519_verify(message, items[0].signature, off_curve).value);
+    auto bad_nonce = items[0].signature;
+    std::copy(off_curve.begin(), off_curve.end(), bad_nonce.begin());
+    EXPECT_FALSE(Signature::ed25519_verify(message, bad_nonce, items[0].public_key).value);
+}
+
+TEST(Ed25519BatchTest, SmallAndEmptyBatches) {
+    for (size_t count : {size_t{0}, size_t{1}, size_t{3}, size_t{4}}) {
+        std::vector<Message> messages;
+        std::vector<Signature::Ed25519VerifyItem> items(count);
+        for (size_t i = 0; i < count; ++i) {
+            messages.push_back(vote(i));
+        }
+        for (size_t i = 0; i < count; ++i) {
+            items[i].message = messages[i];
+            items[i].signature = Signature::ed25519_sign(messages[i], seed_from(i)).value;
+            items[i].public_key = KeyPair::derive_ed25519_public_key(seed_from(i)).value;
+        }
+        auto result = Signature::ed25519_verify_batch(items);
+        ASSERT_TRUE(result.success()) << count;
+        EXPECT_TRUE(result.value) << count;
+    }
+}
+
+} // namespace chainforge::crypto::test
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+#include "chainforge/crypto/keccak.hpp"
+#include "chainforge/crypto/hash.hpp"
+#include <algorithm>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace chainforge::crypto::test {
+
+namespace {
+
+ByteVector pattern(size_t size) {
+    ByteVector bytes(size);
+    for (size_t i = 0; i < size; ++i) {
+        bytes[i] = static_cast<byte_t>(i % 251);
+    }
+    return bytes;
+}
+
+template <size_t N>
+std::string hex(const std::array<byte_t, N>& bytes) {
+    return Keccak::to_hex(bytes);
+}
+
+// Restores the detected backend when a test switches it
+class BatchBackendGuard {
+public:
+    BatchBackendGuard() : saved_(Keccak::batch_backend()) {}
+    ~BatchBackendGuard() { Keccak::set_batch_backend(saved_); }
+
+private:
+    Keccak::BatchBackend saved_;
+};
+
+} // namespace
+
+TEST(KeccakTest, KnownVectors) {
+    EXPECT_EQ(hex(Keccak::keccak256(std::string()).value),
+              "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+    EXPECT_EQ(hex(Keccak::keccak256(std::string("abc")).value),
+              "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45");
+    EXPECT_EQ(hex(Hash::keccak256(std::string("abc")).value),
+              "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45");
+
+    ByteVector abc = {'a', 'b', 'c'};
+    EXPECT_EQ(hex(Keccak::keccak160(abc).value), "1034dfc4296127e3fd6fbe87c2201ea60dc62e79");
+    EXPECT_EQ(hex(Keccak::keccak384(abc).value),
+              "f7df1165f033337be098e7d288ad6a2f74409d7a60b49c36642218de161b1f99"
+              "f8c681e4afaf31a34db29fb763e3c28e");
+    EXPECT_EQ(hex(Keccak::keccak512(abc).value),
+              "18587dc2ea106b9a1563e32b3312421ca164c7f1f07bc922a9c83d77cea3a1e5"
+              "d0c69910739025372dc14ac9642629379540c17e2a65b19d77aa511a9d00bb96");
+}
+
+TEST(KeccakTest, BlockBoundaries) {
+    // Keccak-256 absorbs 136 bytes per permutation
+    EXPECT_EQ(hex(Keccak::keccak256(pattern(135)).value),
+              "cbdfd9dee5faad3818d6b06f95a219fd290b0e1706f6a82e5a595b9ce9faca62");
+    EXPECT_EQ(hex(Keccak::keccak256(pattern(136)).value),
+              "7ce759f1ab7f9ce437719970c26b0a66ff11fe3e38e17df89cf5d29c7d7f807e");
+    EXPECT_EQ(hex(Keccak::keccak256(pattern(137)).value),
+              "ac73d4fae68b8453f764007c1a20ce95994187861f0c3227a3a8e99a73a3b1db");
+    EXPECT_EQ(hex(Keccak::keccak256(pattern(300)).value),
+              "4699841dafd5e26cca72b05a41d38c96b4b468e5a6cbf694cbebe77dacdf6528");
+}
+
+TEST(KeccakTest, StreamingMatchesOneShot) {
+    ByteVector data = pattern(1000);
+    Hash256 expected = Keccak::keccak256(data).value;
+
+    for (size_t chunk : {1u, 7u, 8u, 135u, 136u, 137u, 500u}) {
+        Keccak::StreamHasher hasher;
+        for (size_t offset = 0; offset < data.size(); offset += chunk) {
+            hasher.update(data.data() + offset, std::min(chunk, data.size() - offset));
+        }
+        auto result = hasher.finalize_256();
+        ASSERT_TRUE(result.success());
+        EXPECT_EQ(result.value, expected) << chunk;
+    }
+
+    // finalize resets, so the hasher can be reused
+    Keccak::StreamHasher hasher(512);
+    hasher.update(std::string("discarded"));
+    hasher.finalize_512();
+    hasher.update(data);
+    EXPECT_EQ(hasher.finalize_512().value, Keccak::keccak512(data).value);
+}
+
+TEST(KeccakTest, StreamOutputSizeIsFixedUpFront) {
+    Keccak::StreamHasher hasher(256);
+    hasher.update(std::string("abc"));
+    EXPECT_EQ(hasher.finalize_512().error, CryptoError::INVALID_LENGTH);
+    EXPECT_EQ(hasher.finalize_256().value, Keccak::keccak256(std::string("abc")).value);
+}
+
+TEST(KeccakTest, PermutationOfZeroState) {
+    // First lane of Keccak-f[1600] applied to the all-zero state
+    byte_t state[200] = {};
+    Keccak::keccak_f1600_round(state);
+    uint64_t lane = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        lane |= uint64_t{state[i]} << (8 * i);
+    }
+    EXPECT_EQ(lane, 0xF1258F7940E1DDE7ULL);
+}
+
+TEST(KeccakTest, BatchMatchesScalarOnEveryBackend) {
+    // Mixed lengths, including empty and multi-block, and a count that leaves a partial group
+    std::vector<ByteVector> messages;
+    for (size_t i = 0; i < 29; ++i) {
+        messages.push_back(pattern((i * 37) % 400));
+    }
+    messages[3].clear();
+    std::vector<Hash256> expected;
+    for (const auto& message : messages) {
+        expected.push_back(Keccak::keccak256(message).value);
+    }
+
+    BatchBackendGuard guard;
+    for (auto backend : {Keccak::BatchBackend::Scalar, Keccak::BatchBackend::Avx2, Keccak::BatchBackend::Avx512}) {
+        if (!Keccak::set_batch_backend(backend)) {
+            continue;
+        }
+        for (size_t count : {size_t{0}, size_t{1}, size_t{5}, size_t{8}, messages.size()}) {
+            std::vector<Hash256> out(count);
+            auto result = Keccak::keccak256_many(std::span(messages).first(count), out);
+            ASSERT_TRUE(result.success());
+            for (size_t i = 0; i < count; ++i) {
+                EXPECT_EQ(out[i], expected[i]) << static_cast<int>(backend) << " " << count << " " << i;
+            }
+        }
+    }
+
+    std::vector<Hash256> too_small(1);
+    EXPECT_EQ(Keccak::keccak256_many(messages, too_small).error, CryptoError::INVALID_LENGTH);
+}
+
+TEST(KeccakTest, ScalarBackendIsAlwaysAvailable) {
+    BatchBackendGuard guard;
+    EXPECT_TRUE(Keccak::is_batch_backend_supported(Keccak::BatchBackend::Scalar));
+    EXPECT_TRUE(Keccak::set_batch_backend(Keccak::BatchBackend::Scalar));
+    EXPECT_EQ(Keccak::batch_backend(), Keccak::BatchBackend::Scalar);
+}
+
+} // namespace chainforge::crypto::test
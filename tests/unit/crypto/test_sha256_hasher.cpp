@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "chainforge/crypto/hash.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+namespace chainforge::crypto::test {
+
+namespace {
+
+// Restores the detected backend when a test switches it
+class PairBackendGuard {
+public:
+    PairBackendGuard() : saved_(Hash::pair_backend()) {}
+    ~PairBackendGuard() { Hash::set_pair_backend(saved_); }
+
+private:
+    Hash::PairBackend saved_;
+};
+
+} // namespace
+
+TEST(Sha256HasherTest, KnownValues) {
+    Sha256Hasher hasher;
+    EXPECT_EQ(Hash::to_hex(hasher.finalize()),
+              "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+
+    const std::string abc = "abc";
+    hasher.update(reinterpret_cast<const byte_t*>(abc.data()), abc.size());
+    EXPECT_EQ(Hash::to_hex(hasher.finalize()),
+              "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+}
+
+TEST(Sha256HasherTest, MatchesOneShot) {
+    std::mt19937 rng(2459);
+
+    // Cover every padding boundary and split each message at several points
+    for (size_t length = 0; length <= 200; ++length) {
+        std::vector<uint8_t> data(length);
+        for (auto& byte : data) {
+            byte = static_cast<uint8_t>(rng());
+        }
+        auto expected = Hash::sha256(data);
+        ASSERT_TRUE(expected.success());
+
+        for (size_t split : {size_t{0}, length / 3, length / 2, length}) {
+            Sha256Hasher hasher;
+            hasher.update(data.data(), split);
+            hasher.update(data.data() + split, length - split);
+            EXPECT_EQ(hasher.finalize(), expected.value) << "length " << length << ", split " << split;
+        }
+    }
+}
+
+TEST(Sha256HasherTest, HashPairsMatchesEveryBackend) {
+    std::mt19937 rng(2012);
+    std::vector<Hash256> nodes(64);
+    for (auto& node : nodes) {
+        for (auto& byte : node) {
+            byte = static_cast<byte_t>(rng());
+        }
+    }
+
+    // Pairs drawn from anywhere in the list, including a node paired with itself
+    std::vector<const Hash256*> left;
+    std::vector<const Hash256*> right;
+    std::vector<Hash256> expected;
+    for (size_t i = 0; i < 29; ++i) {
+        left.push_back(&nodes[(i * 7) % nodes.size()]);
+        right.push_back(&nodes[i % 5 == 0 ? (i * 7) % nodes.size() : (i * 13 + 1) % nodes.size()]);
+        Sha256Hasher hasher;
+        hasher.update(left.back()->data(), left.back()->size());
+        hasher.update(right.back()->data(), right.back()->size());
+        expected.push_back(hasher.finalize());
+    }
+
+    PairBackendGuard guard;
+    for (auto backend : {Hash::PairBackend::Scalar, Hash::PairBackend::Avx2, Hash::PairBackend::ShaNi}) {
+        if (!Hash::set_pair_backend(backend)) {
+            continue;
+        }
+        for (size_t count : {size_t{0}, size_t{1}, size_t{2}, size_t{8}, size_t{13}, left.size()}) {
+            std::vector<Hash256> out(count);
+            Hash::hash_pairs(left.data(), right.data(), count, out.data());
+            for (size_t i = 0; i < count; ++i) {
+                EXPECT_EQ(out[i], expected[i]) << static_cast<int>(backend) << " " << count << " " << i;
+            }
+        }
+    }
+
+    EXPECT_TRUE(Hash::set_pair_backend(Hash::PairBackend::Scalar));
+    EXPECT_EQ(Hash::pair_backend(), Hash::PairBackend::Scalar);
+}
+
+} // namespace chainforge::crypto::test
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+#include "chainforge/crypto/signature.hpp"
+#include "chainforge/crypto/keypair.hpp"
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace chainforge::crypto::test {
+
+namespace {
+
+Secp256k1PrivateKey private_key_from(byte_t seed) {
+    Secp256k1PrivateKey key{};
+    for (size_t i = 0; i < key.size(); ++i) {
+        key[i] = static_cast<byte_t>(seed * 31 + i);
+    }
+    return key;
+}
+
+Message message_from(size_t index) {
+    std::string text = "transfer #" + std::to_string(index);
+    return Message(text.begin(), text.end());
+}
+
+// Starts each test with an empty key cache and puts the default size back
+class KeyCacheGuard {
+public:
+    KeyCacheGuard() { Signature::clear_secp256k1_key_cache(); }
+    ~KeyCacheGuard() {
+        Signature::set_secp256k1_key_cache_capacity(Signature::DEFAULT_KEY_CACHE_CAPACITY);
+        Signature::clear_secp256k1_key_cache();
+    }
+};
+
+} // namespace
+
+TEST(SignatureBatchTest, DerivedKeyOfOneIsTheGenerator) {
+    Secp256k1PrivateKey one{};
+    one.back() = 1;
+    auto public_key = KeyPair::derive_secp256k1_public_key(one);
+    ASSERT_TRUE(public_key.success());
+    EXPECT_EQ(KeyPair::secp256k1_public_key_to_hex(public_key.value),
+              "79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798"
+              "483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8");
+
+    // y is even, so the compressed form starts with 0x02
+    auto compressed = KeyPair::compress_secp256k1_public_key(public_key.value);
+    ASSERT_TRUE(compressed.success());
+    EXPECT_EQ(compressed.value[0], 0x02);
+    EXPECT_TRUE(std::equal(compressed.value.begin() + 1, compressed.value.end(), public_key.value.begin()));
+}
+
+TEST(SignatureBatchTest, GeneratedKeyPairRoundTripsThroughCompression) {
+    for (int round = 0; round < 8; ++round) {
+        auto keypair = KeyPair::generate_secp256k1();
+        ASSERT_TRUE(keypair.success());
+        EXPECT_EQ(keypair.value.public_key, KeyPair::derive_secp256k1_public_key(keypair.value.private_key).value);
+        EXPECT_TRUE(KeyPair::is_valid_secp256k1_public_key(keypair.value.public_key));
+        EXPECT_TRUE(KeyPair::is_valid_secp256k1_compressed_public_key(keypair.value.compressed_public_key));
+
+        auto decompressed = KeyPair::decompress_secp256k1_public_key(keypair.value.compressed_public_key);
+        ASSERT_TRUE(decompressed.success());
+        EXPECT_EQ(decompressed.value, keypair.value.public_key);
+
+        Message message = message_from(static_cast<size_t>(round));
+        auto signature = Signature::ecdsa_secp256k1_sign(message, keypair.value.private_key);
+        ASSERT_TRUE(signature.success());
+        EXPECT_TRUE(Signature::ecdsa_secp256k1_verify(message, signature.value, decompressed.value).value);
+    }
+
+    Secp256k1PublicKey off_curve = KeyPair::derive_secp256k1_public_key(private_key_from(2)).value;
+    off_curve[63] ^= 0x01;
+    EXPECT_FALSE(KeyPair::is_valid_secp256k1_public_key(off_curve));
+    EXPECT_EQ(KeyPair::compress_secp256k1_public_key(off_curve).error, CryptoError::INVALID_KEY);
+}
+
+TEST(SignatureBatchTest, SignThenVerify) {
+    auto private_key = private_key_from(1);
+    auto public_key = KeyPair::derive_secp256k1_public_key(private_key).value;
+    Message message = message_from(0);
+
+    auto signature = Signature::ecdsa_secp256k1_sign(message, private_key);
+    ASSERT_TRUE(signature.success());
+
+    auto valid = Signature::ecdsa_secp256k1_verify(message, signature.value, public_key);
+    ASSERT_TRUE(valid.success());
+    EXPECT_TRUE(valid.value);
+
+    Message other = message_from(1);
+    EXPECT_FALSE(Signature::ecdsa_secp256k1_verify(other, signature.value, public_key).value);
+
+    Secp256k1PublicKey off_curve = public_key;
+    off_curve[63] ^= 0x01;
+    EXPECT_EQ(Signature::ecdsa_secp256k1_verify(message, signature.value, off_curve).error, CryptoError::INVALID_KEY);
+}
+
+TEST(SignatureBatchTest, BatchMatchesSingleVerification) {
+    // A few senders with several transactions each, as in a block
+    std::vector<Secp256k1PrivateKey> senders;
+    std::vector<Secp256k1PublicKey> public_keys;
+    for (byte_t seed = 1; seed <= 5; ++seed) {
+        senders.push_back(private_key_from(seed));
+        public_keys.push_back(KeyPair::derive_secp256k1_public_key(senders.back()).value);
+    }
+
+    const size_t count = 60;
+    std::vector<Message> messages;
+    std::vector<Signature::VerifyItem> items;
+    for (size_t i = 0; i < count; ++i) {
+        messages.push_back(message_from(i));
+    }
+    for (size_t i = 0; i < count; ++i) {
+        size_t sender = i % senders.size();
+        Signature::VerifyItem item;
+        item.message = messages[i];
+        item.signature = Signature::ecdsa_secp256k1_sign(messages[i], senders[sender]).value;
+        item.public_key = public_keys[sender];
+        items.push_back(item);
+    }
+
+    // Break a few: wrong signer, corrupted signature, key not on the curve
+    items[7].public_key = public_keys[(7 + 1) % senders.size()];
+    items[20].signature[40] ^= 0xFF;
+    items[33].public_key[0] ^= 0x01;
+
+    for (size_t workers : {size_t{1}, size_t{4}}) {
+        auto batch = items;
+        auto result = Signature::ecdsa_secp256k1_verify_batch(batch, workers);
+        ASSERT_TRUE(result.success());
+        EXPECT_FALSE(result.value);
+
+        for (size_t i = 0; i < count; ++i) {
+            auto single = Signature::ecdsa_secp256k1_verify(messages[i], batch[i].signature, batch[i].public_key);
+            EXPECT_EQ(batch[i].result.error, single.error) << i;
+            EXPECT_EQ(batch[i].result.value, single.value) << i;
+            bool broken = i == 7 || i == 20 || i == 33;
+            EXPECT_EQ(batch[i].result.value, !broken) << i;
+        }
+        EXPECT_EQ(batch[33].result.error, CryptoError::INVALID_KEY);
+    }
+}
+
+TEST(SignatureBatchTest, AllValidAndEmptyBatches) {
+    auto private_key = private_key_from(9);
+    auto public_key = KeyPair::derive_secp256k1_public_key(private_key).value;
+    Message message = message_from(3);
+
+    std::vector<Signature::VerifyItem> items(3);
+    for (auto& item : items) {
+        item.message = message;
+        item.signature = Signature::ecdsa_secp256k1_sign(message, private_key).value;
+        item.public_key = public_key;
+    }
+    auto result = Signature::ecdsa_secp256k1_verify_batch(items);
+    ASSERT_TRUE(result.success());
+    EXPECT_TRUE(result.value);
+
+    auto empty = Signature::ecdsa_secp256k1_verify_batch({});
+    ASSERT_TRUE(empty.success());
+    EXPECT_TRUE(empty.value);
+}
+
+TEST(SignatureBatchTest, RepeatSendersHitTheKeyCache) {
+    KeyCacheGuard guard;
+    auto private_key = private_key_from(4);
+    auto public_key = KeyPair::derive_secp256k1_public_key(private_key).value;
+
+    for (size_t i = 0; i < 5; ++i) {
+        Message message = message_from(i);
+        auto signature = Signature::ecdsa_secp256k1_sign(message, private_key).value;
+        EXPECT_TRUE(Signature::ecdsa_secp256k1_verify(message, signature, public_key).value);
+    }
+    auto stats = Signature::secp256k1_key_cache_stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, 4u);
+    EXPECT_EQ(stats.size, 1u);
+    EXPECT_EQ(stats.capacity, Signature::DEFAULT_KEY_CACHE_CAPACITY);
+
+    // A key that does not decode is rejected every time and never stored
+    Secp256k1PublicKey off_curve = public_key;
+    off_curve[63] ^= 0x01;
+    Message message = message_from(0);
+    auto signature = Signature::ecdsa_secp256k1_sign(message, private_key).value;
+    for (size_t i = 0; i < 2; ++i) {
+        EXPECT_EQ(Signature::ecdsa_secp256k1_verify(message, signature, off_curve).error, CryptoError::INVALID_KEY);
+    }
+    stats = Signature::secp256k1_key_cache_stats();
+    EXPECT_EQ(stats.misses, 3u);
+    EXPECT_EQ(stats.size, 1u);
+
+    // Batches look each distinct sender up once
+    std::vector<Signature::VerifyItem> items(6);
+    for (auto& item : items) {
+        item.message = message;
+        item.signature = signature;
+        item.public_key = public_key;
+    }
+    EXPECT_TRUE(Signature::ecdsa_secp256k1_verify_batch(items, 1).value);
+    EXPECT_EQ(Signature::secp256k1_key_cache_stats().hits, 5u);
+}
+
+TEST(SignatureBatchTest, KeyCacheIsBoundedAndCanBeDisabled) {
+    KeyCacheGuard guard;
+    Signature::set_secp256k1_key_cache_capacity(16);
+
+    const size_t senders = 40;
+    Message message = message_from(0);
+    for (size_t i = 0; i < senders; ++i) {
+        auto private_key = private_key_from(static_cast<byte_t>(i + 1));
+        auto public_key = KeyPair::derive_secp256k1_public_key(private_key).value;
+        auto signature = Signature::ecdsa_secp256k1_sign(message, private_key).value;
+        EXPECT_TRUE(Signature::ecdsa_secp256k1_verify(message, signature, public_key).value) << i;
+    }
+    auto stats = Signature::secp256k1_key_cache_stats();
+    EXPECT_EQ(stats.capacity, 16u);
+    EXPECT_LE(stats.size, 16u);
+    EXPECT_EQ(stats.misses, senders);
+    EXPECT_EQ(stats.size + stats.evictions, senders);
+
+    Signature::set_secp256k1_key_cache_capacity(0);
+    EXPECT_EQ(Signature::secp256k1_key_cache_stats().size, 0u);
+    auto private_key = private_key_from(1);
+    auto public_key = KeyPair::derive_secp256k1_public_key(private_key).value;
+    auto signature = Signature::ecdsa_secp256k1_sign(message, private_key).value;
+    EXPECT_TRUE(Signature::ecdsa_secp256k1_verify(message, signature, public_key).value);
+    EXPECT_EQ(Signature::secp256k1_key_cache_stats().size, 0u);
+}
+
+} // namespace chainforge::crypto::test
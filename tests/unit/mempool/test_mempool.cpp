@@ -0,0 +1,721 @@
+#include <gtest/gtest.h>
+#include "chainforge/mempool/mempool.hpp"
+#include "chainforge/core/address.hpp"
+#include "chainforge/core/amount.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <thread>
+#include <unordered_map>
+
+namespace chainforge::mempool::test {
+
+using chainforge::core::Address;
+using chainforge::core::Address160;
+using chainforge::core::Amount;
+using chainforge::core::Transaction;
+
+class MempoolTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        pool_ = create_mempool(config_);
+    }
+
+    static Address sender(uint8_t id) {
+        Address160 data{};
+        data[0] = id;
+        data[1] = 0x01;
+        return Address(data);
+    }
+
+    // Every sender's nonces 0..depth-1, shuffled so chains arrive out of order as relayed batches may
+    static std::vector<Transaction> shuffled_chains(uint8_t senders, uint64_t depth) {
+        std::vector<Transaction> batch;
+        for (uint8_t id = 1; id <= senders; ++id) {
+            for (uint64_t nonce = 0; nonce < depth; ++nonce) {
+                batch.push_back(make_tx(id, 100 + nonce, nonce));
+            }
+        }
+        std::shuffle(batch.begin(), batch.end(), std::mt19937(42));
+        return batch;
+    }
+
+    static Transaction make_tx(uint8_t sender_id, uint64_t gas_price, uint64_t nonce = 0) {
+        // Recipient encodes nonce and price so every variant hashes distinctly
+        Address160 to{};
+        to[0] = 0xAA;
+        to[1] = static_cast<uint8_t>(nonce);
+        for (size_t i = 0; i < sizeof(gas_price); ++i) {
+            to[2 + i] = static_cast<uint8_t>(gas_price >> (i * 8));
+        }
+        Transaction tx(sender(sender_id), Address(to), Amount::from_wei(1));
+        tx.set_gas_price(gas_price);
+        tx.set_nonce(nonce);
+        return tx;
+    }
+
+    MempoolConfig config_;
+    std::unique_ptr<Mempool> pool_;
+};
+
+TEST_F(MempoolTest, AddAndLookup) {
+    auto tx = make_tx(1, 100);
+    EXPECT_EQ(pool_->add_transaction(tx), MempoolError::SUCCESS);
+    EXPECT_TRUE(pool_->has_transaction(tx.calculate_hash()));
+    EXPECT_EQ(pool_->add_transaction(tx), MempoolError::TRANSACTION_EXISTS);
+    EXPECT_EQ(pool_->get_stats().transaction_count, 1u);
+}
+
+TEST_F(MempoolTest, TopTransactionsOrderedByScore) {
+    pool_->add_transaction(make_tx(1, 10));
+    pool_->add_transaction(make_tx(2, 300));
+    pool_->add_transaction(make_tx(3, 200));
+
+    auto top = pool_->get_top_transactions(3);
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top[0].gas_price(), 300u);
+    EXPECT_EQ(top[1].gas_price(), 200u);
+    EXPECT_EQ(top[2].gas_price(), 10u);
+}
+
+TEST_F(MempoolTest, RemoveKeepsIndexConsistent) {
+    auto low = make_tx(1, 10);
+    auto high = make_tx(2, 300);
+    pool_->add_transaction(low);
+    pool_->add_transaction(high);
+
+    EXPECT_EQ(pool_->remove_transaction(high.calculate_hash()), MempoolError::SUCCESS);
+    EXPECT_EQ(pool_->remove_transaction(high.calculate_hash()), MempoolError::INVALID_TRANSACTION);
+
+    auto top = pool_->get_top_transactions(10);
+    ASSERT_EQ(top.size(), 1u);
+    EXPECT_EQ(top[0].calculate_hash(), low.calculate_hash());
+}
+
+TEST_F(MempoolTest, StatsTrackAddAndRemove) {
+    auto a = make_tx(1, 10);
+    auto b = make_tx(2, 50);
+    auto c = make_tx(3, 30);
+    pool_->add_transaction(a);
+    pool_->add_transaction(b);
+    pool_->add_transaction(c);
+
+    auto stats = pool_->get_stats();
+    EXPECT_EQ(stats.transaction_count, 3u);
+    EXPECT_EQ(stats.total_size_bytes, a.size() + b.size() + c.size());
+    EXPECT_EQ(stats.min_fee_per_gas, 10u);
+    EXPECT_EQ(stats.max_fee_per_gas, 50u);
+    EXPECT_DOUBLE_EQ(stats.avg_fee_per_gas, 30.0);
+
+    pool_->remove_transaction(b.calculate_hash());
+    stats = pool_->get_stats();
+    EXPECT_EQ(stats.transaction_count, 2u);
+    EXPECT_EQ(stats.total_size_bytes, a.size() + c.size());
+    EXPECT_EQ(stats.max_fee_per_gas, 30u);
+    EXPECT_DOUBLE_EQ(stats.avg_fee_per_gas, 20.0);
+}
+
+TEST_F(MempoolTest, PoolFullBySize) {
+    auto tx = make_tx(1, 10);
+    MempoolConfig config;
+    config.max_size_bytes = tx.size();
+    config.eviction_threshold_ratio = 2.0;  // Keep inline eviction out of the way
+    pool_ = create_mempool(config);
+
+    EXPECT_EQ(pool_->add_transaction(tx), MempoolError::SUCCESS);
+    EXPECT_EQ(pool_->add_transaction(make_tx(2, 10)), MempoolError::POOL_FULL);
+}
+
+TEST_F(MempoolTest, HandlesMatchCopiesAndOutliveRemoval) {
+    auto low = make_tx(1, 10);
+    auto high = make_tx(2, 300);
+    pool_->add_transaction(low);
+    pool_->add_transaction(high);
+
+    auto handles = pool_->get_block_transaction_handles(10, 21000 * 10);
+    auto copies = pool_->get_transactions_for_block(10, 21000 * 10);
+    ASSERT_EQ(handles.size(), copies.size());
+    for (size_t i = 0; i < handles.size(); ++i) {
+        EXPECT_EQ(*handles[i], copies[i]);
+    }
+
+    pool_->remove_transaction(high.calculate_hash());
+    EXPECT_EQ(handles[0]->calculate_hash(), high.calculate_hash());
+    EXPECT_EQ(pool_->get_top_transaction_handles(10).size(), 1u);
+}
+
+TEST_F(MempoolTest, NonceMustIncreasePerSender) {
+    EXPECT_EQ(pool_->add_transaction(make_tx(1, 100, 5)), MempoolError::SUCCESS);
+    EXPECT_EQ(pool_->add_transaction(make_tx(1, 120, 3)), MempoolError::INVALID_TRANSACTION);
+}
+
+TEST_F(MempoolTest, BatchAdmissionReportsPerItem) {
+    std::vector<Transaction> batch = {
+        make_tx(1, 100, 0),
+        make_tx(1, 100, 1),
+        make_tx(2, 0),          // Below min fee
+        make_tx(1, 100, 0),     // Duplicate of the first
+        make_tx(3, 50),
+    };
+
+    size_t batch_callbacks = 0;
+    size_t reported = 0;
+    pool_->set_transactions_added_callback([&](const std::vector<core::Hash>& hashes) {
+        ++batch_callbacks;
+        reported += hashes.size();
+    });
+
+    auto results = pool_->add_transactions(batch);
+    ASSERT_EQ(results.size(), batch.size());
+    EXPECT_EQ(results[0], MempoolError::SUCCESS);
+    EXPECT_EQ(results[1], MempoolError::SUCCESS);
+    EXPECT_EQ(results[2], MempoolError::INVALID_TRANSACTION);
+    EXPECT_EQ(results[3], MempoolError::TRANSACTION_EXISTS);
+    EXPECT_EQ(results[4], MempoolError::SUCCESS);
+
+    EXPECT_EQ(batch_callbacks, 1u);
+    EXPECT_EQ(reported, 3u);
+    EXPECT_EQ(pool_->get_stats().transaction_count, 3u);
+}
+
+TEST_F(MempoolTest, BatchAdmitsEachSenderInNonceOrder) {
+    // Large enough to be prepared on the worker pool
+    auto batch = shuffled_chains(40, 20);
+    auto results = pool_->add_transactions(batch);
+    ASSERT_EQ(results.size(), batch.size());
+    for (size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(results[i], MempoolError::SUCCESS) << i;
+    }
+    EXPECT_EQ(pool_->get_stats().transaction_count, batch.size());
+
+    // Out-of-order duplicates are still caught against the admitted chain
+    std::vector<Transaction> again = {make_tx(1, 100 + 3, 3), make_tx(1, 100 + 1, 1)};
+    results = pool_->add_transactions(again);
+    EXPECT_EQ(results[0], MempoolError::TRANSACTION_EXISTS);
+    EXPECT_EQ(results[1], MempoolError::TRANSACTION_EXISTS);
+}
+
+TEST_F(MempoolTest, BlockTemplateFollowsNonceChains) {
+    pool_->add_transaction(make_tx(1, 10, 0));
+    pool_->add_transaction(make_tx(1, 500, 1));   // Best score, but only after nonce 0
+    pool_->add_transaction(make_tx(2, 100, 0));
+    pool_->add_transaction(make_tx(3, 400, 0));
+    pool_->add_transaction(make_tx(3, 900, 2));   // Gap at nonce 1, never eligible
+
+    // Sender 1 goes in as a package paying (10 + 500) / 2 per gas, ahead of sender 2
+    auto block = pool_->get_transactions_for_block(10, UINT64_MAX);
+    ASSERT_EQ(block.size(), 4u);
+    EXPECT_EQ(block[0].gas_price(), 400u);
+    EXPECT_EQ(block[1].gas_price(), 10u);
+    EXPECT_EQ(block[2].gas_price(), 500u);
+    EXPECT_EQ(block[3].gas_price(), 100u);
+}
+
+TEST_F(MempoolTest, ChildPaysForParentInBlockTemplate) {
+    pool_->add_transaction(make_tx(1, 5, 0));
+    pool_->add_transaction(make_tx(1, 995, 1));
+    pool_->add_transaction(make_tx(1, 1, 2));     // Would dilute the package, so it is left for later
+    pool_->add_transaction(make_tx(2, 300, 0));
+
+    auto block = pool_->get_transactions_for_block(3, UINT64_MAX);
+    ASSERT_EQ(block.size(), 3u);
+    EXPECT_EQ(block[0].gas_price(), 5u);
+    EXPECT_EQ(block[1].gas_price(), 995u);
+    EXPECT_EQ(block[2].gas_price(), 300u);
+}
+
+TEST_F(MempoolTest, EvictionKeepsDescendantsWithParents) {
+    config_.max_transactions = 10;
+    pool_ = create_mempool(config_);
+
+    // Sender 1's cheap parent is protected by its child; sender 2's cheap chain goes as a whole
+    pool_->add_transaction(make_tx(1, 1, 0));
+    pool_->add_transaction(make_tx(1, 5000, 1));
+    pool_->add_transaction(make_tx(2, 2, 0));
+    pool_->add_transaction(make_tx(2, 3, 1));
+    for (uint8_t id = 3; id <= 8; ++id) {
+        pool_->add_transaction(make_tx(id, 50u + id));
+    }
+
+    pool_->evict_low_fee_transactions();
+    EXPECT_EQ(pool_->get_eviction_metrics().fee_evicted, 2u);
+    EXPECT_TRUE(pool_->has_transaction(make_tx(1, 1, 0).calculate_hash()));
+    EXPECT_FALSE(pool_->has_transaction(make_tx(2, 2, 0).calculate_hash()));
+    EXPECT_FALSE(pool_->has_transaction(make_tx(2, 3, 1).calculate_hash()));
+}
+
+TEST_F(MempoolTest, ExpiryTakesDescendantsWithParent) {
+    config_.transaction_ttl_seconds = 1;
+    pool_ = create_mempool(config_);
+
+    pool_->add_transaction(make_tx(1, 100, 0));
+    pool_->add_transaction(make_tx(2, 100, 0));
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    pool_->add_transaction(make_tx(1, 100, 1));  // Fresh, but behind an expiring parent
+    pool_->add_transaction(make_tx(3, 100, 0));
+
+    pool_->evict_expired_transactions();
+    EXPECT_FALSE(pool_->has_transaction(make_tx(1, 100, 0).calculate_hash()));
+    EXPECT_FALSE(pool_->has_transaction(make_tx(1, 100, 1).calculate_hash()));
+    EXPECT_FALSE(pool_->has_transaction(make_tx(2, 100, 0).calculate_hash()));
+    EXPECT_TRUE(pool_->has_transaction(make_tx(3, 100, 0).calculate_hash()));
+    EXPECT_EQ(pool_->get_eviction_metrics().expired_evicted, 3u);
+}
+
+TEST_F(MempoolTest, IncrementalPackagesMatchRebuiltPool) {
+    // Adds, a removal mid-chain, a replacement and an inclusion, against a pool built from what is left
+    for (uint8_t id = 1; id <= 4; ++id) {
+        for (uint64_t nonce = 0; nonce < 6; ++nonce) {
+            pool_->add_transaction(make_tx(id, 10 + ((id * 37 + nonce * 101) % 500), nonce));
+        }
+    }
+    ASSERT_EQ(pool_->remove_transaction(make_tx(2, 10 + ((2 * 37 + 3 * 101) % 500), 3).calculate_hash()),
+              MempoolError::SUCCESS);
+    ASSERT_EQ(pool_->replace_transaction(make_tx(3, 900, 5)), MempoolError::SUCCESS);
+    ASSERT_EQ(pool_->replace_transaction(make_tx(1, 900, 2)), MempoolError::SUCCESS);
+    std::vector<Transaction> included = {make_tx(4, 10 + ((4 * 37 + 1 * 101) % 500), 1)};
+    pool_->remove_included_transactions(included);
+
+    // A snapshot carries the added times, so the rebuilt pool ages identically
+    auto path = std::filesystem::temp_directory_path() / "chainforge_mempool_incremental_test.bin";
+    ASSERT_EQ(pool_->save_snapshot(path), MempoolError::SUCCESS);
+    auto rebuilt = create_mempool(config_);
+    ASSERT_EQ(rebuilt->load_snapshot(path), MempoolError::SUCCESS);
+    std::filesystem::remove(path);
+    ASSERT_EQ(rebuilt->get_stats().transaction_count, pool_->get_stats().transaction_count);
+
+    for (size_t count : {size_t{1}, size_t{5}, size_t{100}}) {
+        auto expected = rebuilt->get_transactions_for_block(count, UINT64_MAX);
+        auto actual = pool_->get_transactions_for_block(count, UINT64_MAX);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i) {
+            EXPECT_EQ(actual[i].calculate_hash(), expected[i].calculate_hash()) << count << " " << i;
+        }
+    }
+}
+
+TEST_F(MempoolTest, ReplacementMidChainKeepsDescendants) {
+    for (uint64_t nonce = 0; nonce < 4; ++nonce) {
+        pool_->add_transaction(make_tx(1, 100, nonce));
+    }
+    pool_->add_transaction(make_tx(2, 300, 0));
+
+    size_t removed_callbacks = 0;
+    pool_->set_transaction_removed_callback([&](const core::Hash&) { ++removed_callbacks; });
+
+    // Refused replacements leave the pooled transaction where it was
+    EXPECT_EQ(pool_->replace_transaction(make_tx(1, 105, 1)), MempoolError::REPLACE_UNDERPRICED);
+    EXPECT_EQ(pool_->replace_transaction(make_tx(1, 0, 1)), MempoolError::INVALID_TRANSACTION);
+    EXPECT_EQ(pool_->replace_transaction(make_tx(1, 900, 7)), MempoolError::INVALID_TRANSACTION);
+    EXPECT_TRUE(pool_->has_transaction(make_tx(1, 100, 1).calculate_hash()));
+    EXPECT_EQ(removed_callbacks, 0u);
+
+    EXPECT_EQ(pool_->replace_transaction(make_tx(1, 900, 1)), MempoolError::SUCCESS);
+    EXPECT_FALSE(pool_->has_transaction(make_tx(1, 100, 1).calculate_hash()));
+    EXPECT_TRUE(pool_->has_transaction(make_tx(1, 900, 1).calculate_hash()));
+    EXPECT_EQ(removed_callbacks, 1u);
+    EXPECT_EQ(pool_->get_stats().transaction_count, 5u);
+
+    // The chain stays whole, and the new fee lifts the package of nonces 0 and 1 above sender 2
+    auto block = pool_->get_transactions_for_block(10, UINT64_MAX);
+    ASSERT_EQ(block.size(), 5u);
+    EXPECT_EQ(block[0].nonce(), 0u);
+    EXPECT_EQ(block[1].gas_price(), 900u);
+    EXPECT_EQ(block[2].gas_price(), 300u);
+    EXPECT_EQ(block[3].nonce(), 2u);
+    EXPECT_EQ(block[4].nonce(), 3u);
+}
+
+TEST_F(MempoolTest, PackageSizeIsLimited) {
+    config_.max_package_size = 2;
+    pool_ = create_mempool(config_);
+
+    EXPECT_EQ(pool_->add_transaction(make_tx(1, 100, 0)), MempoolError::SUCCESS);
+    EXPECT_EQ(pool_->add_transaction(make_tx(1, 100, 1)), MempoolError::SUCCESS);
+    EXPECT_EQ(pool_->add_transaction(make_tx(1, 100, 2)), MempoolError::PACKAGE_TOO_LARGE);
+}
+
+TEST_F(MempoolTest, BlockTemplateSkipsChainThatDoesNotFit) {
+    auto big = make_tx(1, 100, 0);
+    big.set_gas_limit(50000);
+    pool_->add_transaction(big);
+    pool_->add_transaction(make_tx(1, 1000, 1));
+    pool_->add_transaction(make_tx(2, 50, 0));
+    pool_->add_transaction(make_tx(3, 40, 0));
+
+    // The big head cannot fit, so its successor is out too; the rest packs the remaining gas
+    auto block = pool_->get_transactions_for_block(10, 21000 * 2);
+    ASSERT_EQ(block.size(), 2u);
+    EXPECT_EQ(block[0].gas_price(), 50u);
+    EXPECT_EQ(block[1].gas_price(), 40u);
+}
+
+TEST_F(MempoolTest, RemoveIncludedDropsStaleNonces) {
+    pool_->add_transaction(make_tx(1, 100, 0));
+    pool_->add_transaction(make_tx(1, 100, 1));
+    pool_->add_transaction(make_tx(1, 100, 2));
+    pool_->add_transaction(make_tx(2, 50, 0));
+
+    size_t removed_callbacks = 0;
+    pool_->set_transaction_removed_callback([&](const core::Hash&) { ++removed_callbacks; });
+
+    // A block carrying sender 1's nonce 1 makes its pooled nonce 0 stale as well
+    std::vector<Transaction> included = {make_tx(1, 100, 1)};
+    EXPECT_EQ(pool_->remove_included_transactions(included), 2u);
+    EXPECT_EQ(removed_callbacks, 2u);
+
+    auto block = pool_->get_transactions_for_block(10, UINT64_MAX);
+    ASSERT_EQ(block.size(), 2u);
+    EXPECT_EQ(block[0].nonce(), 2u);
+    EXPECT_EQ(block[1].gas_price(), 50u);
+}
+
+TEST_F(MempoolTest, MaintenanceEvictsLowFeeAndCountsIt) {
+    config_.max_transactions = 10;
+    pool_ = create_mempool(config_);
+    for (uint8_t id = 1; id <= 10; ++id) {
+        pool_->add_transaction(make_tx(id, 10u * id));
+    }
+
+    // 10 pooled is past the 90% threshold, so one pass trims to 80% from the low-fee end
+    pool_->run_maintenance();
+    auto metrics = pool_->get_eviction_metrics();
+    EXPECT_EQ(metrics.maintenance_runs, 1u);
+    EXPECT_EQ(metrics.fee_evicted, 2u);
+    EXPECT_EQ(metrics.expired_evicted, 0u);
+    EXPECT_EQ(pool_->get_stats().min_fee_per_gas, 30u);
+}
+
+TEST_F(MempoolTest, BackgroundWorkerExpiresTransactions) {
+    config_.transaction_ttl_seconds = 0;
+    config_.eviction_interval_seconds = 1;
+    config_.background_eviction = true;
+    pool_ = create_mempool(config_);
+    pool_->add_transaction(make_tx(1, 100));
+    pool_->add_transaction(make_tx(2, 100));
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pool_->get_stats().transaction_count > 0 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    EXPECT_EQ(pool_->get_stats().transaction_count, 0u);
+    auto metrics = pool_->get_eviction_metrics();
+    EXPECT_EQ(metrics.expired_evicted, 2u);
+    EXPECT_GE(metrics.maintenance_runs, 1u);
+}
+
+TEST_F(MempoolTest, SnapshotRoundTrip) {
+    auto path = std::filesystem::temp_directory_path() / "chainforge_mempool_snapshot_test.bin";
+    auto with_payload = make_tx(3, 70);
+    with_payload.set_data({0x01, 0x02, 0x03});
+
+    pool_->add_transaction(make_tx(1, 100, 0));
+    pool_->add_transaction(make_tx(1, 100, 1));
+    pool_->add_transaction(make_tx(2, 50, 0));
+    pool_->add_transaction(with_payload);
+    ASSERT_EQ(pool_->save_snapshot(path), MempoolError::SUCCESS);
+
+    auto restored = create_mempool(config_);
+    ASSERT_EQ(restored->load_snapshot(path), MempoolError::SUCCESS);
+    std::filesystem::remove(path);
+
+    auto original_hashes = pool_->get_all_transaction_hashes();
+    ASSERT_EQ(restored->get_stats().transaction_count, original_hashes.size());
+    for (const auto& hash : original_hashes) {
+        EXPECT_EQ(restored->get_transaction(hash), pool_->get_transaction(hash));
+    }
+    EXPECT_EQ(restored->get_stats().total_size_bytes, pool_->get_stats().total_size_bytes);
+}
+
+TEST_F(MempoolTest, SnapshotTimesFromTheFutureAreClamped) {
+    auto path = std::filesystem::temp_directory_path() / "chainforge_mempool_snapshot_future.bin";
+    pool_->add_transaction(make_tx(1, 100));
+    ASSERT_EQ(pool_->save_snapshot(path), MempoolError::SUCCESS);
+
+    // Overwrite the entry's admission time as if the clock had stepped back a day since it was saved:
+    // it follows the 16-byte header, the record length, both addresses and four u64 fields
+    const std::streamoff added_time_offset = 16 + 4 + 2 * 20 + 4 * 8;
+    uint64_t future = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+                          std::chrono::system_clock::now().time_since_epoch()).count()) + 86400;
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(added_time_offset);
+        for (size_t i = 0; i < sizeof(future); ++i) {
+            file.put(static_cast<char>(future >> (8 * i)));
+        }
+    }
+
+    config_.transaction_ttl_seconds = 1;
+    auto restored = create_mempool(config_);
+    ASSERT_EQ(restored->load_snapshot(path), MempoolError::SUCCESS);
+    std::filesystem::remove(path);
+
+    ASSERT_EQ(restored->get_stats().transaction_count, 1u);
+    EXPECT_LE(restored->get_stats().oldest_transaction_age, 5u);
+
+    // Restored as admitted now, so it expires on the normal schedule rather than a day late
+    std::this_thread::sleep_for(std::chrono::seconds(2));
+    restored->evict_expired_transactions();
+    EXPECT_EQ(restored->get_stats().transaction_count, 0u);
+}
+
+TEST_F(MempoolTest, SnapshotRejectsMissingOrTruncatedFiles) {
+    auto path = std::filesystem::temp_directory_path() / "chainforge_mempool_snapshot_truncated.bin";
+    EXPECT_EQ(pool_->load_snapshot(path), MempoolError::SNAPSHOT_IO_ERROR);
+
+    pool_->add_transaction(make_tx(1, 100));
+    pool_->add_transaction(make_tx(2, 100));
+    ASSERT_EQ(pool_->save_snapshot(path), MempoolError::SUCCESS);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+
+    auto restored = create_mempool(config_);
+    EXPECT_EQ(restored->load_snapshot(path), MempoolError::SNAPSHOT_CORRUPT);
+    EXPECT_EQ(restored->get_stats().transaction_count, 1u);  // Entries before the damage are kept
+    std::filesystem::remove(path);
+}
+
+TEST_F(MempoolTest, ClearEmptiesEveryIndex) {
+    pool_->add_transaction(make_tx(1, 100));
+    pool_->add_transaction(make_tx(2, 200));
+    pool_->clear();
+
+    EXPECT_TRUE(pool_->get_top_transactions(10).empty());
+    EXPECT_EQ(pool_->get_stats().transaction_count, 0u);
+    EXPECT_EQ(pool_->add_transaction(make_tx(1, 100)), MempoolError::SUCCESS);
+}
+
+TEST_F(MempoolTest, TopOrderMatchesBruteForceRescore) {
+    std::mt19937_64 rng(7);
+    std::vector<Transaction> txs;
+    for (uint8_t id = 1; id <= 40; ++id) {
+        auto tx = make_tx(id, 1 + rng() % 5000);
+        tx.set_data(std::vector<uint8_t>(rng() % 4000, 0x5A));  // Spread sizes across the KB size penalty
+        ASSERT_EQ(pool_->add_transaction(tx), MempoolError::SUCCESS);
+        txs.push_back(tx);
+    }
+
+    // Same admission second for everything, so the brute-force score only depends on fee and size
+    auto brute_score = [](const Transaction& tx) {
+        return TransactionPriority{static_cast<double>(tx.gas_price()), 0, tx.size()}.calculate_score();
+    };
+    std::sort(txs.begin(), txs.end(), [&](const Transaction& a, const Transaction& b) {
+        return brute_score(a) > brute_score(b);
+    });
+
+    auto top = pool_->get_top_transactions(txs.size());
+    ASSERT_EQ(top.size(), txs.size());
+    for (size_t i = 0; i < top.size(); ++i) {
+        EXPECT_DOUBLE_EQ(brute_score(top[i]), brute_score(txs[i])) << "position " << i;
+    }
+}
+
+TEST(TransactionPriorityTest, OrderingKeyMatchesBruteForceRescore) {
+    struct Sample {
+        TransactionPriority priority;
+        uint64_t added_timestamp;
+    };
+
+    std::mt19937_64 rng(11);
+    const uint64_t base_time = 1'700'000'000;
+    std::vector<Sample> samples;
+    for (size_t i = 0; i < 500; ++i) {
+        TransactionPriority priority{static_cast<double>(1 + rng() % 100000), 0, 100 + rng() % 20000};
+        samples.push_back({priority, base_time + rng() % 7200});
+    }
+
+    // Order once by key, then rescore everything from scratch at several later instants
+    std::sort(samples.begin(), samples.end(), [](const Sample& a, const Sample& b) {
+        return a.priority.ordering_key(a.added_timestamp) > b.priority.ordering_key(b.added_timestamp);
+    });
+
+    for (uint64_t now : {base_time + 7200, base_time + 10800, base_time + 86400}) {
+        double previous = std::numeric_limits<double>::infinity();
+        for (const auto& sample : samples) {
+            TransactionPriority aged = sample.priority;
+            aged.age_seconds = now - sample.added_timestamp;
+            double score = aged.calculate_score();
+
+            EXPECT_LE(score, previous * (1.0 + 1e-9));
+            EXPECT_NEAR(TransactionPriority::score_at(sample.priority.ordering_key(sample.added_timestamp), now),
+                        score, score * 1e-9);
+            previous = score;
+        }
+    }
+}
+
+class ShardedMempoolTest : public MempoolTest {
+protected:
+    void SetUp() override {
+        config_.shard_count = 4;
+        pool_ = create_mempool(config_);
+    }
+};
+
+TEST_F(ShardedMempoolTest, LookupAndRemoveAcrossShards) {
+    std::vector<Transaction> txs;
+    for (uint8_t id = 1; id <= 16; ++id) {
+        txs.push_back(make_tx(id, 10u * id));
+        ASSERT_EQ(pool_->add_transaction(txs.back()), MempoolError::SUCCESS);
+    }
+
+    EXPECT_EQ(pool_->get_stats().transaction_count, 16u);
+    for (const auto& tx : txs) {
+        EXPECT_TRUE(pool_->has_transaction(tx.calculate_hash()));
+    }
+
+    EXPECT_EQ(pool_->remove_transaction(txs[3].calculate_hash()), MempoolError::SUCCESS);
+    EXPECT_FALSE(pool_->has_transaction(txs[3].calculate_hash()));
+    EXPECT_EQ(pool_->remove_transaction(txs[3].calculate_hash()), MempoolError::INVALID_TRANSACTION);
+}
+
+TEST_F(ShardedMempoolTest, MergedTopOfBook) {
+    for (uint8_t id = 1; id <= 16; ++id) {
+        pool_->add_transaction(make_tx(id, 10u * id));
+    }
+
+    auto top = pool_->get_top_transactions(5);
+    ASSERT_EQ(top.size(), 5u);
+    for (size_t i = 0; i < top.size(); ++i) {
+        EXPECT_EQ(top[i].gas_price(), 10u * (16 - i));
+    }
+
+    auto block = pool_->get_transactions_for_block(100, 21000 * 3);
+    ASSERT_EQ(block.size(), 3u);
+    EXPECT_EQ(block[0].gas_price(), 160u);
+}
+
+TEST_F(ShardedMempoolTest, BatchAdmissionAcrossShards) {
+    std::vector<Transaction> batch;
+    for (uint8_t id = 1; id <= 32; ++id) {
+        batch.push_back(make_tx(id, 10u * id));
+    }
+
+    auto results = pool_->add_transactions(batch);
+    for (auto result : results) {
+        EXPECT_EQ(result, MempoolError::SUCCESS);
+    }
+    for (const auto& tx : batch) {
+        EXPECT_TRUE(pool_->has_transaction(tx.calculate_hash()));
+    }
+    EXPECT_EQ(pool_->get_top_transactions(1)[0].gas_price(), 320u);
+}
+
+TEST_F(ShardedMempoolTest, BlockTemplateFollowsNonceChains) {
+    for (uint8_t id = 1; id <= 8; ++id) {
+        pool_->add_transaction(make_tx(id, 10u * id, 0));
+        pool_->add_transaction(make_tx(id, 1000u - id, 1));
+    }
+
+    auto block = pool_->get_transactions_for_block(100, UINT64_MAX);
+    ASSERT_EQ(block.size(), 16u);
+
+    std::unordered_map<Address, uint64_t> next_nonce;
+    for (const auto& tx : block) {
+        EXPECT_EQ(tx.nonce(), next_nonce[tx.from()]++);
+    }
+
+    std::vector<Transaction> included(block.begin(), block.begin() + 4);
+    pool_->remove_included_transactions(included);
+    for (const auto& tx : included) {
+        EXPECT_FALSE(pool_->has_transaction(tx.calculate_hash()));
+    }
+}
+
+TEST_F(ShardedMempoolTest, BlockTemplatePacksWholePackages) {
+    MempoolConfig single_config;
+    auto single = create_mempool(single_config);
+    for (const auto& tx : {make_tx(1, 1, 0),
+                           make_tx(1, 5000, 1),   // Pays for its parent, so the two only go in together
+                           make_tx(2, 3000, 0), make_tx(3, 2900, 0), make_tx(4, 100, 0)}) {
+        ASSERT_EQ(pool_->add_transaction(tx), MempoolError::SUCCESS);
+        ASSERT_EQ(single->add_transaction(tx), MempoolError::SUCCESS);
+    }
+
+    // Room for three transfers: the package no longer fits after the two best singles,
+    // and its parent must not be taken on its own
+    auto block = pool_->get_transactions_for_block(100, 21000 * 3);
+    ASSERT_EQ(block.size(), 3u);
+    EXPECT_EQ(block[0].gas_price(), 3000u);
+    EXPECT_EQ(block[1].gas_price(), 2900u);
+    EXPECT_EQ(block[2].gas_price(), 100u);
+
+    for (auto [max_count, max_gas] : {std::pair<size_t, uint64_t>{100, 21000 * 3}, {3, UINT64_MAX}, {100, UINT64_MAX}}) {
+        auto sharded_block = pool_->get_transactions_for_block(max_count, max_gas);
+        auto single_block = single->get_transactions_for_block(max_count, max_gas);
+        ASSERT_EQ(sharded_block.size(), single_block.size());
+        for (size_t i = 0; i < sharded_block.size(); ++i) {
+            EXPECT_EQ(sharded_block[i].calculate_hash(), single_block[i].calculate_hash());
+        }
+    }
+}
+
+TEST_F(ShardedMempoolTest, SnapshotRestoresIntoSingleLockPool) {
+    auto path = std::filesystem::temp_directory_path() / "chainforge_sharded_snapshot_test.bin";
+    for (uint8_t id = 1; id <= 16; ++id) {
+        pool_->add_transaction(make_tx(id, 10u * id, 0));
+        pool_->add_transaction(make_tx(id, 10u * id, 1));
+    }
+    ASSERT_EQ(pool_->save_snapshot(path), MempoolError::SUCCESS);
+
+    MempoolConfig single_config;
+    auto restored = create_mempool(single_config);
+    ASSERT_EQ(restored->load_snapshot(path), MempoolError::SUCCESS);
+    std::filesystem::remove(path);
+
+    EXPECT_EQ(restored->get_stats().transaction_count, 32u);
+    for (const auto& hash : pool_->get_all_transaction_hashes()) {
+        EXPECT_TRUE(restored->has_transaction(hash));
+    }
+}
+
+TEST_F(ShardedMempoolTest, ReconfigureWhileAdmitting) {
+    // Batches read the config while other threads replace it and restart the worker; run under TSan to catch races
+    std::atomic<bool> done{false};
+    std::vector<std::thread> reconfigurers;
+    for (int t = 0; t < 2; ++t) {
+        reconfigurers.emplace_back([&, t]() {
+            MempoolConfig config = config_;
+            for (uint64_t round = 0; !done; ++round) {
+                config.min_fee_per_gas = 1 + round % 2;
+                config.background_eviction = (round + static_cast<uint64_t>(t)) % 2 == 0;
+                pool_->set_config(config);
+            }
+        });
+    }
+
+    for (uint8_t id = 1; id <= 50; ++id) {
+        std::vector<Transaction> batch = {make_tx(id, 100, 0), make_tx(id, 100, 1)};
+        auto results = pool_->add_transactions(batch);
+        EXPECT_EQ(results[0], MempoolError::SUCCESS);
+        EXPECT_EQ(results[1], MempoolError::SUCCESS);
+    }
+    done = true;
+    for (auto& thread : reconfigurers) {
+        thread.join();
+    }
+
+    EXPECT_EQ(pool_->get_config().shard_count, 4u);
+    EXPECT_EQ(pool_->get_stats().transaction_count, 100u);
+}
+
+TEST_F(ShardedMempoolTest, BatchAdmitsEachSenderInNonceOrder) {
+    auto batch = shuffled_chains(40, 20);
+    auto results = pool_->add_transactions(batch);
+    for (size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(results[i], MempoolError::SUCCESS) << i;
+    }
+    EXPECT_EQ(pool_->get_stats().transaction_count, batch.size());
+}
+
+TEST_F(ShardedMempoolTest, SenderNonceOrderingIsShardLocal) {
+    EXPECT_EQ(pool_->add_transaction(make_tx(7, 100, 5)), MempoolError::SUCCESS);
+    EXPECT_EQ(pool_->add_transaction(make_tx(7, 120, 3)), MempoolError::INVALID_TRANSACTION);
+    EXPECT_EQ(pool_->add_transaction(make_tx(7, 120, 6)), MempoolError::SUCCESS);
+}
+
+} // namespace chainforge::mempool::test